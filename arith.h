@@ -52,6 +52,10 @@ FLINT_DLL void arith_divisors(fmpz_poly_t res, const fmpz_t n);
 #define arith_moebius_mu fmpz_moebius_mu
 #define arith_euler_phi fmpz_euler_phi
 
+/* The multimodular Bell, Euler and Bernoulli functions only use several
+   threads for indices (or vector lengths) of at least this size */
+#define ARITH_MULTI_MOD_THREADED_CUTOFF 256
+
 /* Stirling numbers **********************************************************/
 
 FLINT_DLL void arith_stirling_number_1u(fmpz_t s, slong n, slong k);
@@ -146,6 +150,8 @@ FLINT_DLL void _arith_bernoulli_number(fmpz_t num, fmpz_t den, ulong n);
 FLINT_DLL void arith_bernoulli_number(fmpq_t x, ulong n);
 
 FLINT_DLL void _arith_bernoulli_number_vec(fmpz * num, fmpz * den, slong n);
+FLINT_DLL void _arith_bernoulli_number_vec_uncached(fmpz * num,
+                                                      fmpz * den, slong n);
 FLINT_DLL void arith_bernoulli_number_vec(fmpq * num, slong n);
 
 FLINT_DLL void arith_bernoulli_number_denom(fmpz_t den, ulong n);
@@ -158,6 +164,12 @@ FLINT_DLL void _arith_bernoulli_number_vec_multi_mod(fmpz * num, fmpz * den, slo
 FLINT_DLL void _arith_bernoulli_number_vec_recursive(fmpz * num, fmpz * den, slong n);
 FLINT_DLL void _arith_bernoulli_number_vec_zeta(fmpz * num, fmpz * den, slong n);
 
+FLINT_DLL void arith_bernoulli_cache_enable(void);
+FLINT_DLL void arith_bernoulli_cache_clear(void);
+FLINT_DLL int _arith_bernoulli_cache_get(fmpz * num, fmpz * den,
+                                                    slong start, slong len);
+FLINT_DLL int _arith_bernoulli_cache_extend(slong n);
+
 /* Cyclotomic polynomials ****************************************************/
 
 #define _arith_cyclotomic_polynomial _fmpz_poly_cyclotomic
@@ -219,6 +231,8 @@ FLINT_DLL void arith_hrr_expsum_factored(trig_prod_t prod, mp_limb_t k, mp_limb_
 
 /* Number of partitions ******************************************************/
 
+#define ARITH_NUMBER_OF_PARTITIONS_THREADED_CUTOFF 1000000
+
 FLINT_DLL void arith_number_of_partitions_nmod_vec(mp_ptr res, slong len, nmod_t mod);
 FLINT_DLL void arith_number_of_partitions_vec(fmpz * res, slong len);
 FLINT_DLL void arith_number_of_partitions_mpfr(mpfr_t x, ulong n);
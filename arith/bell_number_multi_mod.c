@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -9,16 +10,56 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
 #include "arith.h"
 
+typedef struct
+{
+    mp_ptr residues;
+    const mp_limb_t * primes;
+    ulong n;
+    slong start;
+    slong stop;
+}
+_bell_residues_arg_t;
+
+static void
+_bell_residues(_bell_residues_arg_t * arg)
+{
+    nmod_t mod;
+    slong k;
+
+    for (k = arg->start; k < arg->stop; k++)
+    {
+        nmod_init(&mod, arg->primes[k]);
+        arg->residues[k] = arith_bell_number_nmod(arg->n, mod);
+    }
+}
+
+static void *
+_bell_residues_worker(void * arg_ptr)
+{
+    _bell_residues((_bell_residues_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
 void
 arith_bell_number_multi_mod(fmpz_t res, ulong n)
 {
     fmpz_comb_temp_t temp;
     fmpz_comb_t comb;
-    nmod_t mod;
+    _bell_residues_arg_t * args;
+    pthread_t * threads;
     mp_ptr primes, residues;
-    slong k, num_primes;
+    slong i, k, num_primes, num_threads;
     mp_bitcnt_t size, prime_bits;
 
     size = arith_bell_number_size(n);
@@ -32,12 +73,29 @@ arith_bell_number_multi_mod(fmpz_t res, ulong n)
     for (k = 1; k < num_primes; k++)
         primes[k] = n_nextprime(primes[k-1], 0);
 
-    for (k = 0; k < num_primes; k++)
+    num_threads = flint_get_num_threads();
+    if (n < ARITH_MULTI_MOD_THREADED_CUTOFF)
+        num_threads = 1;
+    num_threads = FLINT_MIN(num_threads, num_primes);
+
+    args = flint_malloc(num_threads * sizeof(_bell_residues_arg_t));
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+    for (i = 0; i < num_threads; i++)
     {
-        nmod_init(&mod, primes[k]);
-        residues[k] = arith_bell_number_nmod(n, mod);
+        args[i].residues = residues;
+        args[i].primes = primes;
+        args[i].n = n;
+        args[i].start = (i * num_primes) / num_threads;
+        args[i].stop = ((i + 1) * num_primes) / num_threads;
     }
 
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _bell_residues_worker, &args[i]);
+    _bell_residues(&args[0]);
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
     fmpz_comb_init(comb, primes, num_primes);
     fmpz_comb_temp_init(temp, comb);
 
@@ -46,6 +104,8 @@ arith_bell_number_multi_mod(fmpz_t res, ulong n)
     fmpz_comb_clear(comb);
     fmpz_comb_temp_clear(temp);
 
+    flint_free(args);
+    flint_free(threads);
     flint_free(primes);
     flint_free(residues);
 }
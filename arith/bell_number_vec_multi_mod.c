@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -9,20 +10,110 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
 #include "nmod_poly.h"
 #include "arith.h"
 
 #define CRT_MAX_RESOLUTION 16
 
+typedef struct
+{
+    fmpz * res;
+    const mp_limb_t * primes;
+    mp_ptr * polys;
+    const fmpz_comb_struct * comb;
+    slong resolution;
+    slong n;
+    slong start;
+    slong stop;
+    slong step;
+}
+_bell_multi_mod_arg_t;
+
+/* Computes the images modulo primes[start], ..., primes[stop - 1] */
+static void
+_bell_images(_bell_multi_mod_arg_t * arg)
+{
+    nmod_t mod;
+    slong k;
+
+    for (k = arg->start; k < arg->stop; k++)
+    {
+        nmod_init(&mod, arg->primes[k]);
+        arith_bell_number_nmod_vec(arg->polys[k], arg->n, mod);
+    }
+}
+
+static void *
+_bell_images_worker(void * arg_ptr)
+{
+    _bell_images((_bell_multi_mod_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* Reconstructs B_k for k = start, start + step, ... */
+static void
+_bell_crt(_bell_multi_mod_arg_t * arg)
+{
+    fmpz_comb_temp_struct temp[CRT_MAX_RESOLUTION];
+    mp_ptr residues;
+    slong i, j, k, num_primes_k;
+    mp_bitcnt_t size, prime_bits = FLINT_BITS - 1;
+
+    for (i = 0; i < arg->resolution; i++)
+        fmpz_comb_temp_init(temp + i, arg->comb + i);
+
+    residues = flint_malloc(arg->comb[arg->resolution - 1].num_primes
+                                                        * sizeof(mp_limb_t));
+
+    for (k = arg->start; k < arg->n; k += arg->step)
+    {
+        size = arith_bell_number_size(k);
+        /* Use only as large a comb as needed */
+        num_primes_k = (size + prime_bits - 1) / prime_bits;
+        for (i = 0; i < arg->resolution; i++)
+        {
+            if (arg->comb[i].num_primes >= num_primes_k)
+                break;
+        }
+        num_primes_k = arg->comb[i].num_primes;
+        for (j = 0; j < num_primes_k; j++)
+            residues[j] = arg->polys[j][k];
+        fmpz_multi_CRT_ui(arg->res + k, residues, arg->comb + i, temp + i, 0);
+    }
+
+    flint_free(residues);
+
+    for (i = 0; i < arg->resolution; i++)
+        fmpz_comb_temp_clear(temp + i);
+}
+
+static void *
+_bell_crt_worker(void * arg_ptr)
+{
+    _bell_crt((_bell_multi_mod_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
 void
 arith_bell_number_vec_multi_mod(fmpz * res, slong n)
 {
-    fmpz_comb_t comb[CRT_MAX_RESOLUTION];
-    fmpz_comb_temp_t temp[CRT_MAX_RESOLUTION];
-    mp_ptr primes, residues;
+    fmpz_comb_struct comb[CRT_MAX_RESOLUTION];
+    _bell_multi_mod_arg_t * args;
+    pthread_t * threads;
+    mp_ptr primes;
     mp_ptr * polys;
-    nmod_t mod;
-    slong i, j, k, num_primes, num_primes_k, resolution;
+    slong i, k, num_primes, num_threads, resolution;
     mp_bitcnt_t size, prime_bits;
 
     if (n < 1)
@@ -35,57 +126,66 @@ arith_bell_number_vec_multi_mod(fmpz * res, slong n)
     num_primes = (size + prime_bits - 1) / prime_bits;
 
     primes = flint_malloc(num_primes * sizeof(mp_limb_t));
-    residues = flint_malloc(num_primes * sizeof(mp_limb_t));
     polys = flint_malloc(num_primes * sizeof(mp_ptr));
 
-    /* Compute Bell numbers mod p */
     primes[0] = n_nextprime(UWORD(1)<<prime_bits, 0);
     for (k = 1; k < num_primes; k++)
         primes[k] = n_nextprime(primes[k-1], 0);
-
     for (k = 0; k < num_primes; k++)
-    {
-        /* flint_printf("prime %wd of %wd\n", k, num_primes); */
         polys[k] = _nmod_vec_init(n);
-        nmod_init(&mod, primes[k]);
-        arith_bell_number_nmod_vec(polys[k], n, mod);
+
+    num_threads = flint_get_num_threads();
+    if (n < ARITH_MULTI_MOD_THREADED_CUTOFF)
+        num_threads = 1;
+    num_threads = FLINT_MIN(num_threads, num_primes);
+
+    args = flint_malloc(num_threads * sizeof(_bell_multi_mod_arg_t));
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].res = res;
+        args[i].primes = primes;
+        args[i].polys = polys;
+        args[i].comb = comb;
+        args[i].resolution = resolution;
+        args[i].n = n;
+        args[i].start = (i * num_primes) / num_threads;
+        args[i].stop = ((i + 1) * num_primes) / num_threads;
     }
 
+    /* Compute Bell numbers mod p */
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _bell_images_worker, &args[i]);
+    _bell_images(&args[0]);
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
     /* Init CRT comb */
     for (i = 0; i < resolution; i++)
-    {
-        fmpz_comb_init(comb[i], primes, num_primes * (i + 1) / resolution);
-        fmpz_comb_temp_init(temp[i], comb[i]);
-    }
+        fmpz_comb_init(comb + i, primes, num_primes * (i + 1) / resolution);
 
-    /* Reconstruction */
-    for (k = 0; k < n; k++)
+    /* Reconstruction, interleaved as the cost grows with k */
+    for (i = 0; i < num_threads; i++)
     {
-        size = arith_bell_number_size(k);
-        /* Use only as large a comb as needed */
-        num_primes_k = (size + prime_bits - 1) / prime_bits;
-        for (i = 0; i < resolution; i++)
-        {
-            if (comb[i]->num_primes >= num_primes_k)
-                break;
-        }
-        num_primes_k = comb[i]->num_primes;
-        for (j = 0; j < num_primes_k; j++)
-            residues[j] = polys[j][k];
-        fmpz_multi_CRT_ui(res + k, residues, comb[i], temp[i], 0);
+        args[i].start = i;
+        args[i].step = num_threads;
     }
 
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _bell_crt_worker, &args[i]);
+    _bell_crt(&args[0]);
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
     /* Cleanup */
     for (k = 0; k < num_primes; k++)
         _nmod_vec_clear(polys[k]);
-
     for (i = 0; i < resolution; i++)
-    {
-        fmpz_comb_temp_clear(temp[i]);
-        fmpz_comb_clear(comb[i]);
-    }
+        fmpz_comb_clear(comb + i);
 
+    flint_free(args);
+    flint_free(threads);
     flint_free(primes);
-    flint_free(residues);
     flint_free(polys);
 }
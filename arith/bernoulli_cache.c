@@ -0,0 +1,144 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "arith.h"
+
+/*
+   The cache is shared by all threads, so unlike the prime tables it is
+   never thread local and is always protected by a lock. Numerators and
+   denominators are stored in a single vector of length 2*len.
+*/
+static pthread_once_t bernoulli_cache_initialised = PTHREAD_ONCE_INIT;
+static pthread_mutex_t bernoulli_cache_lock;
+
+static int bernoulli_cache_enabled = 0;
+static fmpz * bernoulli_cache = NULL;
+static slong bernoulli_cache_len = 0;
+
+static void
+bernoulli_cache_init(void)
+{
+    pthread_mutex_init(&bernoulli_cache_lock, NULL);
+}
+
+void arith_bernoulli_cache_enable(void)
+{
+    int newly_enabled;
+
+    pthread_once(&bernoulli_cache_initialised, bernoulli_cache_init);
+    pthread_mutex_lock(&bernoulli_cache_lock);
+
+    newly_enabled = !bernoulli_cache_enabled;
+    bernoulli_cache_enabled = 1;
+
+    pthread_mutex_unlock(&bernoulli_cache_lock);
+
+    /* flint_cleanup holds its own lock while calling us, so register
+       outside of the cache lock */
+    if (newly_enabled)
+        flint_register_cleanup_function(arith_bernoulli_cache_clear);
+}
+
+void arith_bernoulli_cache_clear(void)
+{
+    pthread_once(&bernoulli_cache_initialised, bernoulli_cache_init);
+    pthread_mutex_lock(&bernoulli_cache_lock);
+
+    if (bernoulli_cache_len != 0)
+        _fmpz_vec_clear(bernoulli_cache, 2 * bernoulli_cache_len);
+
+    bernoulli_cache = NULL;
+    bernoulli_cache_len = 0;
+    bernoulli_cache_enabled = 0;
+
+    pthread_mutex_unlock(&bernoulli_cache_lock);
+}
+
+int _arith_bernoulli_cache_get(fmpz * num, fmpz * den, slong start, slong len)
+{
+    slong i;
+
+    pthread_once(&bernoulli_cache_initialised, bernoulli_cache_init);
+    pthread_mutex_lock(&bernoulli_cache_lock);
+
+    if (!bernoulli_cache_enabled || start + len > bernoulli_cache_len)
+    {
+        pthread_mutex_unlock(&bernoulli_cache_lock);
+        return 0;
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        fmpz_set(num + i, bernoulli_cache + start + i);
+        fmpz_set(den + i, bernoulli_cache + bernoulli_cache_len + start + i);
+    }
+
+    pthread_mutex_unlock(&bernoulli_cache_lock);
+
+    return 1;
+}
+
+int _arith_bernoulli_cache_extend(slong n)
+{
+    slong len, new_len;
+    fmpz * new_cache;
+    int enabled;
+
+    pthread_once(&bernoulli_cache_initialised, bernoulli_cache_init);
+    pthread_mutex_lock(&bernoulli_cache_lock);
+
+    enabled = bernoulli_cache_enabled;
+    len = bernoulli_cache_len;
+
+    pthread_mutex_unlock(&bernoulli_cache_lock);
+
+    if (!enabled || n <= len)
+        return enabled;
+
+    /* at least double the length so that the cost of growing the cache
+       is amortised over successive extensions; the new table is computed
+       without holding the lock, so lookups are not blocked meanwhile */
+    new_len = FLINT_MAX(n, 2 * len);
+    new_cache = _fmpz_vec_init(2 * new_len);
+
+    _arith_bernoulli_number_vec_uncached(new_cache,
+                                           new_cache + new_len, new_len);
+
+    pthread_mutex_lock(&bernoulli_cache_lock);
+
+    enabled = bernoulli_cache_enabled;
+
+    /* keep whichever table is longer, another thread may have won */
+    if (enabled && new_len > bernoulli_cache_len)
+    {
+        fmpz * t = bernoulli_cache;
+        bernoulli_cache = new_cache;
+        new_cache = t;
+
+        len = bernoulli_cache_len;
+        bernoulli_cache_len = new_len;
+        new_len = len;
+    }
+
+    pthread_mutex_unlock(&bernoulli_cache_lock);
+
+    if (new_len != 0)
+        _fmpz_vec_clear(new_cache, 2 * new_len);
+
+    return enabled;
+}
@@ -13,7 +13,8 @@
 
 void _arith_bernoulli_number(fmpz_t num, fmpz_t den, ulong n)
 {
-    _arith_bernoulli_number_zeta(num, den, n);
+    if (!_arith_bernoulli_cache_get(num, den, n, 1))
+        _arith_bernoulli_number_zeta(num, den, n);
 }
 
 void arith_bernoulli_number(fmpq_t x, ulong n)
@@ -11,7 +11,7 @@
 
 #include "arith.h"
 
-void _arith_bernoulli_number_vec(fmpz * num, fmpz * den, slong n)
+void _arith_bernoulli_number_vec_uncached(fmpz * num, fmpz * den, slong n)
 {
     if (n < 700)
         _arith_bernoulli_number_vec_recursive(num, den, n);
@@ -21,6 +21,15 @@ void _arith_bernoulli_number_vec(fmpz * num, fmpz * den, slong n)
         _arith_bernoulli_number_vec_multi_mod(num, den, n);
 }
 
+void _arith_bernoulli_number_vec(fmpz * num, fmpz * den, slong n)
+{
+    if (n <= 0 || (_arith_bernoulli_cache_extend(n)
+                   && _arith_bernoulli_cache_get(num, den, 0, n)))
+        return;
+
+    _arith_bernoulli_number_vec_uncached(num, den, n);
+}
+
 void arith_bernoulli_number_vec(fmpq * x, slong n)
 {
     fmpz * num, * den;
@@ -138,13 +138,13 @@ void _arith_bernoulli_number_vec_recursive(fmpz * num, fmpz * den, slong n)
 
     /* Initial values */
     for (i = 0; i < start; i += 2)
-        _arith_bernoulli_number(num + i, den + i, i);
+        _arith_bernoulli_number_zeta(num + i, den + i, i);
 
     __ramanujan_even_common_denom(num, den, start, n);
 
     /* Odd values */
     for (i = 1; i < n; i += 2)
-        _arith_bernoulli_number(num + i, den + i, i);
+        _arith_bernoulli_number_zeta(num + i, den + i, i);
 
     fmpz_clear(d);
     fmpz_clear(t);
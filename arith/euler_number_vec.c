@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -9,7 +10,14 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
 #include <math.h>
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
 #include "arith.h"
 
 /* Computes length-m vector containing |E_{2k}| */
@@ -42,16 +50,105 @@ __euler_number_vec_mod_p(mp_ptr res, mp_ptr tmp, slong m, nmod_t mod)
 
 #define CRT_MAX_RESOLUTION 16
 
-void __euler_number_vec_multi_mod(fmpz * res, slong n)
+typedef struct
 {
-    fmpz_comb_t comb[CRT_MAX_RESOLUTION];
-    fmpz_comb_temp_t temp[CRT_MAX_RESOLUTION];
-    mp_limb_t * primes;
-    mp_limb_t * residues;
+    fmpz * res;
+    const mp_limb_t * primes;
     mp_ptr * polys;
+    const fmpz_comb_struct * comb;
+    slong resolution;
+    slong n;
+    slong m;
+    slong start;
+    slong stop;
+    slong step;
+}
+_euler_multi_mod_arg_t;
+
+/* Computes the images modulo primes[start], ..., primes[stop - 1] */
+static void
+_euler_images(_euler_multi_mod_arg_t * arg)
+{
     mp_ptr temppoly;
     nmod_t mod;
-    slong i, j, k, m, num_primes, num_primes_k, resolution;
+    slong k;
+
+    temppoly = _nmod_vec_init(arg->m);
+
+    for (k = arg->start; k < arg->stop; k++)
+    {
+        nmod_init(&mod, arg->primes[k]);
+        __euler_number_vec_mod_p(arg->polys[k], temppoly, arg->m, mod);
+    }
+
+    _nmod_vec_clear(temppoly);
+}
+
+static void *
+_euler_images_worker(void * arg_ptr)
+{
+    _euler_images((_euler_multi_mod_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* Reconstructs E_k for k = start, start + step, ... */
+static void
+_euler_crt(_euler_multi_mod_arg_t * arg)
+{
+    fmpz_comb_temp_struct temp[CRT_MAX_RESOLUTION];
+    mp_ptr residues;
+    slong i, j, k, num_primes_k;
+    mp_bitcnt_t size, prime_bits = FLINT_BITS - 1;
+
+    for (i = 0; i < arg->resolution; i++)
+        fmpz_comb_temp_init(temp + i, arg->comb + i);
+
+    residues = flint_malloc(arg->comb[arg->resolution - 1].num_primes
+                                                        * sizeof(mp_limb_t));
+
+    for (k = arg->start; k < arg->n; k += arg->step)
+    {
+        size = arith_euler_number_size(k);
+        /* Use only as large a comb as needed */
+        num_primes_k = (size + prime_bits - 1) / prime_bits;
+        for (i = 0; i < arg->resolution; i++)
+        {
+            if (arg->comb[i].num_primes >= num_primes_k)
+                break;
+        }
+        num_primes_k = arg->comb[i].num_primes;
+        for (j = 0; j < num_primes_k; j++)
+            residues[j] = arg->polys[j][k / 2];
+        fmpz_multi_CRT_ui(arg->res + k, residues, arg->comb + i, temp + i, 0);
+        if (k % 4)
+            fmpz_neg(arg->res + k, arg->res + k);
+    }
+
+    flint_free(residues);
+
+    for (i = 0; i < arg->resolution; i++)
+        fmpz_comb_temp_clear(temp + i);
+}
+
+static void *
+_euler_crt_worker(void * arg_ptr)
+{
+    _euler_crt((_euler_multi_mod_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void __euler_number_vec_multi_mod(fmpz * res, slong n)
+{
+    fmpz_comb_struct comb[CRT_MAX_RESOLUTION];
+    _euler_multi_mod_arg_t * args;
+    pthread_t * threads;
+    mp_limb_t * primes;
+    mp_ptr * polys;
+    slong i, k, m, num_primes, num_threads, resolution;
     mp_bitcnt_t size, prime_bits;
 
     if (n < 1)
@@ -67,63 +164,72 @@ void __euler_number_vec_multi_mod(fmpz * res, slong n)
     num_primes = (size + prime_bits - 1) / prime_bits;
 
     primes = flint_malloc(num_primes * sizeof(mp_limb_t));
-    residues = flint_malloc(num_primes * sizeof(mp_limb_t));
     polys = flint_malloc(num_primes * sizeof(mp_ptr));
 
-    /* Compute Euler numbers mod p */
     primes[0] = n_nextprime(UWORD(1)<<prime_bits, 0);
     for (k = 1; k < num_primes; k++)
         primes[k] = n_nextprime(primes[k-1], 0);
-    temppoly = _nmod_vec_init(m);
     for (k = 0; k < num_primes; k++)
-    {
         polys[k] = _nmod_vec_init(m);
-        nmod_init(&mod, primes[k]);
-        __euler_number_vec_mod_p(polys[k], temppoly, m, mod);
+
+    num_threads = flint_get_num_threads();
+    if (n < ARITH_MULTI_MOD_THREADED_CUTOFF)
+        num_threads = 1;
+    num_threads = FLINT_MIN(num_threads, num_primes);
+
+    args = flint_malloc(num_threads * sizeof(_euler_multi_mod_arg_t));
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].res = res;
+        args[i].primes = primes;
+        args[i].polys = polys;
+        args[i].comb = comb;
+        args[i].resolution = resolution;
+        args[i].n = n;
+        args[i].m = m;
+        args[i].start = (i * num_primes) / num_threads;
+        args[i].stop = ((i + 1) * num_primes) / num_threads;
     }
 
+    /* Compute Euler numbers mod p */
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _euler_images_worker, &args[i]);
+    _euler_images(&args[0]);
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
     /* Init CRT comb */
     for (i = 0; i < resolution; i++)
-    {
-        fmpz_comb_init(comb[i], primes, num_primes * (i + 1) / resolution);
-        fmpz_comb_temp_init(temp[i], comb[i]);
-    }
+        fmpz_comb_init(comb + i, primes, num_primes * (i + 1) / resolution);
 
     /* Trivial entries */
     for (k = 1; k < n; k += 2)
         fmpz_zero(res + k);
 
-    /* Reconstruction */
-    for (k = 0; k < n; k += 2)
+    /* Reconstruction of the even entries, interleaved as the cost grows */
+    for (i = 0; i < num_threads; i++)
     {
-        size = arith_euler_number_size(k);
-        /* Use only as large a comb as needed */
-        num_primes_k = (size + prime_bits - 1) / prime_bits;
-        for (i = 0; i < resolution; i++)
-        {
-            if (comb[i]->num_primes >= num_primes_k)
-                break;
-        }
-        num_primes_k = comb[i]->num_primes;
-        for (j = 0; j < num_primes_k; j++)
-            residues[j] = polys[j][k / 2];
-        fmpz_multi_CRT_ui(res + k, residues, comb[i], temp[i], 0);
-        if (k % 4)
-            fmpz_neg(res + k, res + k);
+        args[i].start = 2 * i;
+        args[i].step = 2 * num_threads;
     }
 
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _euler_crt_worker, &args[i]);
+    _euler_crt(&args[0]);
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
     /* Cleanup */
     for (k = 0; k < num_primes; k++)
         _nmod_vec_clear(polys[k]);
-    _nmod_vec_clear(temppoly);
     for (i = 0; i < resolution; i++)
-    {
-        fmpz_comb_temp_clear(temp[i]);
-        fmpz_comb_clear(comb[i]);
-    }
+        fmpz_comb_clear(comb + i);
 
+    flint_free(args);
+    flint_free(threads);
     flint_free(primes);
-    flint_free(residues);
     flint_free(polys);
 }
 
@@ -9,7 +9,14 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
 #include <math.h>
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
 #include "arith.h"
 
 #define DOUBLE_PREC 53
@@ -381,15 +388,232 @@ sinh_cosh_divk_precomp(mpfr_t sh, mpfr_t ch, mpfr_t ex, slong k)
 }
 
 
+/* the terms k < 35 are computed from k-th roots of exp(C) */
+#define EXP_ROOT_TERMS 35
+
+/* terms in double precision are taken from the queue in chunks */
+#define DOUBLE_TERM_CHUNK 4096
+
+/*
+   Terms N0 <= k < K0 wait for exp(C), which sets ready. The others are
+   taken from k = next onwards.
+*/
+typedef struct
+{
+    slong next_root;
+    slong next;
+    int ready;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+}
+_partitions_queue_struct;
+
+typedef struct
+{
+    mpfr_ptr x;
+    mpfr_ptr exp1;
+    mpfr_srcptr C;
+    mpz_srcptr n24;
+    double Cd;
+    ulong n;
+    slong N0;
+    slong N;
+    slong K0;
+    slong K1;
+    _partitions_queue_struct * queue;
+}
+_partitions_arg_t;
+
+typedef struct
+{
+    mpfr_t acc, t1, t2, t3, t4;
+}
+_partitions_tmp_struct;
+
+/*
+   Adds the terms for a <= k < b of the series to x, using acc as the
+   accumulator. Terms with k < K1 are evaluated at the precision given
+   by partitions_prec_bound, the remaining ones in double precision.
+*/
+static void
+_partitions_sum_range(_partitions_arg_t * arg, _partitions_tmp_struct * tmp,
+                                                              slong a, slong b)
+{
+    trig_prod_t prod;
+    ulong n = arg->n;
+    slong k, prec;
+
+    for (k = a; k < b; k++)
+    {
+        trig_prod_init(prod);
+        arith_hrr_expsum_factored(prod, k, n % k);
+
+        if (prod->prefactor == 0)
+            continue;
+
+        if (k < arg->K1)
+            prec = partitions_prec_bound(n, k, arg->N);
+        else
+            prec = DOUBLE_PREC;
+
+        if (mpfr_get_prec(tmp->t1) != prec)
+        {
+            mpfr_set_prec(tmp->t1, prec);
+            mpfr_set_prec(tmp->t2, prec);
+            mpfr_set_prec(tmp->t3, prec);
+            mpfr_set_prec(tmp->t4, prec);
+        }
+
+        /* Compute A_k(n) * sqrt(3/k) * 4 / (24*n-1) */
+        prod->prefactor *= 4;
+        prod->sqrt_p *= 3;
+        prod->sqrt_q *= k;
+        eval_trig_prod(tmp->t1, prod);
+        mpfr_div_z(tmp->t1, tmp->t1, arg->n24, MPFR_RNDN);
+
+        /* Multiply by (cosh(z) - sinh(z)/z) where z = C / k */
+        if (prec <= DOUBLE_PREC)
+        {
+            double z = arg->Cd / k;
+            mpfr_mul_d(tmp->t1, tmp->t1, cosh(z) - sinh(z)/z, MPFR_RNDN);
+        }
+        else
+        {
+            mpfr_div_ui(tmp->t2, arg->C, k, MPFR_RNDN);
+
+            if (k < arg->K0)
+                sinh_cosh_divk_precomp(tmp->t3, tmp->t4, arg->exp1, k);
+            else
+                mpfr_sinh_cosh(tmp->t3, tmp->t4, tmp->t2, MPFR_RNDN);
+
+            mpfr_div(tmp->t3, tmp->t3, tmp->t2, MPFR_RNDN);
+            mpfr_sub(tmp->t2, tmp->t4, tmp->t3, MPFR_RNDN);
+            mpfr_mul(tmp->t1, tmp->t1, tmp->t2, MPFR_RNDN);
+        }
+
+        /* Add to accumulator, flushing it first if it is too short */
+        if (mpfr_get_prec(tmp->acc) < prec + 32)
+        {
+            mpfr_add(arg->x, arg->x, tmp->acc, MPFR_RNDN);
+            mpfr_set_prec(tmp->acc, prec + 32);
+            mpfr_set_ui(tmp->acc, 0, MPFR_RNDN);
+        }
+
+        mpfr_add(tmp->acc, tmp->acc, tmp->t1, MPFR_RNDN);
+        if (mpfr_get_prec(tmp->acc) > 2 * prec + 32)
+        {
+            mpfr_add(arg->x, arg->x, tmp->acc, MPFR_RNDN);
+            mpfr_set_prec(tmp->acc, prec + 32);
+            mpfr_set_ui(tmp->acc, 0, MPFR_RNDN);
+        }
+    }
+}
+
+/*
+   Sets x to a partial sum of the series. The first thread computes
+   exp(C), until which the others can only take terms k >= K0. Terms
+   are taken in order of increasing k, i.e. of decreasing cost, those
+   depending on exp(C) first once it is available. They are taken one
+   at a time while they need more than double precision and in chunks
+   after that.
+*/
+static void
+_partitions_sum(_partitions_arg_t * arg, int first)
+{
+    _partitions_queue_struct * q = arg->queue;
+    _partitions_tmp_struct tmp[1];
+    slong a, b, prec;
+
+    prec = mpfr_get_prec(arg->x);
+
+    mpfr_init2(tmp->acc, prec);
+    mpfr_init2(tmp->t1, prec);
+    mpfr_init2(tmp->t2, prec);
+    mpfr_init2(tmp->t3, prec);
+    mpfr_init2(tmp->t4, prec);
+
+    mpfr_set_ui(arg->x, 0, MPFR_RNDN);
+    mpfr_set_ui(tmp->acc, 0, MPFR_RNDN);
+
+    if (first && arg->K0 > arg->N0)
+    {
+        mpfr_exp(arg->exp1, arg->C, MPFR_RNDN);
+
+        pthread_mutex_lock(&q->mutex);
+        q->ready = 1;
+        pthread_cond_broadcast(&q->cond);
+        pthread_mutex_unlock(&q->mutex);
+    }
+
+    while (1)
+    {
+        pthread_mutex_lock(&q->mutex);
+
+        while (1)
+        {
+            if (q->ready && q->next_root < arg->K0)
+            {
+                a = q->next_root++;
+                b = a + 1;
+            }
+            else if (q->next <= arg->N)
+            {
+                a = q->next;
+                if (a < arg->K1)
+                    b = a + 1;
+                else
+                    b = FLINT_MIN(a + DOUBLE_TERM_CHUNK, arg->N + 1);
+                q->next = b;
+            }
+            else if (!q->ready)
+            {
+                pthread_cond_wait(&q->cond, &q->mutex);
+                continue;
+            }
+            else
+                a = b = 0;
+
+            break;
+        }
+
+        pthread_mutex_unlock(&q->mutex);
+
+        if (a == b)
+            break;
+
+        _partitions_sum_range(arg, tmp, a, b);
+    }
+
+    mpfr_add(arg->x, arg->x, tmp->acc, MPFR_RNDN);
+
+    mpfr_clear(tmp->acc);
+    mpfr_clear(tmp->t1);
+    mpfr_clear(tmp->t2);
+    mpfr_clear(tmp->t3);
+    mpfr_clear(tmp->t4);
+}
+
+static void *
+_partitions_sum_worker(void * arg_ptr)
+{
+    _partitions_sum((_partitions_arg_t *) arg_ptr, 0);
+
+    flint_cleanup();
+    return NULL;
+}
+
 void
 _arith_number_of_partitions_mpfr(mpfr_t x, ulong n, slong N0, slong N)
 {
-    trig_prod_t prod;
-    mpfr_t acc, C, t1, t2, t3, t4, exp1;
+    mpfr_t C, t1, t2, exp1;
+    __mpfr_struct * sums;
     mpz_t n24;
     double Cd;
-    slong k;
+    slong j, K0, K1, num_threads;
     slong prec, guard_bits;
+    pthread_t * threads;
+    _partitions_queue_struct queue[1];
+    _partitions_arg_t * args;
 #if VERBOSE
     timeit_t t0;
 #endif
@@ -406,15 +630,10 @@ _arith_number_of_partitions_mpfr(mpfr_t x, ulong n, slong N0, slong N)
     prec = FLINT_MAX(prec, DOUBLE_PREC);
 
     mpfr_set_prec(x, prec);
-    mpfr_init2(acc, prec);
     mpfr_init2(C, prec);
     mpfr_init2(t1, prec);
     mpfr_init2(t2, prec);
-    mpfr_init2(t3, prec);
-    mpfr_init2(t4, prec);
-
-    mpfr_set_ui(x, 0, MPFR_RNDN);
-    mpfr_set_ui(acc, 0, MPFR_RNDN);
+    mpfr_init2(exp1, prec);
 
     mpz_init(n24);
     flint_mpz_set_ui(n24, n);
@@ -432,79 +651,89 @@ _arith_number_of_partitions_mpfr(mpfr_t x, ulong n, slong N0, slong N)
     mpfr_div_ui(C, t1, 6, MPFR_RNDN);
     Cd = mpfr_get_d(C, MPFR_RNDN);
 
-    mpfr_init2(exp1, prec);
-    mpfr_exp(exp1, C, prec);
-
 #if VERBOSE
     timeit_stop(t0);
     flint_printf("TERM 1: %wd ms\n", t0->cpu);
 #endif
 
-    for (k = N0; k <= N; k++)
-    {
-        trig_prod_init(prod);
-        arith_hrr_expsum_factored(prod, k, n % k);
+    /* terms k < K1 need more than double precision */
+    K1 = N0;
+    if (prec > DOUBLE_PREC)
+        while (K1 <= N && partitions_prec_bound(n, K1, N) > DOUBLE_PREC)
+            K1++;
 
-        if (prod->prefactor != 0)
-        {
-            if (prec > DOUBLE_PREC)
-            {
-                prec = partitions_prec_bound(n, k, N);
+    /* MPFR caches constants such as pi, which is only safe with TLS */
+    num_threads = flint_get_num_threads();
+    if (n < ARITH_NUMBER_OF_PARTITIONS_THREADED_CUTOFF || !mpfr_buildopt_tls_p())
+        num_threads = 1;
 
-                mpfr_set_prec(t1, prec);
-                mpfr_set_prec(t2, prec);
-                mpfr_set_prec(t3, prec);
-                mpfr_set_prec(t4, prec);
-            }
+    /* terms N0 <= k < K0 use exp(C) */
+    K0 = FLINT_MAX(N0, FLINT_MIN(K1, EXP_ROOT_TERMS));
 
-            /* Compute A_k(n) * sqrt(3/k) * 4 / (24*n-1) */
-            prod->prefactor *= 4;
-            prod->sqrt_p *= 3;
-            prod->sqrt_q *= k;
-            eval_trig_prod(t1, prod);
-            mpfr_div_z(t1, t1, n24, MPFR_RNDN);
+    queue->next_root = N0;
+    queue->next = K0;
+    queue->ready = (K0 == N0);
+    pthread_mutex_init(&queue->mutex, NULL);
+    pthread_cond_init(&queue->cond, NULL);
 
-            /* Multiply by (cosh(z) - sinh(z)/z) where z = C / k */
-            if (prec <= DOUBLE_PREC)
-            {
-                double z = Cd / k;
-                mpfr_mul_d(t1, t1, cosh(z) - sinh(z)/z, MPFR_RNDN);
-            }
-            else
-            {
-                mpfr_div_ui(t2, C, k, MPFR_RNDN);
+    sums = flint_malloc(num_threads * sizeof(__mpfr_struct));
+    args = flint_malloc(num_threads * sizeof(_partitions_arg_t));
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
 
-                if (k < 35)
-                    sinh_cosh_divk_precomp(t3, t4, exp1, k);
-                else
-                    mpfr_sinh_cosh(t3, t4, t2, MPFR_RNDN);
+    for (j = 0; j < num_threads; j++)
+    {
+        if (j == 0)
+            args[j].x = x;
+        else
+        {
+            mpfr_init2(sums + j, prec);
+            args[j].x = sums + j;
+        }
 
-                mpfr_div(t3, t3, t2, MPFR_RNDN);
-                mpfr_sub(t2, t4, t3, MPFR_RNDN);
-                mpfr_mul(t1, t1, t2, MPFR_RNDN);
-            }
+        args[j].exp1 = exp1;
+        args[j].C = C;
+        args[j].n24 = n24;
+        args[j].Cd = Cd;
+        args[j].n = n;
+        args[j].N0 = N0;
+        args[j].N = N;
+        args[j].K0 = K0;
+        args[j].K1 = K1;
+        args[j].queue = queue;
+    }
 
-            /* Add to accumulator */
-            mpfr_add(acc, acc, t1, MPFR_RNDN);
-            if (mpfr_get_prec(acc) > 2 * prec + 32)
-            {
-                mpfr_add(x, x, acc, MPFR_RNDN);
-                mpfr_set_prec(acc, prec + 32);
-                mpfr_set_ui(acc, 0, MPFR_RNDN);
-            }
-        }
+    for (j = 1; j < num_threads; j++)
+        pthread_create(&threads[j], NULL, _partitions_sum_worker, &args[j]);
+
+    _partitions_sum(&args[0], 1);
+
+    for (j = 1; j < num_threads; j++)
+        pthread_join(threads[j], NULL);
+
+    for (j = 1; j < num_threads; j++)
+    {
+        mpfr_add(x, x, sums + j, MPFR_RNDN);
+        mpfr_clear(sums + j);
     }
 
-    mpfr_add(x, x, acc, MPFR_RNDN);
+    /*
+       The total error is less than 1/2, so rounding gives p(n) exactly
+       whatever the order in which the threads added their terms.
+    */
+    if (N0 == 1)
+        mpfr_rint(x, x, MPFR_RNDN);
+
+    pthread_mutex_destroy(&queue->mutex);
+    pthread_cond_destroy(&queue->cond);
+    flint_free(sums);
+    flint_free(args);
+    flint_free(threads);
 
     mpz_clear(n24);
-    mpfr_clear(acc);
     mpfr_clear(exp1);
     mpfr_clear(C);
     mpfr_clear(t1);
     mpfr_clear(t2);
-    mpfr_clear(t3);
-    mpfr_clear(t4);
 }
 
 void
@@ -38,6 +38,7 @@ int main(void)
         n = n_randint(state, 500);
 
         arith_bell_number_bsplit(b1, n);
+        flint_set_num_threads(1 + n_randint(state, 4));
         arith_bell_number_multi_mod(b2, n);
 
         if (!fmpz_equal(b1, b2))
@@ -36,6 +36,7 @@ int main(void)
     for (n = 0; n < maxn; n += (n < 50) ? + 1 : n/4)
     {
         arith_bell_number_vec_recursive(b1, n);
+        flint_set_num_threads(1 + n_randint(state, 4));
         arith_bell_number_vec_multi_mod(b2, n);
 
         if (!_fmpz_vec_equal(b1, b2, n))
@@ -0,0 +1,184 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#include <mpfr.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpq.h"
+#include "arith.h"
+#include "ulong_extras.h"
+
+#define N 1500
+
+typedef struct
+{
+    const fmpz * num;
+    const fmpz * den;
+    ulong seed;
+    int result;
+}
+lookup_arg_t;
+
+/* random single and vector lookups, checked against (num, den) */
+static void *
+lookup_worker(void * arg_ptr)
+{
+    lookup_arg_t * arg = (lookup_arg_t *) arg_ptr;
+    fmpz * num, * den;
+    fmpq_t x;
+    slong i, j, n;
+    flint_rand_t state;
+
+    flint_randinit(state);
+    flint_randseed(state, arg->seed, arg->seed + 1);
+
+    num = _fmpz_vec_init(N);
+    den = _fmpz_vec_init(N);
+    fmpq_init(x);
+
+    arg->result = 1;
+
+    for (i = 0; i < 30 && arg->result; i++)
+    {
+        n = n_randint(state, N);
+
+        if (n_randint(state, 2))
+        {
+            arith_bernoulli_number(x, n);
+
+            arg->result = fmpz_equal(fmpq_numref(x), arg->num + n)
+                       && fmpz_equal(fmpq_denref(x), arg->den + n);
+        }
+        else
+        {
+            _arith_bernoulli_number_vec(num, den, n);
+
+            for (j = 0; j < n; j++)
+                arg->result &= fmpz_equal(num + j, arg->num + j)
+                            && fmpz_equal(den + j, arg->den + j);
+        }
+    }
+
+    fmpq_clear(x);
+    _fmpz_vec_clear(num, N);
+    _fmpz_vec_clear(den, N);
+    flint_randclear(state);
+
+    flint_cleanup();
+    return NULL;
+}
+
+int main(void)
+{
+    fmpz * num, * den;
+    fmpz_t a, b;
+    slong i, iter, num_threads;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("bernoulli_cache....");
+    fflush(stdout);
+
+    num = _fmpz_vec_init(N);
+    den = _fmpz_vec_init(N);
+    fmpz_init(a);
+    fmpz_init(b);
+
+    _arith_bernoulli_number_vec_uncached(num, den, N);
+
+    for (iter = 0; iter < 5; iter++)
+    {
+        pthread_t threads[4];
+        lookup_arg_t args[4];
+
+        arith_bernoulli_cache_enable();
+
+        num_threads = 1 + n_randint(state, 4);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].num = num;
+            args[i].den = den;
+            args[i].seed = n_randtest(state);
+            pthread_create(&threads[i], NULL, lookup_worker, &args[i]);
+        }
+
+        for (i = 0; i < num_threads; i++)
+        {
+            pthread_join(threads[i], NULL);
+
+            if (!args[i].result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("iter = %wd, thread %wd\n", iter, i);
+                abort();
+            }
+        }
+
+        arith_bernoulli_cache_clear();
+
+        if (_arith_bernoulli_cache_get(a, b, 0, 1))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("cache still enabled after clear\n");
+            abort();
+        }
+    }
+
+    /* single lookups do not extend the cache */
+    arith_bernoulli_cache_enable();
+    _arith_bernoulli_number(a, b, 10);
+
+    if (_arith_bernoulli_cache_get(a, b, 10, 1))
+    {
+        flint_printf("FAIL:\n");
+        flint_printf("single lookup extended the cache\n");
+        abort();
+    }
+
+    /* the cache is cleared by flint_cleanup in this thread */
+    fmpz_zero(a);
+    fmpz_zero(b);
+
+    if (!_arith_bernoulli_cache_extend(11)
+        || !_arith_bernoulli_cache_get(a, b, 10, 1)
+        || !fmpz_equal(a, num + 10) || !fmpz_equal(b, den + 10))
+    {
+        flint_printf("FAIL:\n");
+        flint_printf("B_10 from cache\n");
+        abort();
+    }
+
+    fmpz_clear(a);
+    fmpz_clear(b);
+    _fmpz_vec_clear(num, N);
+    _fmpz_vec_clear(den, N);
+
+    FLINT_TEST_CLEANUP(state);
+
+    if (_arith_bernoulli_cache_get(a, b, 0, 1))
+    {
+        flint_printf("FAIL:\n");
+        flint_printf("cache still enabled after flint_cleanup\n");
+        abort();
+    }
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -38,6 +38,7 @@ int main()
         fmpz_init(s);
         fmpz_init(t);
 
+        flint_set_num_threads(1 + n_randint(state, 4));
         arith_euler_number_vec(r, n + 1);
 
         /* sum binomial(n,k) E_k = 0 */
@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include <mpfr.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "arith.h"
+#include "ulong_extras.h"
+
+/* Values mod 10^9 generated with Sage */
+static const ulong testdata[][2] =
+{
+  {1000000, 104673818},
+  {1000019, 995311980},
+  {10000000, 677288980},
+  {10000019, 37059200},
+  {100000000, 836637702},
+  {100000004, 166747980},
+  {0, 0},
+};
+
+int main(void)
+{
+    fmpz_t p, q;
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("number_of_partitions_threaded....");
+    fflush(stdout);    
+
+    fmpz_init(p);
+    fmpz_init(q);
+
+    for (i = 0; testdata[i][0] != 0; i++)
+    {
+        flint_set_num_threads(n_randint(state, 6) + 2);
+
+        arith_number_of_partitions(p, testdata[i][0]);
+
+        if (fmpz_fdiv_ui(p, 1000000000) != testdata[i][1])
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("p(%wd) does not agree with known value mod 10^9\n",
+                testdata[i][0]);
+            flint_printf("Computed: %wu\n", fmpz_fdiv_ui(p, 1000000000));
+            flint_printf("Expected: %wu\n", testdata[i][1]);
+            abort();
+        }
+    }
+
+    /* agrees with the single threaded evaluation */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        ulong n = ARITH_NUMBER_OF_PARTITIONS_THREADED_CUTOFF
+                + n_randint(state, 4*ARITH_NUMBER_OF_PARTITIONS_THREADED_CUTOFF);
+
+        flint_set_num_threads(1);
+        arith_number_of_partitions(p, n);
+
+        flint_set_num_threads(n_randint(state, 8) + 2);
+        arith_number_of_partitions(q, n);
+
+        if (!fmpz_equal(p, q))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu, threads = %d\n", n, flint_get_num_threads());
+            abort();
+        }
+    }
+
+    fmpz_clear(p);
+    fmpz_clear(q);
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,186 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdio.h>
+#include <string.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "bin_io.h"
+
+#if FLINT_BIN_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+static const char flint_bin_magic[8] = {'F', 'L', 'I', 'N', 'T', 'B', 'I', 'N'};
+
+#define HEADER_WORDS ((slong) ((FLINT_BIN_HEADER_BYTES - 8) / sizeof(ulong)))
+
+int flint_bin_fwrite_header(FILE * file, ulong type, const ulong * dims)
+{
+    ulong h[HEADER_WORDS];
+    slong i;
+
+    for (i = 0; i < HEADER_WORDS; i++)
+        h[i] = 0;
+
+    h[0] = FLINT_BIN_VERSION;
+    h[1] = type;
+    h[2] = FLINT_BITS;
+
+    for (i = 0; i < 4; i++)
+        h[3 + i] = dims[i];
+
+    return fwrite(flint_bin_magic, 1, 8, file) == 8
+        && flint_bin_fwrite_words(file, h, HEADER_WORDS);
+}
+
+/* checks the header h following the magic and copies out the dimensions */
+static int
+_flint_bin_check_header(ulong * dims, const ulong * h, ulong type)
+{
+    slong i;
+
+    if (h[0] != FLINT_BIN_VERSION || h[1] != type || h[2] != FLINT_BITS)
+        return 0;
+
+    for (i = 0; i < 4; i++)
+        dims[i] = h[3 + i];
+
+    return 1;
+}
+
+int flint_bin_fread_header(FILE * file, ulong type, ulong * dims)
+{
+    char magic[8];
+    ulong h[HEADER_WORDS];
+
+    if (fread(magic, 1, 8, file) != 8 || memcmp(magic, flint_bin_magic, 8)
+         || !flint_bin_fread_words(h, HEADER_WORDS, file))
+        return 0;
+
+    return _flint_bin_check_header(dims, h, type);
+}
+
+size_t flint_bin_view_header(ulong * dims, const void * buf,
+                                                      size_t size, ulong type)
+{
+    const char * b = (const char *) buf;
+
+    if (size < FLINT_BIN_HEADER_BYTES || ((size_t) b) % sizeof(ulong) != 0
+           || memcmp(b, flint_bin_magic, 8))
+        return 0;
+
+    if (!_flint_bin_check_header(dims, (const ulong *) (b + 8), type))
+        return 0;
+
+    return FLINT_BIN_HEADER_BYTES;
+}
+
+int flint_bin_fwrite_words(FILE * file, const ulong * w, slong n)
+{
+    return fwrite(w, sizeof(ulong), n, file) == (size_t) n;
+}
+
+int flint_bin_fread_words(ulong * w, slong n, FILE * file)
+{
+    return fread(w, sizeof(ulong), n, file) == (size_t) n;
+}
+
+int flint_bin_map(flint_bin_map_t map, const char * filename)
+{
+#if FLINT_BIN_MMAP
+    struct stat st;
+    void * p;
+    int fd;
+
+    map->data = NULL;
+    map->size = 0;
+    map->mapped = 0;
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return 0;
+
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        close(fd);
+        return 0;
+    }
+
+    p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (p == MAP_FAILED)
+        return 0;
+
+    map->data = (char *) p;
+    map->size = st.st_size;
+    map->mapped = 1;
+
+    return 1;
+#else
+    /* no mmap, so read the whole file into memory */
+    FILE * file;
+    long size;
+
+    map->data = NULL;
+    map->size = 0;
+    map->mapped = 0;
+
+    file = fopen(filename, "rb");
+    if (file == NULL)
+        return 0;
+
+    if (fseek(file, 0, SEEK_END) != 0 || (size = ftell(file)) <= 0
+          || fseek(file, 0, SEEK_SET) != 0)
+    {
+        fclose(file);
+        return 0;
+    }
+
+    map->data = flint_malloc(size);
+    map->size = size;
+
+    if (fread(map->data, 1, size, file) != (size_t) size)
+    {
+        flint_free(map->data);
+        map->data = NULL;
+        map->size = 0;
+        fclose(file);
+        return 0;
+    }
+
+    fclose(file);
+    return 1;
+#endif
+}
+
+void flint_bin_unmap(flint_bin_map_t map)
+{
+#if FLINT_BIN_MMAP
+    if (map->mapped)
+        munmap(map->data, map->size);
+    else
+#endif
+        flint_free(map->data);
+
+    map->data = NULL;
+    map->size = 0;
+    map->mapped = 0;
+}
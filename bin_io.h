@@ -0,0 +1,85 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BIN_IO_H
+#define BIN_IO_H
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdio.h>
+#include <stddef.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+   Binary container format. Every object starts with a header of
+   FLINT_BIN_HEADER_BYTES bytes: the eight characters "FLINTBIN", then the
+   words version, type, FLINT_BITS and four type specific dimensions,
+   padded with zeroes. The payload which follows consists of whole words,
+   so that payloads in a mapped file are suitably aligned.
+*/
+#define FLINT_BIN_VERSION 1
+
+#define FLINT_BIN_HEADER_BYTES 64
+
+#define FLINT_BIN_FMPZ_VEC 1
+#define FLINT_BIN_FMPZ_POLY 2
+#define FLINT_BIN_FMPZ_MAT 3
+#define FLINT_BIN_NMOD_POLY 4
+#define FLINT_BIN_NMOD_MAT 5
+#define FLINT_BIN_FMPZ_MPOLY 6
+
+#if !defined(_MSC_VER) && !defined(__MINGW32__) && !defined(__MINGW64__)
+#define FLINT_BIN_MMAP 1
+#else
+#define FLINT_BIN_MMAP 0
+#endif
+
+/* marks the slot of a multiprecision entry in an fmpz payload */
+#define FLINT_BIN_BIG_TAG (UWORD(1) << (FLINT_BITS - 2))
+
+typedef struct
+{
+    char * data;
+    size_t size;
+    int mapped;
+} flint_bin_map_struct;
+
+typedef flint_bin_map_struct flint_bin_map_t[1];
+
+FLINT_DLL int flint_bin_fwrite_header(FILE * file, ulong type,
+                                                          const ulong * dims);
+
+FLINT_DLL int flint_bin_fread_header(FILE * file, ulong type, ulong * dims);
+
+FLINT_DLL size_t flint_bin_view_header(ulong * dims, const void * buf,
+                                                     size_t size, ulong type);
+
+FLINT_DLL int flint_bin_fwrite_words(FILE * file, const ulong * w, slong n);
+
+FLINT_DLL int flint_bin_fread_words(ulong * w, slong n, FILE * file);
+
+FLINT_DLL int flint_bin_map(flint_bin_map_t map, const char * filename);
+
+FLINT_DLL void flint_bin_unmap(flint_bin_map_t map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
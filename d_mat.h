@@ -34,6 +34,7 @@
  extern "C" {
 #endif
 
+/* the entries block is aligned to D_MAT_ALIGN bytes */
 typedef struct
 {
     double * entries;
@@ -60,6 +61,8 @@ double d_mat_get_entry(const d_mat_t mat, slong i, slong j)
 
 /* Memory management  ********************************************************/
 
+#define D_MAT_ALIGN 64
+
 FLINT_DLL void d_mat_init(d_mat_t mat, slong rows, slong cols);
 
 FLINT_DLL void d_mat_swap(d_mat_t mat1, d_mat_t mat2);
@@ -68,6 +71,13 @@ FLINT_DLL void d_mat_set(d_mat_t mat1, const d_mat_t mat2);
 
 FLINT_DLL void d_mat_clear(d_mat_t mat);
 
+/* Windows  ******************************************************************/
+
+FLINT_DLL void d_mat_window_init(d_mat_t window, const d_mat_t mat,
+                                      slong r1, slong c1, slong r2, slong c2);
+
+FLINT_DLL void d_mat_window_clear(d_mat_t window);
+
 FLINT_DLL int d_mat_equal(const d_mat_t mat1, const d_mat_t mat2);
 
 FLINT_DLL int d_mat_approx_equal(const d_mat_t mat1, const d_mat_t mat2, double eps);
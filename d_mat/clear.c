@@ -17,7 +17,7 @@ d_mat_clear(d_mat_t mat)
 {
     if (mat->entries)
     {
-        flint_free(mat->entries);   /* Clean up array of entries */
+        flint_aligned_free(mat->entries);   /* Clean up array of entries */
         flint_free(mat->rows);  /* Clean up row array */
     }
 }
@@ -18,7 +18,9 @@ d_mat_init(d_mat_t mat, slong rows, slong cols)
     if (rows != 0 && cols != 0)       /* Allocate space for r*c small entries */
     {
         slong i;
-        mat->entries = (double *) flint_calloc(rows*cols, sizeof(double));
+        mat->entries = (double *) flint_aligned_alloc(D_MAT_ALIGN,
+                                                 rows*cols*sizeof(double));
+        _d_vec_zero(mat->entries, rows*cols);
         mat->rows = (double **) flint_malloc(rows*sizeof(double *));  /* Initialise rows */
 
         for (i = 0; i < rows; i++)
@@ -16,9 +16,9 @@ void
 d_mat_mul_classical(d_mat_t C, const d_mat_t A, const d_mat_t B)
 {
     slong ar, bc, br;
-    slong jj, kk, i, j, k, blocksize;
+    slong jj, kk, i, j, k, blocksize, stride;
     double temp;
-    d_mat_t Bt;
+    double * Bt;
 
     ar = A->r;
     br = B->r;
@@ -48,8 +48,16 @@ d_mat_mul_classical(d_mat_t C, const d_mat_t A, const d_mat_t B)
         return;
     }
 
-    d_mat_init(Bt, bc, br);
-    d_mat_transpose(Bt, B);
+    /* rows of the transpose start at aligned addresses */
+    stride = D_MAT_ALIGN / sizeof(double);
+    stride = ((br + stride - 1) / stride) * stride;
+
+    Bt = flint_aligned_alloc(D_MAT_ALIGN, sizeof(double) * stride * bc);
+
+    for (i = 0; i < br; i++)
+        for (j = 0; j < bc; j++)
+            Bt[j*stride + i] = d_mat_entry(B, i, j);
+
     d_mat_zero(C);
 
     for (jj = 0; jj < bc; jj += blocksize)
@@ -64,12 +72,12 @@ d_mat_mul_classical(d_mat_t C, const d_mat_t A, const d_mat_t B)
 
                     for (k = kk; k < FLINT_MIN(kk + blocksize, br); k++)
                     {
-                        temp += d_mat_entry(A, i, k) * d_mat_entry(Bt, j, k);
+                        temp += d_mat_entry(A, i, k) * Bt[j*stride + k];
                     }
                     d_mat_entry(C, i, j) += temp;
                 }
             }
         }
     }
-    d_mat_clear(Bt);
+    flint_aligned_free(Bt);
 }
@@ -0,0 +1,74 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "d_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i, j, k;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("window_init/clear....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        d_mat_t a, w;
+        slong r1, r2, c1, c2;
+        slong rows = n_randint(state, 50) + 1;
+        slong cols = n_randint(state, 50) + 1;
+
+        d_mat_init(a, rows, cols);
+
+        d_mat_randtest(a, state, 0, 0);
+
+        r2 = n_randint(state, rows);
+        c2 = n_randint(state, cols);
+        if (r2)
+            r1 = n_randint(state, r2);
+        else
+            r1 = 0;
+        if (c2)
+            c1 = n_randint(state, c2);
+        else
+            c1 = 0;
+
+        d_mat_window_init(w, a, r1, c1, r2, c2);
+
+        d_mat_one(w);
+
+        for (j = r1; j < r2; j++)
+        {
+            for (k = c1; k < c2; k++)
+            {
+                if (d_mat_entry(a, j, k) != (j - r1 == k - c1))
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("window does not share entries\n");
+                    abort();
+                }
+            }
+        }
+
+        d_mat_window_clear(w);
+        d_mat_clear(a);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,19 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "d_mat.h"
+
+void
+d_mat_window_clear(d_mat_t window)
+{
+    if (window->r > 0)
+        flint_free(window->rows);
+}
@@ -32,7 +32,9 @@ static char * docsin[] = {
     "../../nmod_poly/doc/nmod_poly.txt",
     "../../nmod_poly_factor/doc/nmod_poly_factor.txt",
     "../../nmod_poly_mat/doc/nmod_poly_mat.txt",
+    "../../nmod_sparse_mat/doc/nmod_sparse_mat.txt",
     "../../nmod_poly_factor/doc/nmod_poly_factor.txt",
+    "../../fmpz_mod/doc/fmpz_mod.txt",
     "../../fmpz_mod_poly/doc/fmpz_mod_poly.txt",
     "../../fmpz_mod_poly_factor/doc/fmpz_mod_poly_factor.txt",
     "../../fq/doc/fq.txt",
@@ -53,6 +55,7 @@ static char * docsin[] = {
     "../../padic/doc/padic.txt", 
     "../../padic_mat/doc/padic_mat.txt", 
     "../../padic_poly/doc/padic_poly.txt", 
+    "../../padic_lazy/doc/padic_lazy.txt",
     "../../qadic/doc/qadic.txt", 
     "../../arith/doc/arith.txt", 
     "../../aprcl/doc/aprcl.txt",
@@ -61,6 +64,8 @@ static char * docsin[] = {
     "../../doc/longlong.txt",
     "../../mpn_extras/doc/mpn_extras.txt",
     "../../doc/profiler.txt", 
+    "../../doc/bin_io.txt",
+    "../../doc/instrument.txt",
     "../../interfaces/doc/interfaces.txt",
     "../../fft/doc/fft.txt",
     "../../qsieve/doc/qsieve.txt",
@@ -86,7 +91,9 @@ static char * docsout[] = {
     "input/nmod_poly.tex",
     "input/nmod_poly_factor.tex",
     "input/nmod_poly_mat.tex",
+    "input/nmod_sparse_mat.tex",
     "input/nmod_poly_factor.tex",
+    "input/fmpz_mod.tex",
     "input/fmpz_mod_poly.tex",
     "input/fmpz_mod_poly_factor.tex",
     "input/fq.tex",
@@ -107,6 +114,7 @@ static char * docsout[] = {
     "input/padic.tex", 
     "input/padic_mat.tex", 
     "input/padic_poly.tex", 
+    "input/padic_lazy.tex",
     "input/qadic.tex", 
     "input/arith.tex", 
     "input/aprcl.tex",
@@ -115,6 +123,8 @@ static char * docsout[] = {
     "input/longlong.tex", 
     "input/mpn_extras.tex",
     "input/profiler.tex", 
+    "input/bin_io.tex",
+    "input/instrument.tex",
     "input/interfaces.tex",
     "input/fft.tex",
     "input/qsieve.tex",
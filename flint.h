@@ -92,6 +92,10 @@ FLINT_DLL void * flint_realloc(void * ptr, size_t size);
 FLINT_DLL void * flint_calloc(size_t num, size_t size);
 FLINT_DLL void flint_free(void * ptr);
 
+/* alignment must be a power of two */
+FLINT_DLL void * flint_aligned_alloc(size_t alignment, size_t size);
+FLINT_DLL void flint_aligned_free(void * ptr);
+
 typedef void (*flint_cleanup_function_t)(void);
 FLINT_DLL void flint_register_cleanup_function(flint_cleanup_function_t cleanup_function);
 FLINT_DLL void flint_cleanup(void);
@@ -295,6 +295,8 @@ FLINT_DLL int fmpz_get_mpn(mp_ptr *n, fmpz_t n_in);
 
 FLINT_DLL int fmpz_set_str(fmpz_t f, const char * str, int b);
 
+FLINT_DLL void _fmpz_set_str_dec(fmpz_t f, const char * s, slong len);
+
 FLINT_DLL void flint_mpz_init_set_readonly(mpz_t z, const fmpz_t f);
 
 FLINT_DLL void flint_mpz_clear_readonly(mpz_t z);
@@ -0,0 +1,64 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+#if FLINT64
+#define DEC_DIGITS_PER_WORD 19
+#else
+#define DEC_DIGITS_PER_WORD 9
+#endif
+
+void _fmpz_set_str_dec(fmpz_t f, const char * s, slong len)
+{
+    slong i;
+
+    while (len > 0 && *s == '0')
+    {
+        s++;
+        len--;
+    }
+
+    if (len <= DEC_DIGITS_PER_WORD)
+    {
+        ulong c = 0;
+
+        for (i = 0; i < len; i++)
+            c = 10*c + (s[i] - '0');
+
+        fmpz_set_ui(f, c);
+    }
+    else
+    {
+        __mpz_struct * z = _fmpz_promote(f);
+        unsigned char * t;
+        mp_size_t n;
+        TMP_INIT;
+
+        /* log_2(10) < 10/3 bits per digit */
+        n = (10*(ulong) len)/(3*FLINT_BITS) + 2;
+        if (z->_mp_alloc < n)
+            _mpz_realloc(z, n);
+
+        TMP_START;
+        t = (unsigned char *) TMP_ALLOC(len*sizeof(unsigned char));
+        for (i = 0; i < len; i++)
+            t[i] = s[i] - '0';
+
+        /* mpn_set_str switches to divide-and-conquer for long inputs */
+        z->_mp_size = mpn_set_str(z->_mp_d, t, len, 10);
+        TMP_END;
+
+        _fmpz_demote_val(f);
+    }
+}
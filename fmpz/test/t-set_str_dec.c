@@ -0,0 +1,97 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_str_dec....");
+    fflush(stdout);
+
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b;
+        char * str, * buf;
+        slong len, zeros, j;
+
+        fmpz_init(a);
+        fmpz_init(b);
+
+        if (n_randint(state, 10) == 0)
+            fmpz_randtest_unsigned(a, state, 20000);
+        else
+            fmpz_randtest_unsigned(a, state, 300);
+
+        /* pad with leading zeros and junk after the digits */
+        zeros = n_randint(state, 3) == 0 ? n_randint(state, 30) : 0;
+        str = fmpz_get_str(NULL, 10, a);
+        len = strlen(str);
+        buf = flint_malloc(zeros + len + 2);
+        for (j = 0; j < zeros; j++)
+            buf[j] = '0';
+        memcpy(buf + zeros, str, len);
+        buf[zeros + len] = '7';
+        buf[zeros + len + 1] = '\0';
+
+        if (n_randint(state, 2))
+            fmpz_randtest(b, state, 200);
+        _fmpz_set_str_dec(b, buf, zeros + len);
+
+        result = fmpz_equal(a, b) && (!COEFF_IS_MPZ(*b)
+                                 || fmpz_bits(b) > FLINT_BITS - 2);
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("a = "), fmpz_print(a), flint_printf("\n");
+            flint_printf("b = "), fmpz_print(b), flint_printf("\n");
+            abort();
+        }
+
+        flint_free(buf);
+        flint_free(str);
+        fmpz_clear(a);
+        fmpz_clear(b);
+    }
+
+    /* empty string and all zeros */
+    {
+        fmpz_t a;
+
+        fmpz_init_set_ui(a, 13);
+        _fmpz_set_str_dec(a, "000", 0);
+        result = fmpz_is_zero(a);
+        _fmpz_set_str_dec(a, "000", 3);
+        result = result && fmpz_is_zero(a);
+        if (!result)
+        {
+            flint_printf("FAIL (zero):\n");
+            flint_printf("a = "), fmpz_print(a), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_clear(a);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
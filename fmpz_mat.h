@@ -167,6 +167,15 @@ int fmpz_mat_print_pretty(const fmpz_mat_t mat)
 
 FLINT_DLL int fmpz_mat_fread(FILE* file, fmpz_mat_t mat);
 
+FLINT_DLL int fmpz_mat_fwrite_bin(FILE * file, const fmpz_mat_t mat);
+
+FLINT_DLL int fmpz_mat_fread_bin(FILE * file, fmpz_mat_t mat);
+
+FLINT_DLL size_t fmpz_mat_bin_view_init(fmpz_mat_t mat,
+                                              const void * buf, size_t size);
+
+FLINT_DLL void fmpz_mat_bin_view_clear(fmpz_mat_t mat);
+
 FMPZ_MAT_INLINE
 int fmpz_mat_read(fmpz_mat_t mat)
 {
@@ -464,6 +473,10 @@ FLINT_DLL void fmpz_mat_hnf_minors_transform(fmpz_mat_t H, fmpz_mat_t U, const f
 FLINT_DLL void fmpz_mat_hnf_modular(fmpz_mat_t H, const fmpz_mat_t A, const fmpz_t D);
 FLINT_DLL void fmpz_mat_hnf_modular_eldiv(fmpz_mat_t A, const fmpz_t D);
 FLINT_DLL void fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A, flint_rand_t state);
+FLINT_DLL void _fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A,
+                                       flint_rand_t state, slong num_threads);
+FLINT_DLL void fmpz_mat_hnf_pernet_stein_threaded(fmpz_mat_t H,
+                                  const fmpz_mat_t A, flint_rand_t state);
 FLINT_DLL int fmpz_mat_is_in_hnf(const fmpz_mat_t A);
 
 FLINT_DLL void fmpz_mat_snf(fmpz_mat_t S, const fmpz_mat_t A);
@@ -0,0 +1,67 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "bin_io.h"
+
+size_t fmpz_mat_bin_view_init(fmpz_mat_t mat, const void * buf, size_t size)
+{
+    ulong dims[4];
+    slong i;
+    size_t h, d;
+    fmpz * v;
+
+    mat->entries = NULL;
+    mat->rows = NULL;
+    mat->r = 0;
+    mat->c = 0;
+
+    h = flint_bin_view_header(dims, buf, size, FLINT_BIN_FMPZ_MAT);
+    if (h == 0 || dims[0] > WORD_MAX || dims[1] > WORD_MAX
+           || (dims[0] != 0 && dims[1] > WORD_MAX / dims[0]))
+        return 0;
+
+    d = _fmpz_vec_bin_view_data(&v, (const char *) buf + h, size - h,
+                                                           dims[0] * dims[1]);
+    if (d == 0)
+        return 0;
+
+    /*
+       As for a window, the entries are only reached through the rows. An
+       extra row pointer records the copied entries, if any.
+    */
+    mat->rows = flint_malloc((dims[0] + 1) * sizeof(fmpz *));
+
+    for (i = 0; i < dims[0]; i++)
+        mat->rows[i] = v + i * dims[1];
+
+    mat->rows[dims[0]] =
+        (v != (const fmpz *) ((const char *) buf + h) + 2) ? v : NULL;
+
+    mat->r = dims[0];
+    mat->c = dims[1];
+
+    return h + d;
+}
+
+void fmpz_mat_bin_view_clear(fmpz_mat_t mat)
+{
+    if (mat->rows != NULL)
+    {
+        flint_free(mat->rows[mat->r]);
+        flint_free(mat->rows);
+    }
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011  Andy Novocin
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -15,7 +16,7 @@ int
 fmpz_mat_fread(FILE* file, fmpz_mat_t mat)
 {
     slong r, c, i, j;
-    int byte_count;
+    int byte_count, contiguous;
     mpz_t t;
 
     /* first number in file should be row dimension */
@@ -65,13 +66,31 @@ fmpz_mat_fread(FILE* file, fmpz_mat_t mat)
         flint_abort();
     }
 
-    for (i = 0; i < r; i++)
+    if (r == 0 || c == 0)
+        return 1;
+
+    /* read in place only if the rows are stored in order */
+    contiguous = (mat->entries != NULL);
+    for (i = 0; i < r && contiguous; i++)
+        contiguous = (mat->rows[i] == mat->entries + i*c);
+
+    if (contiguous)
+        return _fmpz_vec_fread_bulk(file, mat->entries, r*c);
+
+    /* a window or permuted rows, read into contiguous storage and swap
+       the rows in */
     {
-        for (j = 0; j < c; j++)
-        {
-            if (!fmpz_fread(file, fmpz_mat_entry(mat, i, j)))
-                return 0;
-        }
+        fmpz * t = _fmpz_vec_init(r*c);
+        int res = _fmpz_vec_fread_bulk(file, t, r*c);
+
+        for (i = 0; i < r; i++)
+            for (j = 0; j < c; j++)
+                fmpz_swap(fmpz_mat_entry(mat, i, j), t + i*c + j);
+
+        _fmpz_vec_clear(t, r*c);
+
+        if (!res)
+            return 0;
     }
 
     /* a return value of 0 means a problem with 
@@ -0,0 +1,74 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "bin_io.h"
+
+int fmpz_mat_fread_bin(FILE * file, fmpz_mat_t mat)
+{
+    ulong dims[4];
+    slong i, j, r, c;
+    fmpz * t;
+    int res;
+
+    if (!flint_bin_fread_header(file, FLINT_BIN_FMPZ_MAT, dims)
+           || dims[0] > WORD_MAX || dims[1] > WORD_MAX
+           || (dims[0] != 0 && dims[1] > WORD_MAX / dims[0]))
+        return 0;
+
+    /* if the input is 0 by 0 then set the dimensions to r and c */
+    if (mat->r == 0 && mat->c == 0)
+    {
+        fmpz_mat_clear(mat);
+        fmpz_mat_init(mat, dims[0], dims[1]);
+    }
+    else if (mat->r != (slong) dims[0] || mat->c != (slong) dims[1])
+    {
+        flint_printf("Exception (fmpz_mat_fread_bin). \n"
+               "Dimensions are non-zero and do not match input dimensions.\n");
+        flint_abort();
+    }
+
+    r = dims[0];
+    c = dims[1];
+
+    if (r == 0 || c == 0)
+        return _fmpz_vec_fread_bin_data(file, NULL, 0);
+
+    for (i = 1; i < r; i++)
+        if (mat->rows[i] != mat->rows[0] + i * c)
+            break;
+
+    if (i == r)
+        return _fmpz_vec_fread_bin_data(file, mat->rows[0], r * c);
+
+    /* a window or permuted rows, read into contiguous storage and swap
+       the rows in */
+    t = _fmpz_vec_init(r * c);
+
+    res = _fmpz_vec_fread_bin_data(file, t, r * c);
+
+    if (res)
+    {
+        for (i = 0; i < r; i++)
+            for (j = 0; j < c; j++)
+                fmpz_swap(mat->rows[i] + j, t + i * c + j);
+    }
+
+    _fmpz_vec_clear(t, r * c);
+
+    return res;
+}
@@ -0,0 +1,54 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "bin_io.h"
+
+int fmpz_mat_fwrite_bin(FILE * file, const fmpz_mat_t mat)
+{
+    ulong dims[4] = {0, 0, 0, 0};
+    slong i, r = mat->r, c = mat->c;
+    fmpz * t;
+    int res;
+
+    dims[0] = r;
+    dims[1] = c;
+
+    if (!flint_bin_fwrite_header(file, FLINT_BIN_FMPZ_MAT, dims))
+        return 0;
+
+    if (r == 0 || c == 0)
+        return _fmpz_vec_fwrite_bin_data(file, NULL, 0);
+
+    for (i = 1; i < r; i++)
+        if (mat->rows[i] != mat->rows[0] + i * c)
+            break;
+
+    if (i == r)
+        return _fmpz_vec_fwrite_bin_data(file, mat->rows[0], r * c);
+
+    /* the rows of a window are gathered by a shallow copy */
+    t = flint_malloc(r * c * sizeof(fmpz));
+    for (i = 0; i < r; i++)
+        memcpy(t + i * c, mat->rows[i], c * sizeof(fmpz));
+
+    res = _fmpz_vec_fwrite_bin_data(file, t, r * c);
+
+    flint_free(t);
+
+    return res;
+}
@@ -48,7 +48,11 @@ fmpz_mat_hnf(fmpz_mat_t H, const fmpz_mat_t A)
 
         flint_randinit(state);
 
-        fmpz_mat_hnf_pernet_stein(H, A, state);
+        /* below this size the threads are not worth starting */
+        if (flint_get_num_threads() > 1 && m >= 40)
+            fmpz_mat_hnf_pernet_stein_threaded(H, A, state);
+        else
+            fmpz_mat_hnf_pernet_stein(H, A, state);
 
         flint_randclear(state);
     }
@@ -9,19 +9,24 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include "fmpz_mat.h"
 #include "fmpq_mat.h"
 #include "perm.h"
 
+/*
+   Computes the rational matrix x such that H1*x gives the columns of the
+   HNF of B beyond the first n, where n is the number of rows of B. This
+   does not depend on H1, so it can be done while H1 is being computed.
+*/
 static void
-add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t state)
+add_columns_solve(fmpq_mat_t x, const fmpz_mat_t B, flint_rand_t state)
 {
     int neg;
     slong i, j, n, bits;
     fmpz_t den, tmp, one;
     fmpq_t num, alpha;
     fmpz_mat_t Bu, B1, cols, k;
-    fmpq_mat_t H1_q, cols_q, x;
 
     n = B->r;
 
@@ -29,9 +34,6 @@ add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t
     fmpz_mat_init(B1, n - 1, n);
     fmpz_mat_init(cols, n, B->c - n);
     fmpz_mat_init(k, n, 1);
-    fmpq_mat_init(x, n, B->c - n);
-    fmpq_mat_init(cols_q, n, B->c - n);
-    fmpq_mat_init(H1_q, n, n);
 
     for (i = 0; i < n; i++)
         for (j = 0; j < cols->c; j++)
@@ -95,7 +97,7 @@ add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t
     if (neg)
         fmpz_neg(den, den);
 
-    for (j = 0; j < B->c - H1->c; j++)
+    for (j = 0; j < B->c - n; j++)
     {
         fmpq_zero(num);
         for (i = 0; i < n; i++)
@@ -128,6 +130,25 @@ add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t
     fmpz_clear(one);
     fmpq_clear(alpha);
 
+    fmpz_mat_clear(k);
+    fmpz_mat_clear(cols);
+    fmpz_mat_clear(Bu);
+}
+
+/* sets H = [H1 | H1*x] */
+static void
+add_columns_finish(fmpz_mat_t H, const fmpq_mat_t x, const fmpz_mat_t H1)
+{
+    slong i, j, n;
+    fmpz_mat_t cols;
+    fmpq_mat_t H1_q, cols_q;
+
+    n = H1->r;
+
+    fmpz_mat_init(cols, n, x->c);
+    fmpq_mat_init(cols_q, n, x->c);
+    fmpq_mat_init(H1_q, n, n);
+
     /* set cols = H1*x and place in position in H */
     fmpq_mat_set_fmpz_mat(H1_q, H1);
     fmpq_mat_mul(cols_q, H1_q, x);
@@ -141,16 +162,109 @@ add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t
     }
 
     fmpq_mat_clear(H1_q);
-    fmpq_mat_clear(x);
     fmpq_mat_clear(cols_q);
-    fmpz_mat_clear(k);
     fmpz_mat_clear(cols);
-    fmpz_mat_clear(Bu);
+}
+
+typedef struct
+{
+    fmpz_mat_struct * H;
+    const fmpz_mat_struct * S;
+    const slong * pivots;
+    slong num_pivots;
+    slong start;
+    slong step;
+}
+reduce_rows_arg_t;
+
+/*
+   Reduces the entries above the pivots in rows start, start + step, ...
+   of H using the rows of S, which holds a copy of the first num_pivots
+   rows of H. Each row is reduced by the rows below it in increasing order,
+   as in the serial loop of add_rows, so the rows can be handled
+   independently.
+*/
+static void
+reduce_rows(fmpz_mat_t H, const fmpz_mat_t S, const slong * pivots,
+                                   slong num_pivots, slong start, slong step)
+{
+    slong i, i2, j2;
+    fmpz_t q;
+
+    fmpz_init(q);
+
+    for (i2 = start; i2 < num_pivots; i2 += step)
+    {
+        for (i = i2 + 1; i < num_pivots; i++)
+        {
+            fmpz_fdiv_q(q, fmpz_mat_entry(H, i2, pivots[i]),
+                    fmpz_mat_entry(S, i, pivots[i]));
+            for (j2 = pivots[i]; j2 < H->c; j2++)
+            {
+                fmpz_submul(fmpz_mat_entry(H, i2, j2), q,
+                        fmpz_mat_entry(S, i, j2));
+            }
+        }
+    }
+
+    fmpz_clear(q);
+}
+
+static void *
+reduce_rows_worker(void * arg_ptr)
+{
+    reduce_rows_arg_t arg = *((reduce_rows_arg_t *) arg_ptr);
+
+    reduce_rows(arg.H, arg.S, arg.pivots, arg.num_pivots, arg.start, arg.step);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+reduce_rows_threaded(fmpz_mat_t H, const slong * pivots, slong num_pivots,
+                                                          slong num_threads)
+{
+    pthread_t * threads;
+    reduce_rows_arg_t * args;
+    fmpz_mat_t S;
+    slong i, j;
+
+    fmpz_mat_init(S, num_pivots, H->c);
+
+    for (i = 0; i < num_pivots; i++)
+        for (j = pivots[i]; j < H->c; j++)
+            fmpz_set(fmpz_mat_entry(S, i, j), fmpz_mat_entry(H, i, j));
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(reduce_rows_arg_t) * num_threads);
+
+    /* rows are dealt out cyclically, as upper rows need more work */
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].H = H;
+        args[i].S = S;
+        args[i].pivots = pivots;
+        args[i].num_pivots = num_pivots;
+        args[i].start = i;
+        args[i].step = num_threads;
+
+        pthread_create(&threads[i], NULL, reduce_rows_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+
+    fmpz_mat_clear(S);
 }
 
 /* takes input matrix H with rows 0 to start_row - 1 in HNF to a HNF matrix */
 static void
-add_rows(fmpz_mat_t H, slong start_row, slong *pivots, slong num_pivots)
+add_rows(fmpz_mat_t H, slong start_row, slong *pivots, slong num_pivots,
+                                                          slong num_threads)
 {
     slong i, i2, j, j2, new_row, row;
     fmpz_t b, d, u, v, r1d, r2d, q;
@@ -229,16 +343,24 @@ add_rows(fmpz_mat_t H, slong start_row, slong *pivots, slong num_pivots)
         }
 
         /* reduce above pivot entries */
-        for (i = 0; i < num_pivots; i++)
+        if (num_threads > 1 && num_pivots >= 32)
+        {
+            reduce_rows_threaded(H, pivots, num_pivots,
+                                     FLINT_MIN(num_threads, num_pivots / 16));
+        }
+        else
         {
-            for (i2 = 0; i2 < i; i2++)
+            for (i = 0; i < num_pivots; i++)
             {
-                fmpz_fdiv_q(q, fmpz_mat_entry(H, i2, pivots[i]),
-                        fmpz_mat_entry(H, i, pivots[i]));
-                for (j2 = pivots[i]; j2 < H->c; j2++)
+                for (i2 = 0; i2 < i; i2++)
                 {
-                    fmpz_submul(fmpz_mat_entry(H, i2, j2), q,
-                            fmpz_mat_entry(H, i, j2));
+                    fmpz_fdiv_q(q, fmpz_mat_entry(H, i2, pivots[i]),
+                            fmpz_mat_entry(H, i, pivots[i]));
+                    for (j2 = pivots[i]; j2 < H->c; j2++)
+                    {
+                        fmpz_submul(fmpz_mat_entry(H, i2, j2), q,
+                                fmpz_mat_entry(H, i, j2));
+                    }
                 }
             }
         }
@@ -253,18 +375,129 @@ add_rows(fmpz_mat_t H, slong start_row, slong *pivots, slong num_pivots)
     fmpz_clear(b);
 }
 
+typedef struct
+{
+    mp_ptr r1;
+    mp_ptr r2;
+    mp_srcptr primes;
+    slong p0;
+    slong p1;
+    const fmpz_mat_struct * B;
+    const fmpz_mat_struct * c;
+    const fmpz_mat_struct * d;
+    const fmpz * u1;
+    const fmpz * u2;
+}
+double_det_arg_t;
+
+/*
+   Sets r1[k] and r2[k] to det([B^T | c^T])/u1 and det([B^T | d^T])/u2
+   modulo primes[k] for p0 <= k < p1.
+*/
 static void
-double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
-        const fmpz_mat_t d)
+double_det_mod(mp_ptr r1, mp_ptr r2, mp_srcptr primes, slong p0, slong p1,
+        const fmpz_mat_t B, const fmpz_mat_t c, const fmpz_mat_t d,
+        const fmpz_t u1, const fmpz_t u2)
 {
-    slong i, j, n;
+    slong i, j, k, n;
     slong *P;
     mp_limb_t p, u1mod, u2mod, v1mod, v2mod;
+    nmod_mat_t Btmod;
+
+    n = B->c;
+
+    P = _perm_init(n);
+    nmod_mat_init(Btmod, n, n, 2);
+
+    for (k = p0; k < p1; k++)
+    {
+        p = primes[k];
+        u1mod = fmpz_fdiv_ui(u1, p);
+        u2mod = fmpz_fdiv_ui(u2, p);
+        _nmod_mat_set_mod(Btmod, p);
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < n - 1; j++)
+                nmod_mat_entry(Btmod, i, j) =
+                    fmpz_fdiv_ui(fmpz_mat_entry(B, j, i), p);
+            nmod_mat_entry(Btmod, i, n - 1) =
+                fmpz_fdiv_ui(fmpz_mat_entry(c, 0, i), p);
+        }
+        nmod_mat_lu(P, Btmod, 0);
+        v1mod = UWORD(1);
+        for (i = 0; i < n; i++)
+            v1mod = n_mulmod2_preinv(v1mod, nmod_mat_entry(Btmod, i, i), p,
+                    Btmod->mod.ninv);
+        if (_perm_parity(P, n) == 1)
+            v1mod = nmod_neg(v1mod, Btmod->mod);
+
+        for (i = 0; i < n; i++)
+        {
+            for (j = 0; j < n - 1; j++)
+                nmod_mat_entry(Btmod, i, j) =
+                    fmpz_fdiv_ui(fmpz_mat_entry(B, j, i), p);
+            nmod_mat_entry(Btmod, i, n - 1) =
+                fmpz_fdiv_ui(fmpz_mat_entry(d, 0, i), p);
+        }
+        nmod_mat_lu(P, Btmod, 0);
+        v2mod = UWORD(1);
+        for (i = 0; i < n; i++)
+            v2mod = n_mulmod2_preinv(v2mod, nmod_mat_entry(Btmod, i, i), p,
+                    Btmod->mod.ninv);
+        if (_perm_parity(P, n) == 1)
+            v2mod = nmod_neg(v2mod, Btmod->mod);
+
+        r1[k] = n_mulmod2_preinv(v1mod, n_invmod(u1mod, p), p,
+                Btmod->mod.ninv);
+        r2[k] = n_mulmod2_preinv(v2mod, n_invmod(u2mod, p), p,
+                Btmod->mod.ninv);
+    }
+
+    _perm_clear(P);
+    nmod_mat_clear(Btmod);
+}
+
+static void *
+double_det_mod_worker(void * arg_ptr)
+{
+    double_det_arg_t arg = *((double_det_arg_t *) arg_ptr);
+
+    double_det_mod(arg.r1, arg.r2, arg.primes, arg.p0, arg.p1,
+                   arg.B, arg.c, arg.d, arg.u1, arg.u2);
+
+    flint_cleanup();
+    return NULL;
+}
+
+typedef struct
+{
+    fmpz * det;
+    const fmpz_mat_struct * A;
+}
+det_arg_t;
+
+static void *
+det_worker(void * arg_ptr)
+{
+    det_arg_t arg = *((det_arg_t *) arg_ptr);
+
+    fmpz_mat_det(arg.det, arg.A);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
+        const fmpz_mat_t d, slong num_threads)
+{
+    slong i, j, n, num_primes, alloc;
+    mp_limb_t p;
+    mp_ptr primes, r1, r2;
     fmpz_t bound, prod, s1, s2, t, u1, u2, v1, v2;
     fmpz_mat_t dt, Bt;
     fmpq_t tmpq;
     fmpq_mat_t x;
-    nmod_mat_t Btmod;
 
     n = B->c;
 
@@ -347,60 +580,85 @@ double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
             fmpz_set(bound, s2);
         fmpz_mul_ui(bound, bound, UWORD(2));
 
+        /* choose primes not dividing u1 or u2 until their product exceeds the bound */
+        alloc = 16;
+        num_primes = 0;
+        primes = flint_malloc(sizeof(mp_limb_t) * alloc);
         fmpz_one(prod);
-        P = _perm_init(n);
-        nmod_mat_init(Btmod, n, n, 2);
         p = UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS;
-        /* compute determinants divided by u1 and u2 */
         while (fmpz_cmp(prod, bound) <= 0)
         {
             p = n_nextprime(p, 0);
-            u1mod = fmpz_fdiv_ui(u1, p);
-            u2mod = fmpz_fdiv_ui(u2, p);
-            if (!(u1mod || u2mod))
+            if (fmpz_fdiv_ui(u1, p) == 0 || fmpz_fdiv_ui(u2, p) == 0)
                 continue;
-            _nmod_mat_set_mod(Btmod, p);
-            for (i = 0; i < n; i++)
+            if (num_primes == alloc)
             {
-                for (j = 0; j < n - 1; j++)
-                    nmod_mat_entry(Btmod, i, j) =
-                        fmpz_fdiv_ui(fmpz_mat_entry(B, j, i), p);
-                nmod_mat_entry(Btmod, i, n - 1) =
-                    fmpz_fdiv_ui(fmpz_mat_entry(c, 0, i), p);
+                alloc *= 2;
+                primes = flint_realloc(primes, sizeof(mp_limb_t) * alloc);
             }
-            nmod_mat_lu(P, Btmod, 0);
-            v1mod = UWORD(1);
-            for (i = 0; i < n; i++)
-                v1mod = n_mulmod2_preinv(v1mod, nmod_mat_entry(Btmod, i, i), p,
-                        Btmod->mod.ninv);
-            if (_perm_parity(P, n) == 1)
-                v1mod = nmod_neg(v1mod, Btmod->mod);
+            primes[num_primes++] = p;
+            fmpz_mul_ui(prod, prod, p);
+        }
 
-            for (i = 0; i < n; i++)
+        r1 = flint_malloc(sizeof(mp_limb_t) * num_primes);
+        r2 = flint_malloc(sizeof(mp_limb_t) * num_primes);
+
+        /* compute determinants divided by u1 and u2 modulo each prime */
+        num_threads = FLINT_MIN(num_threads, num_primes);
+        if (num_threads <= 1)
+        {
+            double_det_mod(r1, r2, primes, 0, num_primes, B, c, d, u1, u2);
+        }
+        else
+        {
+            pthread_t * threads;
+            double_det_arg_t * args;
+
+            threads = flint_malloc(sizeof(pthread_t) * num_threads);
+            args = flint_malloc(sizeof(double_det_arg_t) * num_threads);
+
+            for (i = 0; i < num_threads; i++)
             {
-                for (j = 0; j < n - 1; j++)
-                    nmod_mat_entry(Btmod, i, j) =
-                        fmpz_fdiv_ui(fmpz_mat_entry(B, j, i), p);
-                nmod_mat_entry(Btmod, i, n - 1) =
-                    fmpz_fdiv_ui(fmpz_mat_entry(d, 0, i), p);
+                args[i].r1 = r1;
+                args[i].r2 = r2;
+                args[i].primes = primes;
+                args[i].p0 = (num_primes * i) / num_threads;
+                args[i].p1 = (num_primes * (i + 1)) / num_threads;
+                args[i].B = B;
+                args[i].c = c;
+                args[i].d = d;
+                args[i].u1 = u1;
+                args[i].u2 = u2;
+
+                pthread_create(&threads[i], NULL,
+                    double_det_mod_worker, &args[i]);
             }
-            nmod_mat_lu(P, Btmod, 0);
-            v2mod = UWORD(1);
-            for (i = 0; i < n; i++)
-                v2mod = n_mulmod2_preinv(v2mod, nmod_mat_entry(Btmod, i, i), p,
-                        Btmod->mod.ninv);
-            if (_perm_parity(P, n) == 1)
-                v2mod = nmod_neg(v2mod, Btmod->mod);
 
-            v1mod = n_mulmod2_preinv(v1mod, n_invmod(u1mod, p), p,
-                    Btmod->mod.ninv);
-            v2mod = n_mulmod2_preinv(v2mod, n_invmod(u2mod, p), p,
-                    Btmod->mod.ninv);
-            fmpz_CRT_ui(v1, v1, prod, v1mod, p, 1);
-            fmpz_CRT_ui(v2, v2, prod, v2mod, p, 1);
-            fmpz_mul_ui(prod, prod, p);
+            for (i = 0; i < num_threads; i++)
+                pthread_join(threads[i], NULL);
+
+            flint_free(threads);
+            flint_free(args);
+        }
+
+        {
+            fmpz_comb_t comb;
+            fmpz_comb_temp_t comb_temp;
+
+            fmpz_comb_init(comb, primes, num_primes);
+            fmpz_comb_temp_init(comb_temp, comb);
+
+            fmpz_multi_CRT_ui(v1, r1, comb, comb_temp, 1);
+            fmpz_multi_CRT_ui(v2, r2, comb, comb_temp, 1);
+
+            fmpz_comb_temp_clear(comb_temp);
+            fmpz_comb_clear(comb);
         }
 
+        flint_free(primes);
+        flint_free(r1);
+        flint_free(r2);
+
         fmpz_mul(d1, u1, v1);
         fmpz_mul(d2, u2, v2);
 
@@ -413,8 +671,26 @@ double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
         fmpz_clear(v1);
         fmpz_clear(v2);
         fmpz_clear(t);
-        _perm_clear(P);
-        nmod_mat_clear(Btmod);
+    }
+    else if (num_threads > 1)   /* compute both dets naively, side by side */
+    {
+        pthread_t thread;
+        det_arg_t arg;
+        fmpz_mat_t Bt2;
+
+        fmpz_mat_init_set(Bt2, Bt);
+        for (j = 0; j < n; j++)
+            fmpz_set(fmpz_mat_entry(Bt2, j, n - 1), fmpz_mat_entry(d, 0, j));
+
+        arg.det = d2;
+        arg.A = Bt2;
+        pthread_create(&thread, NULL, det_worker, &arg);
+
+        fmpz_mat_det(d1, Bt);
+
+        pthread_join(thread, NULL);
+
+        fmpz_mat_clear(Bt2);
     }
     else                        /* can't use the clever method above so naively compute both dets */
     {
@@ -429,12 +705,46 @@ double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
     fmpq_mat_clear(x);
 }
 
+/* computes the HNF of the square nonsingular matrix C with determinant g */
+static void
+hnf_minor(fmpz_mat_t H1, const fmpz_mat_t C, const fmpz_t g,
+                                       flint_rand_t state, slong num_threads)
+{
+    if (COEFF_IS_MPZ(*g) && C->r > 3)   /* if g is too big, recurse */
+        _fmpz_mat_hnf_pernet_stein(H1, C, state, num_threads);
+    else                    /* use modulo determinant algorithm to compute HNF of C */
+        fmpz_mat_hnf_modular(H1, C, g);
+}
+
+typedef struct
+{
+    fmpz_mat_struct * H1;
+    const fmpz_mat_struct * C;
+    const fmpz * g;
+    flint_rand_s * state;
+    slong num_threads;
+}
+hnf_minor_arg_t;
+
+static void *
+hnf_minor_worker(void * arg_ptr)
+{
+    hnf_minor_arg_t arg = *((hnf_minor_arg_t *) arg_ptr);
+
+    hnf_minor(arg.H1, arg.C, arg.g, arg.state, arg.num_threads);
+
+    flint_cleanup();
+    return NULL;
+}
+
 void
-fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A, flint_rand_t state)
+_fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A,
+                                       flint_rand_t state, slong num_threads)
 {
     slong i, j, m, n, p, r, *P, *pivots, finished;
     fmpz_t d1, d2, g, s, t;
     fmpz_mat_t c, d, B, C, H1, H2, H3;
+    fmpq_mat_t x;
     nmod_mat_t Amod;
 
     m = fmpz_mat_nrows(A);
@@ -530,7 +840,7 @@ fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A, flint_rand_t state)
             fmpz_init(d1);
             fmpz_init(d2);
 
-            double_det(d1, d2, B, c, d);
+            double_det(d1, d2, B, c, d, num_threads);
             fmpz_xgcd(g, s, t, d1, d2);
 
             for (j = 0; j < r - 1; j++)
@@ -549,11 +859,6 @@ fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A, flint_rand_t state)
         {
             fmpz_mat_init(H1, r - 1, r - 1);
 
-            if (COEFF_IS_MPZ(*g) && C->r > 3)   /* if g is too big, recurse */
-                fmpz_mat_hnf_pernet_stein(H1, C, state);
-            else                    /* use modulo determinant algorithm to compute HNF of C */
-                fmpz_mat_hnf_modular(H1, C, g);
-
             fmpz_mat_clear(B);
             fmpz_mat_init(B, r - 1, n);
 
@@ -570,8 +875,39 @@ fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A, flint_rand_t state)
 
             fmpz_mat_init(H2, r - 1, n);
             fmpz_mat_init(H3, m + 1, n);
+            fmpq_mat_init(x, r - 1, n - r + 1);
+
+            /* the HNF of C and the solve for the remaining columns are independent */
+            if (num_threads > 1)
+            {
+                pthread_t thread;
+                hnf_minor_arg_t arg;
+                flint_rand_t state2;
+
+                flint_randinit(state2);
+                flint_randseed(state2, n_randlimb(state), n_randlimb(state));
+
+                arg.H1 = H1;
+                arg.C = C;
+                arg.g = g;
+                arg.state = state2;
+                arg.num_threads = num_threads - 1;
+                pthread_create(&thread, NULL, hnf_minor_worker, &arg);
+
+                add_columns_solve(x, B, state);
 
-            add_columns(H2, B, H1, state);
+                pthread_join(thread, NULL);
+
+                flint_randclear(state2);
+            }
+            else
+            {
+                hnf_minor(H1, C, g, state, 1);
+                add_columns_solve(x, B, state);
+            }
+
+            add_columns_finish(H2, x, H1);
+            fmpq_mat_clear(x);
 
             for (i = 0; i < r - 1; i++)
                 for (j = 0; j < n; j++)
@@ -595,7 +931,7 @@ fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A, flint_rand_t state)
             if (i == r - 1)
             {
                 /* add final rows in */
-                add_rows(H3, r - 1, pivots, r - 1);
+                add_rows(H3, r - 1, pivots, r - 1, num_threads);
 
                 /* fill H with HNF */
                 for (i = 0; i < m; i++)
@@ -632,3 +968,8 @@ fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A, flint_rand_t state)
     _perm_clear(pivots);
 }
 
+void
+fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A, flint_rand_t state)
+{
+    _fmpz_mat_hnf_pernet_stein(H, A, state, 1);
+}
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2010,2011 Fredrik Johansson
     Copyright (C) 2016 Aaditya Thakkar
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -11,6 +12,7 @@
 */
 
 #include "fmpz_mat.h"
+#include "instrument.h"
 
 void
 fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
@@ -37,9 +39,11 @@ fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
     {
         /* The inline version only benefits from large n */
         if (n <= 2)
-            fmpz_mat_mul_classical(C, A, B);
+            FLINT_INSTR(FLINT_INSTR_FMPZ_MAT_MUL_CLASSICAL, dim, 0,
+                fmpz_mat_mul_classical(C, A, B));
         else
-            fmpz_mat_mul_classical_inline(C, A, B);
+            FLINT_INSTR(FLINT_INSTR_FMPZ_MAT_MUL_CLASSICAL_INLINE, dim, 0,
+                fmpz_mat_mul_classical_inline(C, A, B));
     }
     else
     {
@@ -57,23 +61,27 @@ fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
         {
             if ((ab + bb) * dim < 17000)
             {
-                fmpz_mat_mul_classical_inline(C, A, B);
+                FLINT_INSTR(FLINT_INSTR_FMPZ_MAT_MUL_CLASSICAL_INLINE,
+                    dim, ab + bb, fmpz_mat_mul_classical_inline(C, A, B));
             }
             else
             {
                 if (dim > 75 && (ab + bb) > 650)
                 {
-                    _fmpz_mat_mul_multi_mod(C, A, B, bits);
+                    FLINT_INSTR(FLINT_INSTR_FMPZ_MAT_MUL_MULTI_MOD,
+                        dim, ab + bb, _fmpz_mat_mul_multi_mod(C, A, B, bits));
                 }
                 else
                 {
-                    fmpz_mat_mul_strassen(C, A, B);
+                    FLINT_INSTR(FLINT_INSTR_FMPZ_MAT_MUL_STRASSEN,
+                        dim, ab + bb, fmpz_mat_mul_strassen(C, A, B));
                 }
             }
         }
         else
         {
-            _fmpz_mat_mul_multi_mod(C, A, B, bits);
+            FLINT_INSTR(FLINT_INSTR_FMPZ_MAT_MUL_MULTI_MOD,
+                dim, ab + bb, _fmpz_mat_mul_multi_mod(C, A, B, bits));
         }
     }
 }
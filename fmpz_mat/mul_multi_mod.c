@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -10,6 +11,7 @@
 */
 
 #include "fmpz_mat.h"
+#include "instrument.h"
 
 void
 _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B,
@@ -42,6 +44,9 @@ _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B,
         num_primes = (bits + primes_bits - 1) / primes_bits;
     }
 
+    FLINT_INSTR_COUNT(FLINT_INSTR_FMPZ_MAT_MUL_MULTI_MOD_PRIMES,
+                                     num_primes, num_primes*primes_bits, 0);
+
     /* Initialize */
     primes = flint_malloc(sizeof(mp_limb_t) * num_primes);
     primes[0] = n_nextprime(UWORD(1) << primes_bits, 0);
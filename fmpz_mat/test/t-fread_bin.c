@@ -0,0 +1,103 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("fread_bin....");
+#if !defined( _MSC_VER )
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_mat_t A, B, D, W;
+        slong r, c, r1, c1, s1, s2;
+        FILE * f = fopen("fmpz_mat_fread_bin_test", "wb");
+
+        if (!f)
+        {
+            flint_printf("Error: unable to open file for writing.\n");
+            abort();
+        }
+
+        r = n_randint(state, 20);
+        c = n_randint(state, 20);
+        fmpz_mat_init(A, r, c);
+        fmpz_mat_randtest(A, state, n_randint(state, 200) + 1);
+
+        result = fmpz_mat_fwrite_bin(f, A) && fmpz_mat_fwrite_bin(f, A);
+        fclose(f);
+
+        /* read into a window of a larger matrix */
+        r1 = n_randint(state, 5);
+        c1 = n_randint(state, 5);
+        fmpz_mat_init(D, r + r1 + n_randint(state, 5),
+                         c + c1 + n_randint(state, 5));
+        fmpz_mat_randtest(D, state, 10);
+        fmpz_mat_window_init(W, D, r1, c1, r1 + r, c1 + c);
+
+        /* read into a matrix with permuted rows */
+        fmpz_mat_init(B, r, c);
+        fmpz_mat_randtest(B, state, 10);
+        if (r != 0 && c != 0)
+        {
+            s1 = n_randint(state, r);
+            s2 = n_randint(state, r);
+            fmpz_mat_swap_rows(B, NULL, s1, s2);
+            fmpz_mat_swap_rows(B, NULL, 0, r - 1);
+        }
+
+        f = fopen("fmpz_mat_fread_bin_test", "rb");
+        result = result && fmpz_mat_fread_bin(f, W) && fmpz_mat_equal(W, A);
+        result = result && fmpz_mat_fread_bin(f, B) && fmpz_mat_equal(B, A);
+        fclose(f);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            fmpz_mat_print(A), flint_printf("\n\n");
+            fmpz_mat_print(W), flint_printf("\n\n");
+            fmpz_mat_print(B), flint_printf("\n\n");
+            remove("fmpz_mat_fread_bin_test");
+            abort();
+        }
+
+        if (remove("fmpz_mat_fread_bin_test"))
+        {
+            flint_printf("Error, unable to delete file fmpz_mat_fread_bin_test\n");
+            abort();
+        }
+
+        fmpz_mat_window_clear(W);
+        fmpz_mat_clear(D);
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+#else
+    flint_printf("SKIPPED\n");
+#endif
+    return 0;
+}
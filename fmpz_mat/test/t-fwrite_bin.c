@@ -0,0 +1,103 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "bin_io.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("fwrite_bin....");
+#if !defined( _MSC_VER )
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_mat_t A, W, B, C;
+        slong r, c, r1, c1, r2, c2;
+        flint_bin_map_t map;
+        size_t s = 0;
+        FILE * f = fopen("fmpz_mat_bin_test", "wb");
+
+        if (!f)
+        {
+            flint_printf("Error: unable to open file for writing.\n");
+            abort();
+        }
+
+        r = n_randint(state, 20);
+        c = n_randint(state, 20);
+        fmpz_mat_init(A, r, c);
+        fmpz_mat_randtest(A, state, n_randint(state, 200) + 1);
+
+        /* write a window, whose rows are not contiguous */
+        r1 = n_randint(state, r + 1);
+        r2 = r1 + n_randint(state, r - r1 + 1);
+        c1 = n_randint(state, c + 1);
+        c2 = c1 + n_randint(state, c - c1 + 1);
+        fmpz_mat_window_init(W, A, r1, c1, r2, c2);
+
+        result = fmpz_mat_fwrite_bin(f, W);
+        fclose(f);
+
+        fmpz_mat_init(B, 0, 0);
+        f = fopen("fmpz_mat_bin_test", "rb");
+        result = result && fmpz_mat_fread_bin(f, B) && fmpz_mat_equal(W, B);
+        fclose(f);
+
+        if (result && flint_bin_map(map, "fmpz_mat_bin_test"))
+        {
+            s = fmpz_mat_bin_view_init(C, map->data, map->size);
+            result = (s == map->size && fmpz_mat_equal(W, C));
+            fmpz_mat_bin_view_clear(C);
+
+            flint_bin_unmap(map);
+        } else
+            result = 0;
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("s = %wu\n", (ulong) s);
+            fmpz_mat_print(W), flint_printf("\n\n");
+            fmpz_mat_print(B), flint_printf("\n\n");
+            remove("fmpz_mat_bin_test");
+            abort();
+        }
+
+        if (remove("fmpz_mat_bin_test"))
+        {
+            flint_printf("Error, unable to delete file fmpz_mat_bin_test\n");
+            abort();
+        }
+
+        fmpz_mat_window_clear(W);
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+#else
+    flint_printf("SKIPPED\n");
+#endif
+    return 0;
+}
@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("hnf_pernet_stein_threaded....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 20 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A, H, H2;
+        slong m, n, r, b, d;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        if (iter % 4 == 0)
+        {
+            n = 30 + n_randint(state, 20);
+            m = 30 + n_randint(state, 20);
+        }
+        else
+        {
+            n = 1 + n_randint(state, 10);
+            m = 1 + n_randint(state, 10);
+        }
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(H, m, n);
+        fmpz_mat_init(H2, m, n);
+
+        b = 1 + n_randint(state, 10) * n_randint(state, 10);
+        d = n_randint(state, 2*m*n + 1);
+
+        if (n_randint(state, 2))
+        {
+            /* sparse */
+            fmpz_mat_randrank(A, state, r, b);
+
+            /* dense */
+            if (n_randint(state, 2))
+                fmpz_mat_randops(A, state, d);
+        }
+        else
+            fmpz_mat_randtest(A, state, b);
+
+        fmpz_mat_hnf_pernet_stein_threaded(H, A, state);
+
+        if (!fmpz_mat_is_in_hnf(H))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("matrix not in hnf!\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(H); flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_mat_hnf_pernet_stein(H2, A, state);
+
+        if (!fmpz_mat_equal(H, H2))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("threaded and serial hnfs should be the same!\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(H); flint_printf("\n\n");
+            fmpz_mat_print_pretty(H2); flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_mat_clear(H2);
+        fmpz_mat_clear(H);
+        fmpz_mat_clear(A);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
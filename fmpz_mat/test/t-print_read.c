@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Andy Novocin
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -116,7 +117,14 @@ int main(void)
 
             for (i = 0; i < k && !feof(in); i++)
             {
-                fmpz_mat_init(t, 0, 0);
+                /* sometimes read into a matrix with permuted rows */
+                if (M[i]->r >= 2 && M[i]->c != 0 && n_randint(state, 2))
+                {
+                    fmpz_mat_init(t, M[i]->r, M[i]->c);
+                    fmpz_mat_swap_rows(t, NULL, 0, M[i]->r - 1);
+                }
+                else
+                    fmpz_mat_init(t, 0, 0);
 
                 r = fmpz_mat_fread(in, t);
                 if (r <= 0)
@@ -0,0 +1,139 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef FMPZ_MOD_H
+#define FMPZ_MOD_H
+
+#ifdef FMPZ_MOD_INLINES_C
+#define FMPZ_MOD_INLINE FLINT_DLL
+#else
+#define FMPZ_MOD_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdio.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "nmod_vec.h"
+#include "fmpz.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* largest modulus, in limbs, with a fixed size multiplication kernel */
+#define FMPZ_MOD_MPN_MAX 4
+
+/*
+   A modulus n >= 1 together with precomputed data for reduction. If n fits
+   in a limb, mod holds the usual single limb precomputed inverse. Otherwise
+   d is n shifted left by norm bits so that its top bit is set, dinv is the
+   inverse computed by flint_mpn_preinvn for the size limbs of d and dinv1
+   is the precomputed inverse of the top limb of d.
+*/
+typedef struct
+{
+    fmpz n[1];
+    mp_size_t size;
+    mp_bitcnt_t norm;
+    nmod_t mod;
+    mp_ptr d;
+    mp_ptr dinv;
+    mp_limb_t dinv1;
+} fmpz_mod_ctx_struct;
+
+typedef fmpz_mod_ctx_struct fmpz_mod_ctx_t[1];
+
+/*  Context ******************************************************************/
+
+FLINT_DLL void fmpz_mod_ctx_init(fmpz_mod_ctx_t ctx, const fmpz_t n);
+
+FLINT_DLL void fmpz_mod_ctx_clear(fmpz_mod_ctx_t ctx);
+
+FMPZ_MOD_INLINE
+const fmpz * fmpz_mod_ctx_modulus(const fmpz_mod_ctx_t ctx)
+{
+    return ctx->n;
+}
+
+/*  Limb access **************************************************************/
+
+FLINT_DLL void _fmpz_mod_get_limbs(mp_ptr x, const fmpz_t a, mp_size_t n);
+
+FLINT_DLL void _fmpz_mod_set_limbs(fmpz_t a, mp_srcptr x, mp_size_t n);
+
+/*  Arithmetic ***************************************************************/
+
+FMPZ_MOD_INLINE
+int fmpz_mod_is_canonical(const fmpz_t a, const fmpz_mod_ctx_t ctx)
+{
+    return fmpz_sgn(a) >= 0 && fmpz_cmp(a, ctx->n) < 0;
+}
+
+FLINT_DLL void fmpz_mod_set_fmpz(fmpz_t a, const fmpz_t b,
+                                               const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_add(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                               const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_sub(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                               const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_neg(fmpz_t a, const fmpz_t b,
+                                               const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_mpn_mul2(mp_ptr r, mp_srcptr a, mp_srcptr b,
+                                               const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_mpn_mul3(mp_ptr r, mp_srcptr a, mp_srcptr b,
+                                               const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_mpn_mul4(mp_ptr r, mp_srcptr a, mp_srcptr b,
+                                               const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_mpn_mul(mp_ptr r, mp_srcptr a, mp_srcptr b,
+                                               const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_mpn_mod2(mp_ptr r, mp_srcptr a, mp_size_t m,
+                                               const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_mpn_mod3(mp_ptr r, mp_srcptr a, mp_size_t m,
+                                               const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_mpn_mod4(mp_ptr r, mp_srcptr a, mp_size_t m,
+                                               const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_mpn_mod(mp_ptr r, mp_srcptr a, mp_size_t m,
+                                               const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_mul(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                               const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL int fmpz_mod_inv(fmpz_t a, const fmpz_t b,
+                                               const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_pow_fmpz(fmpz_t a, const fmpz_t b, const fmpz_t e,
+                                               const fmpz_mod_ctx_t ctx);
+
+/*  Vectors ******************************************************************/
+
+FLINT_DLL void _fmpz_mod_vec_set_fmpz_vec(fmpz * A, const fmpz * B, slong len,
+                                               const fmpz_mod_ctx_t ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
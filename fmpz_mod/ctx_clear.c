@@ -0,0 +1,24 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz_mod.h"
+
+void fmpz_mod_ctx_clear(fmpz_mod_ctx_t ctx)
+{
+    fmpz_clear(ctx->n);
+
+    if (ctx->d != NULL)
+        flint_free(ctx->d);
+}
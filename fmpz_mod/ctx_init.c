@@ -0,0 +1,60 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "longlong.h"
+#include "mpn_extras.h"
+#include "fmpz_mod.h"
+
+void fmpz_mod_ctx_init(fmpz_mod_ctx_t ctx, const fmpz_t n)
+{
+    if (fmpz_sgn(n) <= 0)
+    {
+        flint_printf("Exception (fmpz_mod_ctx_init). Modulus is not positive.\n");
+        flint_abort();
+    }
+
+    fmpz_init_set(ctx->n, n);
+
+    if (fmpz_abs_fits_ui(n))
+    {
+        ctx->size = 1;
+        ctx->norm = 0;
+        nmod_init(&ctx->mod, fmpz_get_ui(n));
+        ctx->d = NULL;
+        ctx->dinv = NULL;
+        ctx->dinv1 = 0;
+    }
+    else
+    {
+        __mpz_struct * m = COEFF_TO_PTR(*n);
+        mp_size_t s = m->_mp_size;
+        ulong norm;
+
+        count_leading_zeros(norm, m->_mp_d[s - 1]);
+
+        ctx->size = s;
+        ctx->norm = norm;
+        nmod_init(&ctx->mod, 1);
+        ctx->d = flint_malloc(2*s*sizeof(mp_limb_t));
+        ctx->dinv = ctx->d + s;
+
+        if (ctx->norm)
+            mpn_lshift(ctx->d, m->_mp_d, s, ctx->norm);
+        else
+            flint_mpn_copyi(ctx->d, m->_mp_d, s);
+
+        flint_mpn_preinvn(ctx->dinv, ctx->d, s);
+        ctx->dinv1 = n_preinvert_limb(ctx->d[s - 1]);
+    }
+}
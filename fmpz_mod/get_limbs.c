@@ -0,0 +1,35 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz_mod.h"
+
+void _fmpz_mod_get_limbs(mp_ptr x, const fmpz_t a, mp_size_t n)
+{
+    fmpz c = *a;
+
+    if (!COEFF_IS_MPZ(c))
+    {
+        x[0] = c;
+        flint_mpn_zero(x + 1, n - 1);
+    }
+    else
+    {
+        __mpz_struct * m = COEFF_TO_PTR(c);
+        mp_size_t s = m->_mp_size;
+
+        flint_mpn_copyi(x, m->_mp_d, s);
+        flint_mpn_zero(x + s, n - s);
+    }
+}
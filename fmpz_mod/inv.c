@@ -0,0 +1,37 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz_mod.h"
+
+int fmpz_mod_inv(fmpz_t a, const fmpz_t b, const fmpz_mod_ctx_t ctx)
+{
+    if (ctx->size == 1)
+    {
+        mp_limb_t g, r;
+
+        if (ctx->mod.n == 1)
+        {
+            fmpz_zero(a);
+            return 1;
+        }
+
+        g = n_gcdinv(&r, fmpz_get_ui(b), ctx->mod.n);
+        fmpz_set_ui(a, r);
+
+        return g == 1;
+    }
+    else
+        return fmpz_invmod(a, b, ctx->n);
+}
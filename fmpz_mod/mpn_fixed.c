@@ -0,0 +1,267 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "longlong.h"
+#include "mpn_extras.h"
+#include "fmpz_mod.h"
+
+/*
+   Helpers for operands of n limbs, where n is a small compile time constant
+   after inlining, so that the loops are fully unrolled.
+*/
+
+#if defined(__GNUC__)
+#define FIXED_INLINE static __inline__ __attribute__((always_inline))
+#else
+#define FIXED_INLINE static __inline__
+#endif
+
+/* t = a*b, 2n limbs */
+FIXED_INLINE void
+_mul_basecase(mp_ptr t, mp_srcptr a, mp_srcptr b, mp_size_t n)
+{
+    mp_limb_t hi, lo, cy;
+    mp_size_t i, j;
+
+    for (i = 0; i < n; i++)
+        t[i] = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        cy = 0;
+
+        for (j = 0; j < n; j++)
+        {
+            umul_ppmm(hi, lo, a[i], b[j]);
+            add_ssaaaa(hi, lo, hi, lo, 0, cy);
+            add_ssaaaa(hi, lo, hi, lo, 0, t[i + j]);
+            t[i + j] = lo;
+            cy = hi;
+        }
+
+        t[i + n] = cy;
+    }
+}
+
+/* r = r - d, returns the borrow */
+FIXED_INLINE mp_limb_t
+_sub_n(mp_ptr r, mp_srcptr d, mp_size_t n)
+{
+    mp_limb_t x, y, bw = 0;
+    mp_size_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        x = r[i];
+        y = d[i];
+        r[i] = x - y - bw;
+        bw = (x < y) | ((x == y) & bw);
+    }
+
+    return bw;
+}
+
+/* r = r + d, returns the carry */
+FIXED_INLINE mp_limb_t
+_add_n(mp_ptr r, mp_srcptr d, mp_size_t n)
+{
+    mp_limb_t x, cy = 0;
+    mp_size_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        x = r[i] + cy;
+        cy = (x < cy);
+        r[i] = x + d[i];
+        cy += (r[i] < x);
+    }
+
+    return cy;
+}
+
+FIXED_INLINE int
+_cmp_n(mp_srcptr a, mp_srcptr b, mp_size_t n)
+{
+    mp_size_t i;
+
+    for (i = n - 1; i >= 0; i--)
+    {
+        if (a[i] != b[i])
+            return a[i] > b[i] ? 1 : -1;
+    }
+
+    return 0;
+}
+
+/*
+   Given u[0, n] less than B*d, where d is the normalised modulus, replaces
+   u by u mod d, so that u[n] becomes zero. The quotient limb is estimated
+   from the top two limbs of u and the precomputed inverse of the top limb
+   of d; the estimate is at most two too large and is corrected by adding
+   back d.
+*/
+FIXED_INLINE void
+_divrem_step(mp_ptr u, const fmpz_mod_ctx_t ctx, mp_size_t n)
+{
+    mp_srcptr d = ctx->d;
+    mp_limb_t q, r, hi, lo, cy, top;
+    mp_size_t j;
+
+    if (u[n] >= d[n - 1])
+        q = ~UWORD(0);
+    else
+    {
+        udiv_qrnnd_preinv(q, r, u[n], u[n - 1], d[n - 1], ctx->dinv1);
+        (void) r;
+    }
+
+    cy = 0;
+    for (j = 0; j < n; j++)
+    {
+        umul_ppmm(hi, lo, q, d[j]);
+        add_ssaaaa(hi, lo, hi, lo, 0, cy);
+        cy = hi + (u[j] < lo);
+        u[j] -= lo;
+    }
+
+    top = u[n] - cy;
+
+    if (u[n] < cy)
+    {
+        do
+            top += _add_n(u, d, n);
+        while (top != 0);
+    }
+
+    u[n] = 0;
+}
+
+FIXED_INLINE void
+_rshift_fixed(mp_ptr r, mp_bitcnt_t norm, mp_size_t n)
+{
+    mp_size_t i;
+
+    for (i = 0; i < n - 1; i++)
+        r[i] = (r[i] >> norm) | (r[i + 1] << (FLINT_BITS - norm));
+    r[n - 1] >>= norm;
+}
+
+/*
+   Sets r to a*b mod n where a, b < n have n limbs. The product is shifted
+   by norm bits so that it can be reduced by the normalised d a limb at a
+   time, then the remainder is shifted back.
+*/
+FIXED_INLINE void
+_mpn_mulmod_fixed(mp_ptr r, mp_srcptr a, mp_srcptr b,
+                  const fmpz_mod_ctx_t ctx, mp_size_t n)
+{
+    mp_limb_t t[2*FMPZ_MOD_MPN_MAX];
+    mp_bitcnt_t norm = ctx->norm;
+    mp_size_t i;
+
+    _mul_basecase(t, a, b, n);
+
+    if (norm)
+    {
+        for (i = 2*n - 1; i > 0; i--)
+            t[i] = (t[i] << norm) | (t[i - 1] >> (FLINT_BITS - norm));
+        t[0] <<= norm;
+    }
+
+    /* the top n limbs are already less than d */
+    for (i = n - 1; i >= 0; i--)
+        _divrem_step(t + i, ctx, n);
+
+    for (i = 0; i < n; i++)
+        r[i] = t[i];
+
+    if (norm)
+        _rshift_fixed(r, norm, n);
+}
+
+/*
+   Sets r to a mod n where a has m >= n limbs. The value of a shifted by
+   norm bits is reduced from the top, bringing in one limb at each step.
+*/
+FIXED_INLINE void
+_mpn_mod_fixed(mp_ptr r, mp_srcptr a, mp_size_t m,
+               const fmpz_mod_ctx_t ctx, mp_size_t n)
+{
+    mp_limb_t buf[4*FMPZ_MOD_MPN_MAX];
+    mp_bitcnt_t norm = ctx->norm;
+    mp_ptr t;
+    mp_size_t i;
+    TMP_INIT;
+
+    TMP_START;
+    t = (m < 4*FMPZ_MOD_MPN_MAX) ? buf : TMP_ALLOC((m + 1)*sizeof(mp_limb_t));
+
+    if (norm)
+        t[m] = mpn_lshift(t, a, m, norm);
+    else
+    {
+        flint_mpn_copyi(t, a, m);
+        t[m] = 0;
+    }
+
+    if (_cmp_n(t + m + 1 - n, ctx->d, n) >= 0)
+        _sub_n(t + m + 1 - n, ctx->d, n);
+
+    for (i = m - n; i >= 0; i--)
+        _divrem_step(t + i, ctx, n);
+
+    for (i = 0; i < n; i++)
+        r[i] = t[i];
+
+    if (norm)
+        _rshift_fixed(r, norm, n);
+
+    TMP_END;
+}
+
+void _fmpz_mod_mpn_mul2(mp_ptr r, mp_srcptr a, mp_srcptr b,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    _mpn_mulmod_fixed(r, a, b, ctx, 2);
+}
+
+void _fmpz_mod_mpn_mul3(mp_ptr r, mp_srcptr a, mp_srcptr b,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    _mpn_mulmod_fixed(r, a, b, ctx, 3);
+}
+
+void _fmpz_mod_mpn_mul4(mp_ptr r, mp_srcptr a, mp_srcptr b,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    _mpn_mulmod_fixed(r, a, b, ctx, 4);
+}
+
+void _fmpz_mod_mpn_mod2(mp_ptr r, mp_srcptr a, mp_size_t m,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    _mpn_mod_fixed(r, a, m, ctx, 2);
+}
+
+void _fmpz_mod_mpn_mod3(mp_ptr r, mp_srcptr a, mp_size_t m,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    _mpn_mod_fixed(r, a, m, ctx, 3);
+}
+
+void _fmpz_mod_mpn_mod4(mp_ptr r, mp_srcptr a, mp_size_t m,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    _mpn_mod_fixed(r, a, m, ctx, 4);
+}
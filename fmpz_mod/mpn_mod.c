@@ -0,0 +1,59 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz_mod.h"
+
+void _fmpz_mod_mpn_mod(mp_ptr r, mp_srcptr a, mp_size_t m,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t n = ctx->size;
+    mp_ptr t;
+    TMP_INIT;
+
+    switch (n)
+    {
+        case 2:
+            _fmpz_mod_mpn_mod2(r, a, m, ctx);
+            return;
+        case 3:
+            _fmpz_mod_mpn_mod3(r, a, m, ctx);
+            return;
+        case 4:
+            _fmpz_mod_mpn_mod4(r, a, m, ctx);
+            return;
+    }
+
+    TMP_START;
+    t = TMP_ALLOC((m + 1)*sizeof(mp_limb_t));
+
+    if (ctx->norm)
+        t[m] = mpn_lshift(t, a, m, ctx->norm);
+    else
+    {
+        flint_mpn_copyi(t, a, m);
+        t[m] = 0;
+    }
+
+    m += (t[m] != 0);
+
+    flint_mpn_mod_preinvn(t, t, m, ctx->d, n, ctx->dinv);
+
+    if (ctx->norm)
+        mpn_rshift(r, t, n, ctx->norm);
+    else
+        flint_mpn_copyi(r, t, n);
+
+    TMP_END;
+}
@@ -0,0 +1,70 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz_mod.h"
+
+void fmpz_mod_mul(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t n = ctx->size;
+
+    if (n == 1)
+    {
+        fmpz_set_ui(a, nmod_mul(fmpz_get_ui(b), fmpz_get_ui(c), ctx->mod));
+    }
+    else if (n <= FMPZ_MOD_MPN_MAX)
+    {
+        mp_limb_t x[FMPZ_MOD_MPN_MAX], y[FMPZ_MOD_MPN_MAX];
+
+        _fmpz_mod_get_limbs(x, b, n);
+
+        if (b == c)
+        {
+            _fmpz_mod_mpn_mul(x, x, x, ctx);
+        }
+        else
+        {
+            _fmpz_mod_get_limbs(y, c, n);
+            _fmpz_mod_mpn_mul(x, x, y, ctx);
+        }
+
+        _fmpz_mod_set_limbs(a, x, n);
+    }
+    else
+    {
+        mp_ptr x, y;
+        TMP_INIT;
+
+        TMP_START;
+        x = TMP_ALLOC(2*n*sizeof(mp_limb_t));
+        y = x + n;
+
+        _fmpz_mod_get_limbs(x, b, n);
+
+        if (b == c)
+        {
+            _fmpz_mod_mpn_mul(x, x, x, ctx);
+        }
+        else
+        {
+            _fmpz_mod_get_limbs(y, c, n);
+            _fmpz_mod_mpn_mul(x, x, y, ctx);
+        }
+
+        _fmpz_mod_set_limbs(a, x, n);
+
+        TMP_END;
+    }
+}
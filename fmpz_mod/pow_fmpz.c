@@ -0,0 +1,69 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz_mod.h"
+
+void fmpz_mod_pow_fmpz(fmpz_t a, const fmpz_t b, const fmpz_t e,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t n = ctx->size;
+    mp_ptr x, y;
+    slong i;
+    TMP_INIT;
+
+    if (fmpz_sgn(e) < 0)
+    {
+        flint_printf("Exception (fmpz_mod_pow_fmpz). Negative exponent.\n");
+        flint_abort();
+    }
+
+    if (n == 1)
+    {
+        if (ctx->mod.n == 1)
+            fmpz_zero(a);
+        else if (fmpz_abs_fits_ui(e))
+            fmpz_set_ui(a, n_powmod2_ui_preinv(fmpz_get_ui(b), fmpz_get_ui(e),
+                                               ctx->mod.n, ctx->mod.ninv));
+        else
+            fmpz_powm(a, b, e, ctx->n);
+
+        return;
+    }
+
+    if (fmpz_is_zero(e))
+    {
+        fmpz_one(a);
+        return;
+    }
+
+    TMP_START;
+    x = TMP_ALLOC(2*n*sizeof(mp_limb_t));
+    y = x + n;
+
+    _fmpz_mod_get_limbs(x, b, n);
+    flint_mpn_copyi(y, x, n);
+
+    for (i = fmpz_sizeinbase(e, 2) - 2; i >= 0; i--)
+    {
+        _fmpz_mod_mpn_mul(y, y, y, ctx);
+
+        if (fmpz_tstbit(e, i))
+            _fmpz_mod_mpn_mul(y, y, x, ctx);
+    }
+
+    _fmpz_mod_set_limbs(a, y, n);
+
+    TMP_END;
+}
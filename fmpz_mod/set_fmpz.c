@@ -0,0 +1,79 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz_mod.h"
+
+void fmpz_mod_set_fmpz(fmpz_t a, const fmpz_t b, const fmpz_mod_ctx_t ctx)
+{
+    fmpz c = *b;
+
+    if (ctx->size == 1)
+    {
+        mp_limb_t r;
+
+        if (COEFF_IS_MPZ(c))
+            r = fmpz_fdiv_ui(b, ctx->mod.n);
+        else if (c >= 0)
+            r = n_mod2_preinv(c, ctx->mod.n, ctx->mod.ninv);
+        else
+        {
+            r = n_mod2_preinv(-c, ctx->mod.n, ctx->mod.ninv);
+            r = (r == 0) ? 0 : ctx->mod.n - r;
+        }
+
+        fmpz_set_ui(a, r);
+    }
+    else if (!COEFF_IS_MPZ(c))
+    {
+        /* |c| < n */
+        if (c >= 0)
+            fmpz_set_si(a, c);
+        else
+            fmpz_sub_ui(a, ctx->n, -c);
+    }
+    else
+    {
+        __mpz_struct * m = COEFF_TO_PTR(c);
+        mp_size_t s = ctx->size, size = FLINT_ABS(m->_mp_size);
+        int neg = (m->_mp_size < 0);
+        mp_ptr t;
+        TMP_INIT;
+
+        if (size < s)
+        {
+            if (neg)
+            {
+                fmpz_neg(a, b);
+                fmpz_sub(a, ctx->n, a);
+            }
+            else
+                fmpz_set(a, b);
+
+            return;
+        }
+
+        TMP_START;
+        t = TMP_ALLOC(s*sizeof(mp_limb_t));
+
+        _fmpz_mod_mpn_mod(t, m->_mp_d, size, ctx);
+
+        if (neg && !flint_mpn_zero_p(t, s))
+            mpn_sub_n(t, COEFF_TO_PTR(*ctx->n)->_mp_d, t, s);
+
+        _fmpz_mod_set_limbs(a, t, s);
+
+        TMP_END;
+    }
+}
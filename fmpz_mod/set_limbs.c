@@ -0,0 +1,38 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz_mod.h"
+
+void _fmpz_mod_set_limbs(fmpz_t a, mp_srcptr x, mp_size_t n)
+{
+    __mpz_struct * m;
+
+    while (n > 0 && x[n - 1] == 0)
+        n--;
+
+    if (n <= 1)
+    {
+        fmpz_set_ui(a, n == 0 ? UWORD(0) : x[0]);
+        return;
+    }
+
+    m = _fmpz_promote(a);
+
+    if (m->_mp_alloc < n)
+        mpz_realloc2(m, n*FLINT_BITS);
+
+    flint_mpn_copyi(m->_mp_d, x, n);
+    m->_mp_size = n;
+}
@@ -0,0 +1,31 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz_mod.h"
+
+void fmpz_mod_sub(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                                const fmpz_mod_ctx_t ctx)
+{
+    if (ctx->size == 1)
+    {
+        fmpz_set_ui(a, nmod_sub(fmpz_get_ui(b), fmpz_get_ui(c), ctx->mod));
+    }
+    else
+    {
+        fmpz_sub(a, b, c);
+        if (fmpz_sgn(a) < 0)
+            fmpz_add(a, a, ctx->n);
+    }
+}
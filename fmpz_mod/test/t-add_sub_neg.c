@@ -0,0 +1,84 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mod.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("add/sub/neg....");
+    fflush(stdout);
+
+    for (i = 0; i < 100000 * flint_test_multiplier(); i++)
+    {
+        fmpz_mod_ctx_t ctx;
+        fmpz_t n, a, b, c, d, e, f;
+
+        fmpz_init(n);
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(c);
+        fmpz_init(d);
+        fmpz_init(e);
+        fmpz_init(f);
+
+        fmpz_randtest_not_zero(n, state, n_randint(state, 6*FLINT_BITS) + 1);
+        fmpz_abs(n, n);
+        fmpz_mod_ctx_init(ctx, n);
+
+        fmpz_randm(a, state, n);
+        fmpz_randm(b, state, n);
+
+        fmpz_mod_add(c, a, b, ctx);
+        fmpz_add(d, a, b);
+        fmpz_mod(d, d, n);
+
+        fmpz_mod_sub(e, c, b, ctx);
+        fmpz_mod_neg(f, b, ctx);
+        fmpz_mod_add(f, f, c, ctx);
+
+        if (!fmpz_equal(c, d) || !fmpz_equal(e, a) || !fmpz_equal(f, a)
+                || !fmpz_mod_is_canonical(c, ctx))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = "), fmpz_print(n), flint_printf("\n");
+            flint_printf("a = "), fmpz_print(a), flint_printf("\n");
+            flint_printf("b = "), fmpz_print(b), flint_printf("\n");
+            flint_printf("c = "), fmpz_print(c), flint_printf("\n");
+            flint_printf("e = "), fmpz_print(e), flint_printf("\n");
+            flint_printf("f = "), fmpz_print(f), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_mod_ctx_clear(ctx);
+        fmpz_clear(n);
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(c);
+        fmpz_clear(d);
+        fmpz_clear(e);
+        fmpz_clear(f);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -30,6 +30,7 @@
 #include "fmpz.h"
 #include "fmpz_poly.h"
 #include "fmpz_mat.h"
+#include "fmpz_mod.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -385,6 +386,9 @@ FLINT_DLL void _fmpz_mod_poly_mul(fmpz *res, const fmpz *poly1, slong len1,
 FLINT_DLL void fmpz_mod_poly_mul(fmpz_mod_poly_t res, 
                        const fmpz_mod_poly_t poly1, const fmpz_mod_poly_t poly2);
 
+FLINT_DLL void _fmpz_mod_poly_mul_ctx(fmpz *res, const fmpz *poly1, slong len1, 
+                 const fmpz *poly2, slong len2, const fmpz_mod_ctx_t ctx);
+
 FLINT_DLL void _fmpz_mod_poly_mullow(fmpz *res, const fmpz *poly1, slong len1, 
                                       const fmpz *poly2, slong len2, 
                                       const fmpz_t p, slong n);
@@ -392,10 +396,17 @@ FLINT_DLL void _fmpz_mod_poly_mullow(fmpz *res, const fmpz *poly1, slong len1,
 FLINT_DLL void fmpz_mod_poly_mullow(fmpz_mod_poly_t res, 
     const fmpz_mod_poly_t poly1, const fmpz_mod_poly_t poly2, slong n);
 
+FLINT_DLL void _fmpz_mod_poly_mullow_ctx(fmpz *res, const fmpz *poly1,
+                       slong len1, const fmpz *poly2, slong len2,
+                       const fmpz_mod_ctx_t ctx, slong n);
+
 FLINT_DLL void _fmpz_mod_poly_sqr(fmpz *res, const fmpz *poly, slong len, const fmpz_t p);
 
 FLINT_DLL void fmpz_mod_poly_sqr(fmpz_mod_poly_t res, const fmpz_mod_poly_t poly);
 
+FLINT_DLL void _fmpz_mod_poly_sqr_ctx(fmpz *res, const fmpz *poly, slong len,
+                                                   const fmpz_mod_ctx_t ctx);
+
 FLINT_DLL void _fmpz_mod_poly_mulmod(fmpz * res, const fmpz * poly1, slong len1,
                            const fmpz * poly2, slong len2, const fmpz * f,
                            slong lenf, const fmpz_t p);
@@ -411,6 +422,16 @@ FLINT_DLL void fmpz_mod_poly_mulmod_preinv(fmpz_mod_poly_t res, const fmpz_mod_p
                          const fmpz_mod_poly_t poly2, const fmpz_mod_poly_t f,
                          const fmpz_mod_poly_t finv);
 
+FLINT_DLL void _fmpz_mod_poly_mulmod_preinv_ctx(fmpz * res, const fmpz * poly1,
+                    slong len1, const fmpz * poly2, slong len2, const fmpz * f,
+                    slong lenf, const fmpz* finv, slong lenfinv,
+                    const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_poly_mulmod_preinv_ctx(fmpz_mod_poly_t res,
+                    const fmpz_mod_poly_t poly1, const fmpz_mod_poly_t poly2,
+                    const fmpz_mod_poly_t f, const fmpz_mod_poly_t finv,
+                    const fmpz_mod_ctx_t ctx);
+
 /*  Powering *****************************************************************/
 
 FLINT_DLL void _fmpz_mod_poly_pow(fmpz *rop, const fmpz *op, slong len, ulong e, 
@@ -462,6 +483,16 @@ FLINT_DLL void fmpz_mod_poly_powmod_fmpz_binexp_preinv(fmpz_mod_poly_t res,
                           const fmpz_mod_poly_t poly, const fmpz_t e,
                           const fmpz_mod_poly_t f, const fmpz_mod_poly_t finv);
 
+FLINT_DLL void _fmpz_mod_poly_powmod_fmpz_binexp_preinv_ctx(fmpz * res,
+                          const fmpz * poly, const fmpz_t e, const fmpz * f,
+                          slong lenf, const fmpz* finv, slong lenfinv,
+                          const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_poly_powmod_fmpz_binexp_preinv_ctx(fmpz_mod_poly_t res,
+                          const fmpz_mod_poly_t poly, const fmpz_t e,
+                          const fmpz_mod_poly_t f, const fmpz_mod_poly_t finv,
+                          const fmpz_mod_ctx_t ctx);
+
 FLINT_DLL void _fmpz_mod_poly_powmod_x_fmpz_preinv(fmpz * res, const fmpz_t e, const fmpz * f,
                                    slong lenf, const fmpz* finv, slong lenfinv,
                                    const fmpz_t p);
@@ -469,6 +500,15 @@ FLINT_DLL void _fmpz_mod_poly_powmod_x_fmpz_preinv(fmpz * res, const fmpz_t e, c
 FLINT_DLL void fmpz_mod_poly_powmod_x_fmpz_preinv(fmpz_mod_poly_t res, const fmpz_t e,
                           const fmpz_mod_poly_t f, const fmpz_mod_poly_t finv);
 
+FLINT_DLL void _fmpz_mod_poly_powmod_x_fmpz_preinv_ctx(fmpz * res,
+                          const fmpz_t e, const fmpz * f, slong lenf,
+                          const fmpz* finv, slong lenfinv,
+                          const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_poly_powmod_x_fmpz_preinv_ctx(fmpz_mod_poly_t res,
+                          const fmpz_t e, const fmpz_mod_poly_t f,
+                          const fmpz_mod_poly_t finv, const fmpz_mod_ctx_t ctx);
+
 FLINT_DLL void fmpz_mod_poly_frobenius_powers_2exp_precomp(fmpz_mod_poly_frobenius_powers_2exp_t pow, 
                  const fmpz_mod_poly_t f, const fmpz_mod_poly_t finv, ulong m);
 
@@ -507,6 +547,10 @@ FLINT_DLL void _fmpz_mod_poly_div_newton_n_preinv (fmpz* Q, const fmpz* A, slong
 FLINT_DLL void fmpz_mod_poly_div_newton_n_preinv(fmpz_mod_poly_t Q, const fmpz_mod_poly_t A,
                            const fmpz_mod_poly_t B, const fmpz_mod_poly_t Binv);
 
+FLINT_DLL void _fmpz_mod_poly_div_newton_n_preinv_ctx(fmpz* Q, const fmpz* A,
+                     slong lenA, const fmpz* B, slong lenB, const fmpz* Binv,
+                     slong lenBinv, const fmpz_mod_ctx_t ctx);
+
 FLINT_DLL void _fmpz_mod_poly_divrem_newton_n_preinv (fmpz* Q, fmpz* R, const fmpz* A,
                             slong lenA, const fmpz* B, slong lenB,
                             const fmpz* Binv, slong lenBinv, const fmpz_t mod);
@@ -515,6 +559,10 @@ FLINT_DLL void fmpz_mod_poly_divrem_newton_n_preinv(fmpz_mod_poly_t Q, fmpz_mod_
                                const fmpz_mod_poly_t A, const fmpz_mod_poly_t B,
                                const fmpz_mod_poly_t Binv);
 
+FLINT_DLL void _fmpz_mod_poly_divrem_newton_n_preinv_ctx(fmpz* Q, fmpz* R,
+                     const fmpz* A, slong lenA, const fmpz* B, slong lenB,
+                     const fmpz* Binv, slong lenBinv, const fmpz_mod_ctx_t ctx);
+
 FLINT_DLL ulong fmpz_mod_poly_remove(fmpz_mod_poly_t f, const fmpz_mod_poly_t p);
 
 FLINT_DLL void _fmpz_mod_poly_rem_basecase(fmpz * R, 
@@ -1043,6 +1091,16 @@ FLINT_DLL void fmpz_mod_poly_compose_mod_brent_kung_preinv(fmpz_mod_poly_t res,
                    const fmpz_mod_poly_t poly1, const fmpz_mod_poly_t poly2,
                    const fmpz_mod_poly_t poly3, const fmpz_mod_poly_t poly3inv);
 
+FLINT_DLL void _fmpz_mod_poly_compose_mod_brent_kung_preinv_ctx(fmpz * res,
+                 const fmpz * poly1, slong len1, const fmpz * poly2,
+                 const fmpz * poly3, slong len3, const fmpz * poly3inv,
+                 slong len3inv, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void fmpz_mod_poly_compose_mod_brent_kung_preinv_ctx(
+                   fmpz_mod_poly_t res, const fmpz_mod_poly_t poly1,
+                   const fmpz_mod_poly_t poly2, const fmpz_mod_poly_t poly3,
+                   const fmpz_mod_poly_t poly3inv, const fmpz_mod_ctx_t ctx);
+
 FLINT_DLL void _fmpz_mod_poly_compose_mod_horner(fmpz * res, const fmpz * f, slong lenf, const fmpz * g,
                                               const fmpz * h, slong lenh, const fmpz_t p);
 
@@ -44,6 +44,25 @@ void _fmpz_mod_poly_div_newton_n_preinv (fmpz* Q, const fmpz* A, slong lenA,
     _fmpz_vec_clear(Arev, lenQ);
 }
 
+void _fmpz_mod_poly_div_newton_n_preinv_ctx(fmpz* Q, const fmpz* A,
+                     slong lenA, const fmpz* B, slong lenB, const fmpz* Binv,
+                     slong lenBinv, const fmpz_mod_ctx_t ctx)
+{
+    const slong lenQ = lenA - lenB + 1;
+    fmpz * Arev;
+
+    Arev = _fmpz_vec_init(lenQ);
+
+    _fmpz_poly_reverse(Arev, A + (lenA - lenQ), lenQ, lenQ);
+
+    _fmpz_mod_poly_mullow_ctx(Q, Arev, lenQ, Binv, FLINT_MIN(lenQ, lenBinv),
+                              ctx, lenQ);
+
+    _fmpz_poly_reverse(Q, Q, lenQ, lenQ);
+
+    _fmpz_vec_clear(Arev, lenQ);
+}
+
 
 void fmpz_mod_poly_div_newton_n_preinv(fmpz_mod_poly_t Q,
                                const fmpz_mod_poly_t A, const fmpz_mod_poly_t B,
@@ -43,6 +43,27 @@ void _fmpz_mod_poly_divrem_newton_n_preinv (fmpz* Q, fmpz* R, const fmpz* A,
     }
 }
 
+void _fmpz_mod_poly_divrem_newton_n_preinv_ctx(fmpz* Q, fmpz* R,
+                     const fmpz* A, slong lenA, const fmpz* B, slong lenB,
+                     const fmpz* Binv, slong lenBinv, const fmpz_mod_ctx_t ctx)
+{
+    const slong lenQ = lenA - lenB + 1;
+
+    _fmpz_mod_poly_div_newton_n_preinv_ctx(Q, A, lenA, B, lenB,
+                                           Binv, lenBinv, ctx);
+
+    if (lenB > 1)
+    {
+        if (lenQ >= lenB - 1)
+            _fmpz_mod_poly_mullow_ctx(R, Q, lenQ, B, lenB - 1, ctx, lenB - 1);
+        else
+            _fmpz_mod_poly_mullow_ctx(R, B, lenB - 1, Q, lenQ, ctx, lenB - 1);
+
+        _fmpz_vec_sub(R, A, R, lenB - 1);
+        _fmpz_mod_vec_set_fmpz_vec(R, R, lenB - 1, ctx);
+    }
+}
+
 void fmpz_mod_poly_divrem_newton_n_preinv(fmpz_mod_poly_t Q, fmpz_mod_poly_t R,
                               const fmpz_mod_poly_t A, const fmpz_mod_poly_t B,
                               const fmpz_mod_poly_t Binv)
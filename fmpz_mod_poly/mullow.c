@@ -24,6 +24,14 @@ void _fmpz_mod_poly_mullow(fmpz *res, const fmpz *poly1, slong len1,
     _fmpz_vec_scalar_mod_fmpz(res, res, n, p);
 }
 
+void _fmpz_mod_poly_mullow_ctx(fmpz *res, const fmpz *poly1, slong len1, 
+                               const fmpz *poly2, slong len2,
+                               const fmpz_mod_ctx_t ctx, slong n)
+{
+    _fmpz_poly_mullow(res, poly1, len1, poly2, len2, n);
+    _fmpz_mod_vec_set_fmpz_vec(res, res, n, ctx);
+}
+
 void fmpz_mod_poly_mullow(fmpz_mod_poly_t res, 
     const fmpz_mod_poly_t poly1, const fmpz_mod_poly_t poly2, slong n)
 {
@@ -4,6 +4,7 @@
     Copyright (C) 2011 Fredrik Johansson
     Copyright (C) 2012 Lina Kulakova
     Copyright (C) 2013 Martin Lee
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -166,3 +167,142 @@ fmpz_mod_poly_powmod_fmpz_binexp_preinv(fmpz_mod_poly_t res,
     _fmpz_mod_poly_set_length(res, trunc);
     _fmpz_mod_poly_normalise(res);
 }
+
+void
+_fmpz_mod_poly_powmod_fmpz_binexp_preinv_ctx(fmpz * res, const fmpz * poly,
+                          const fmpz_t e, const fmpz * f, slong lenf,
+                          const fmpz* finv, slong lenfinv,
+                          const fmpz_mod_ctx_t ctx)
+{
+    fmpz * T, * Q;
+    slong lenT, lenQ;
+    slong i;
+
+    if (lenf == 2)
+    {
+        fmpz_mod_pow_fmpz(res, poly, e, ctx);
+        return;
+    }
+
+    lenT = 2 * lenf - 3;
+    lenQ = lenT - lenf + 1;
+
+    T = _fmpz_vec_init(lenT + lenQ);
+    Q = T + lenT;
+
+    _fmpz_vec_set(res, poly, lenf - 1);
+
+    for (i = fmpz_sizeinbase(e, 2) - 2; i >= 0; i--)
+    {
+        _fmpz_mod_poly_sqr_ctx(T, res, lenf - 1, ctx);
+        _fmpz_mod_poly_divrem_newton_n_preinv_ctx(Q, res, T, 2 * lenf - 3,
+                                              f, lenf, finv, lenfinv, ctx);
+
+        if (fmpz_tstbit(e, i))
+        {
+            _fmpz_mod_poly_mul_ctx(T, res, lenf - 1, poly, lenf - 1, ctx);
+            _fmpz_mod_poly_divrem_newton_n_preinv_ctx(Q, res, T,
+                                  2 * lenf - 3, f, lenf, finv, lenfinv, ctx);
+        }
+    }
+
+    _fmpz_vec_clear(T, lenT + lenQ);
+}
+
+void
+fmpz_mod_poly_powmod_fmpz_binexp_preinv_ctx(fmpz_mod_poly_t res,
+                          const fmpz_mod_poly_t poly, const fmpz_t e,
+                          const fmpz_mod_poly_t f, const fmpz_mod_poly_t finv,
+                          const fmpz_mod_ctx_t ctx)
+{
+    fmpz * q;
+    slong len = poly->length;
+    slong lenf = f->length;
+    slong trunc = lenf - 1;
+    int qcopy = 0;
+
+    if (lenf == 0)
+    {
+        flint_printf("Exception (fmpz_mod_poly_powmod_fmpz_binexp_preinv_ctx)."
+                     "Divide by zero.\n");
+        flint_abort();
+    }
+
+    if (fmpz_sgn(e) < 0)
+    {
+        flint_printf("Exception (fmpz_mod_poly_powmod_fmpz_binexp_preinv_ctx)."
+                     "Negative exp not implemented\n");
+        flint_abort();
+    }
+
+    if (len >= lenf)
+    {
+        fmpz_mod_poly_t t, r;
+        fmpz_mod_poly_init(t, &res->p);
+        fmpz_mod_poly_init(r, &res->p);
+        fmpz_mod_poly_divrem(t, r, poly, f);
+        fmpz_mod_poly_powmod_fmpz_binexp_preinv_ctx(res, r, e, f, finv, ctx);
+        fmpz_mod_poly_clear(t);
+        fmpz_mod_poly_clear(r);
+        return;
+    }
+
+    if (fmpz_abs_fits_ui(e))
+    {
+        ulong exp = fmpz_get_ui(e);
+
+        if (exp <= 2)
+        {
+            if (exp == UWORD (0))
+            {
+                fmpz_mod_poly_fit_length(res, 1);
+                fmpz_one(res->coeffs);
+                _fmpz_mod_poly_set_length(res, 1);
+            }
+            else if (exp == UWORD (1))
+            {
+                fmpz_mod_poly_set(res, poly);
+            }
+            else
+                fmpz_mod_poly_mulmod_preinv_ctx(res, poly, poly, f, finv, ctx);
+            return;
+        }
+    }
+
+    if (lenf == 1 || len == 0)
+    {
+        fmpz_mod_poly_zero(res);
+        return;
+    }
+
+    if (poly->length < trunc)
+    {
+        q = _fmpz_vec_init(trunc);
+        _fmpz_vec_set(q, poly->coeffs, len);
+        _fmpz_vec_zero(q + len, trunc - len);
+        qcopy = 1;
+    } else
+        q = poly->coeffs;
+
+    if ((res == poly && !qcopy) || (res == f) || (res == finv))
+    {
+        fmpz_mod_poly_t t;
+        fmpz_mod_poly_init2(t, &poly->p, 2 * lenf - 3);
+        _fmpz_mod_poly_powmod_fmpz_binexp_preinv_ctx(t->coeffs,
+            q, e, f->coeffs, lenf, finv->coeffs, finv->length, ctx);
+        fmpz_mod_poly_swap(res, t);
+        fmpz_mod_poly_clear(t);
+    }
+    else
+    {
+        fmpz_mod_poly_fit_length(res, 2 * lenf - 3);
+        _fmpz_mod_poly_powmod_fmpz_binexp_preinv_ctx(res->coeffs,
+            q, e, f->coeffs, lenf, finv->coeffs, finv->length, ctx);
+    }
+
+    if (qcopy)
+        _fmpz_vec_clear(q, trunc);
+
+    _fmpz_mod_poly_set_length(res, trunc);
+    _fmpz_mod_poly_normalise(res);
+}
@@ -4,6 +4,7 @@
     Copyright (C) 2011 Fredrik Johansson
     Copyright (C) 2012 Lina Kulakova
     Copyright (C) 2013 Martin Lee
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -193,3 +194,168 @@ fmpz_mod_poly_powmod_x_fmpz_preinv(fmpz_mod_poly_t res, const fmpz_t e,
     _fmpz_mod_poly_set_length(res, trunc);
     _fmpz_mod_poly_normalise(res);
 }
+
+void
+_fmpz_mod_poly_powmod_x_fmpz_preinv_ctx(fmpz * res, const fmpz_t e,
+                          const fmpz * f, slong lenf, const fmpz* finv,
+                          slong lenfinv, const fmpz_mod_ctx_t ctx)
+{
+    fmpz * T, * Q;
+    slong lenT, lenQ;
+    slong i, window, l, c;
+
+    lenT = 2 * lenf - 3;
+    lenQ = lenT - lenf + 1;
+
+    T = _fmpz_vec_init(lenT + lenQ);
+    Q = T + lenT;
+
+    fmpz_one(res);
+    _fmpz_vec_zero(res + 1, lenf - 2);
+    l = z_sizeinbase(lenf - 1, 2) - 2;
+    window = WORD(0);
+    window = (WORD(1) << l);
+    c = l;
+    i = fmpz_sizeinbase(e, 2) - 2;
+    if (i <= l)
+    {
+      window = WORD(0);
+      window = (WORD(1) << i);
+      c = i;
+      l = i;
+    }
+
+    if (c == 0)
+    {
+        _fmpz_mod_poly_shift_left(T, res, lenf - 1, window);
+        _fmpz_mod_poly_divrem_newton_n_preinv_ctx(Q, res, T,
+                          lenf - 1 + window, f, lenf, finv, lenfinv, ctx);
+        c = l + 1;
+        window = WORD(0);
+    }
+
+    for (; i >= 0; i--)
+    {
+        _fmpz_mod_poly_sqr_ctx(T, res, lenf - 1, ctx);
+        _fmpz_mod_poly_divrem_newton_n_preinv_ctx(Q, res, T, 2 * lenf - 3,
+                                              f, lenf, finv, lenfinv, ctx);
+
+        c--;
+        if (fmpz_tstbit(e, i))
+        {
+            if (window == WORD(0) && i <= l - 1)
+                c = i;
+            if ( c >= 0)
+              window = window | (WORD(1) << c);
+        }
+        else if (window == WORD(0))
+            c = l + 1;
+        if (c == 0)
+        {
+            _fmpz_mod_poly_shift_left(T, res, lenf - 1, window);
+            
+            _fmpz_mod_poly_divrem_newton_n_preinv_ctx(Q, res, T,
+                          lenf - 1 + window, f, lenf, finv, lenfinv, ctx);
+            c = l + 1;
+            window = WORD(0);
+        }
+    }
+
+    _fmpz_vec_clear(T, lenT + lenQ);
+}
+
+void
+fmpz_mod_poly_powmod_x_fmpz_preinv_ctx(fmpz_mod_poly_t res, const fmpz_t e,
+                          const fmpz_mod_poly_t f, const fmpz_mod_poly_t finv,
+                          const fmpz_mod_ctx_t ctx)
+{
+    slong lenf = f->length;
+    slong trunc = lenf - 1;
+    fmpz_mod_poly_t tmp;
+
+    if (lenf == 0)
+    {
+        flint_printf("Exception (fmpz_mod_poly_powmod_x_fmpz_preinv_ctx)."
+                     "Divide by zero\n");
+        flint_abort();
+    }
+
+    if (fmpz_sgn(e) < 0)
+    {
+        flint_printf("Exception (fmpz_mod_poly_powmod_x_fmpz_preinv_ctx)."
+                     "Negative exp not implemented\n");
+        flint_abort();
+    }
+
+    if (lenf == 1)
+    {
+        fmpz_mod_poly_zero(res);
+        return;
+    }
+
+    if (lenf == 2)
+    {
+        fmpz_mod_poly_t r, poly;
+        fmpz_mod_poly_init(tmp, &res->p);
+        fmpz_mod_poly_init(r, &res->p);
+        fmpz_mod_poly_init2(poly, &res->p, 2);
+        fmpz_mod_poly_set_coeff_ui (poly, 1, 1);
+        fmpz_mod_poly_divrem(tmp, r, poly, f);
+        fmpz_mod_poly_powmod_fmpz_binexp_preinv_ctx(res, r, e, f, finv, ctx);
+        fmpz_mod_poly_clear(tmp);
+        fmpz_mod_poly_clear(r);
+        fmpz_mod_poly_clear(poly);
+        return;
+    }
+
+    if (fmpz_abs_fits_ui(e))
+    {
+        ulong exp = fmpz_get_ui(e);
+
+        if (exp <= 2)
+        {
+            if (exp == UWORD(0))
+            {
+                fmpz_mod_poly_fit_length(res, 1);
+                fmpz_one(res->coeffs);
+                _fmpz_mod_poly_set_length(res, 1);
+            }
+            else if (exp == UWORD(1))
+            {
+                fmpz_mod_poly_t r;
+                fmpz_mod_poly_init2(r, &f->p, 2);
+                fmpz_mod_poly_set_coeff_ui(r, 1, 1);
+                fmpz_mod_poly_init(tmp, &f->p);
+                fmpz_mod_poly_divrem(tmp, res, r, f);
+                fmpz_mod_poly_clear(tmp);
+                fmpz_mod_poly_clear(r);
+            }
+            else
+            {
+                fmpz_mod_poly_init2(tmp, &f->p, 3);
+                fmpz_mod_poly_set_coeff_ui(tmp, 1, 1);
+                fmpz_mod_poly_mulmod(res, tmp, tmp, f);
+                fmpz_mod_poly_clear(tmp);
+            }
+            return;
+        }
+    }
+
+    if ((res == f) || (res == finv))
+    {
+        fmpz_mod_poly_init2(tmp, &f->p, trunc);
+        _fmpz_mod_poly_powmod_x_fmpz_preinv_ctx(tmp->coeffs, e, f->coeffs,
+                                      lenf, finv->coeffs, finv->length, ctx);
+        fmpz_mod_poly_swap(res, tmp);
+        fmpz_mod_poly_clear(tmp);
+    }
+    else
+    {
+        fmpz_mod_poly_fit_length(res, trunc);
+        _fmpz_mod_poly_powmod_x_fmpz_preinv_ctx(res->coeffs, e, f->coeffs,
+                                      lenf, finv->coeffs, finv->length, ctx);
+    }
+
+    _fmpz_mod_poly_set_length(res, trunc);
+    _fmpz_mod_poly_normalise(res);
+}
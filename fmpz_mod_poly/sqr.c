@@ -22,6 +22,13 @@ void _fmpz_mod_poly_sqr(fmpz *res, const fmpz *poly, slong len, const fmpz_t p)
     _fmpz_vec_scalar_mod_fmpz(res, res, 2 * len - 1, p);
 }
 
+void _fmpz_mod_poly_sqr_ctx(fmpz *res, const fmpz *poly, slong len,
+                                                   const fmpz_mod_ctx_t ctx)
+{
+    _fmpz_poly_sqr(res, poly, len);
+    _fmpz_mod_vec_set_fmpz_vec(res, res, 2 * len - 1, ctx);
+}
+
 void fmpz_mod_poly_sqr(fmpz_mod_poly_t res, const fmpz_mod_poly_t poly)
 {
     const slong len = poly->length;
@@ -0,0 +1,115 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mod.h"
+#include "fmpz_mod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mulmod_preinv_ctx....");
+    fflush(stdout);
+
+    /* Check mulmod_preinv_ctx and powmod_fmpz_binexp_preinv_ctx against
+       mulmod for moduli of one to five limbs */
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p, e;
+        fmpz_mod_ctx_t ctx;
+        fmpz_mod_poly_t a, b, f, finv, res1, res2;
+
+        fmpz_init(p);
+        fmpz_init(e);
+        fmpz_randprime(p, state, 2 + n_randint(state, 5*FLINT_BITS - 1), 0);
+        fmpz_mod_ctx_init(ctx, p);
+
+        fmpz_mod_poly_init(a, p);
+        fmpz_mod_poly_init(b, p);
+        fmpz_mod_poly_init(f, p);
+        fmpz_mod_poly_init(finv, p);
+        fmpz_mod_poly_init(res1, p);
+        fmpz_mod_poly_init(res2, p);
+
+        fmpz_mod_poly_randtest(a, state, n_randint(state, 40));
+        fmpz_mod_poly_randtest(b, state, n_randint(state, 40));
+        fmpz_mod_poly_randtest_monic(f, state, n_randint(state, 40) + 2);
+        fmpz_mod_poly_rem(a, a, f);
+        fmpz_mod_poly_rem(b, b, f);
+
+        fmpz_mod_poly_reverse(finv, f, f->length);
+        fmpz_mod_poly_inv_series_newton(finv, finv, f->length);
+
+        fmpz_mod_poly_mulmod(res1, a, b, f);
+
+        if (n_randint(state, 2))
+        {
+            fmpz_mod_poly_mulmod_preinv_ctx(res2, a, b, f, finv, ctx);
+        }
+        else
+        {
+            fmpz_mod_poly_set(res2, a);
+            fmpz_mod_poly_mulmod_preinv_ctx(res2, res2, b, f, finv, ctx);
+        }
+
+        result = fmpz_mod_poly_equal(res1, res2);
+
+        if (result)
+        {
+            ulong k, exp = n_randint(state, 20);
+
+            fmpz_set_ui(e, exp);
+            fmpz_mod_poly_powmod_fmpz_binexp_preinv_ctx(res1, a, e, f, finv,
+                                                                        ctx);
+            fmpz_mod_poly_zero(res2);
+            fmpz_mod_poly_set_coeff_ui(res2, 0, 1);
+            for (k = 0; k < exp; k++)
+                fmpz_mod_poly_mulmod(res2, res2, a, f);
+
+            result = fmpz_mod_poly_equal(res1, res2);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("p = "); fmpz_print(p); flint_printf("\n\n");
+            flint_printf("a:\n"); fmpz_mod_poly_print(a), flint_printf("\n\n");
+            flint_printf("b:\n"); fmpz_mod_poly_print(b), flint_printf("\n\n");
+            flint_printf("f:\n"); fmpz_mod_poly_print(f), flint_printf("\n\n");
+            flint_printf("res1:\n"); fmpz_mod_poly_print(res1), flint_printf("\n\n");
+            flint_printf("res2:\n"); fmpz_mod_poly_print(res2), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_mod_poly_clear(a);
+        fmpz_mod_poly_clear(b);
+        fmpz_mod_poly_clear(f);
+        fmpz_mod_poly_clear(finv);
+        fmpz_mod_poly_clear(res1);
+        fmpz_mod_poly_clear(res2);
+        fmpz_mod_ctx_clear(ctx);
+        fmpz_clear(e);
+        fmpz_clear(p);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -74,6 +74,8 @@ FLINT_DLL void fmpz_mod_poly_factor_print(const fmpz_mod_poly_factor_t fac);
 FLINT_DLL void fmpz_mod_poly_factor_concat(fmpz_mod_poly_factor_t res,
                                  const fmpz_mod_poly_factor_t fac);
 
+FLINT_DLL void _fmpz_mod_poly_factor_sort(fmpz_mod_poly_factor_t fac, slong start);
+
 FLINT_DLL void fmpz_mod_poly_factor_pow(fmpz_mod_poly_factor_t fac, slong exp);
 
 FLINT_DLL int fmpz_mod_poly_is_irreducible(const fmpz_mod_poly_t f);
@@ -100,6 +102,12 @@ FLINT_DLL int fmpz_mod_poly_factor_equal_deg_prob(fmpz_mod_poly_t factor,
 FLINT_DLL void fmpz_mod_poly_factor_equal_deg(fmpz_mod_poly_factor_t factors,
                                const fmpz_mod_poly_t pol, slong d);
 
+/* length below which equal degree splitting is not threaded */
+#define FMPZ_MOD_POLY_FACTOR_EQUAL_DEG_THREADED_CUTOFF 64
+
+FLINT_DLL void fmpz_mod_poly_factor_equal_deg_threaded(
+      fmpz_mod_poly_factor_t factors, const fmpz_mod_poly_t pol, slong d);
+
 FLINT_DLL void fmpz_mod_poly_factor_distinct_deg(fmpz_mod_poly_factor_t res,
                               const fmpz_mod_poly_t poly, slong * const *degs);
 
@@ -31,6 +31,7 @@ fmpz_mod_poly_factor_distinct_deg(fmpz_mod_poly_factor_t res,
     fmpz_mod_poly_t *h, *H, *I;
     slong i, j, l, m, n, index, d;
     fmpz_t p;
+    fmpz_mod_ctx_t ctx;
     fmpz_mat_t HH, HHH;
     double beta;
 
@@ -53,6 +54,7 @@ fmpz_mod_poly_factor_distinct_deg(fmpz_mod_poly_factor_t res,
     m = ceil(0.5 * n / l);
 
     /* initialization */
+    fmpz_mod_ctx_init(ctx, p);
     fmpz_mod_poly_init(f, p);
     fmpz_mod_poly_init(g, p);
     fmpz_mod_poly_init(vinv, p);
@@ -79,7 +81,7 @@ fmpz_mod_poly_factor_distinct_deg(fmpz_mod_poly_factor_t res,
 
     /* compute baby steps: h[i]=x^{p^i}mod v */
     fmpz_mod_poly_set_coeff_ui(h[0], 1, 1);
-    fmpz_mod_poly_powmod_x_fmpz_preinv(h[1], p, v, vinv);
+    fmpz_mod_poly_powmod_x_fmpz_preinv_ctx(h[1], p, v, vinv, ctx);
     if (fmpz_sizeinbase(p, 2) > ((n_sqrt(v->length - 1) + 1) * 3) / 4)
     {
         for (i= 1; i < FLINT_BIT_COUNT (l); i++)
@@ -101,8 +103,8 @@ fmpz_mod_poly_factor_distinct_deg(fmpz_mod_poly_factor_t res,
         for (i = 2; i < l + 1; i++)
         {
             fmpz_mod_poly_init(h[i], p);
-            fmpz_mod_poly_powmod_fmpz_binexp_preinv(h[i], h[i - 1], p,
-                                              v, vinv);
+            fmpz_mod_poly_powmod_fmpz_binexp_preinv_ctx(h[i], h[i - 1], p,
+                                              v, vinv, ctx);
         }
     }
 
@@ -137,7 +139,7 @@ fmpz_mod_poly_factor_distinct_deg(fmpz_mod_poly_factor_t res,
         {
             fmpz_mod_poly_rem(tmp, h[i], v);
             fmpz_mod_poly_sub(tmp, H[j], tmp);
-            fmpz_mod_poly_mulmod_preinv(I[j], tmp, I[j], v, vinv);
+            fmpz_mod_poly_mulmod_preinv_ctx(I[j], tmp, I[j], v, vinv, ctx);
         }
 
         /* compute F_j=f^{[j*l+1]} * ... * f^{[j*l+l]} */
@@ -192,6 +194,7 @@ fmpz_mod_poly_factor_distinct_deg(fmpz_mod_poly_factor_t res,
 
     /* cleanup */
     fmpz_clear(p);
+    fmpz_mod_ctx_clear(ctx);
     fmpz_mod_poly_clear(f);
     fmpz_mod_poly_clear(g);
     fmpz_mod_poly_clear(v);
@@ -73,6 +73,7 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
     slong i, j, k, l, m, n, index, d, c1 = 1, c2;
     slong num_threads = flint_get_num_threads();
     fmpz_t p;
+    fmpz_mod_ctx_t ctx;
     fmpz_mat_t * HH;
     double beta;
     pthread_t *threads;
@@ -99,6 +100,7 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
     m = ceil(0.5 * n / l);
 
     /* initialization */
+    fmpz_mod_ctx_init(ctx, p);
     fmpz_mod_poly_init(f, p);
     fmpz_mod_poly_init(g, p);
     fmpz_mod_poly_init(vinv, p);
@@ -139,7 +141,7 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
 
     /* compute baby steps: h[i]=x^{p^i}mod v */
     fmpz_mod_poly_set_coeff_ui(h[0], 1, 1);
-    fmpz_mod_poly_powmod_x_fmpz_preinv(h[1], p, v, vinv);
+    fmpz_mod_poly_powmod_x_fmpz_preinv_ctx(h[1], p, v, vinv, ctx);
     if (fmpz_sizeinbase(p, 2) > ((n_sqrt(v->length - 1) + 1) * 3) / 4)
     {
         for (i = 1; i < FLINT_BIT_COUNT(l); i++)
@@ -161,8 +163,8 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
         for (i = 2; i < l + 1; i++)
         {
             fmpz_mod_poly_init(h[i], p);
-            fmpz_mod_poly_powmod_fmpz_binexp_preinv(h[i], h[i - 1], p,
-                                                    v, vinv);
+            fmpz_mod_poly_powmod_fmpz_binexp_preinv_ctx(h[i], h[i - 1], p,
+                                                    v, vinv, ctx);
         }
     }
 
@@ -202,7 +204,8 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
                 {
                     fmpz_mod_poly_rem(tmp, h[k], v);
                     fmpz_mod_poly_sub(tmp, H[i], tmp);
-                    fmpz_mod_poly_mulmod_preinv(I[i], tmp, I[i], v, vinv);
+                    fmpz_mod_poly_mulmod_preinv_ctx(I[i], tmp, I[i], v, vinv,
+                                                    ctx);
                 }
 
                 /* compute F_j=f^{[j*l+1]} * ... * f^{[j*l+l]} */
@@ -299,8 +302,8 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
             fmpz_mod_poly_set_ui(II, UWORD(1));
 
             for (i = 0; i < c1; i++)
-                fmpz_mod_poly_mulmod_preinv(II, II, I[num_threads + i], v,
-                                            vinv);
+                fmpz_mod_poly_mulmod_preinv_ctx(II, II, I[num_threads + i], v,
+                                            vinv, ctx);
 
             fmpz_mod_poly_gcd(II, v, II);
             if (II->length > 1)
@@ -387,8 +390,8 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
             fmpz_mod_poly_set_ui(II, UWORD(1));
 
             for (i = 0; i < c2; i++)
-                fmpz_mod_poly_mulmod_preinv(II, II, I[j * num_threads + i], v,
-                                            vinv);
+                fmpz_mod_poly_mulmod_preinv_ctx(II, II,
+                                    I[j * num_threads + i], v, vinv, ctx);
 
             fmpz_mod_poly_gcd(II, v, II);
             if (II->length > 1)
@@ -451,6 +454,7 @@ fmpz_mod_poly_factor_distinct_deg_threaded(fmpz_mod_poly_factor_t res,
 
     /* cleanup */
     fmpz_clear(p);
+    fmpz_mod_ctx_clear(ctx);
     fmpz_mod_poly_clear(f);
     fmpz_mod_poly_clear(g);
     fmpz_mod_poly_clear(v);
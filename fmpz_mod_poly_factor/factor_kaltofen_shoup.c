@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2012 Lina Kulakova
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -9,9 +10,113 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#undef ulong
+#define ulong ulongxx/* interferes with system includes */
+
 #include <math.h>
+#include <pthread.h>
+
+#undef ulong
+
+#include <gmp.h>
+
+#define ulong mp_limb_t
+
 #include "fmpz_mod_poly.h"
 
+typedef struct
+{
+    fmpz_mod_poly_factor_struct * factors;
+    const fmpz_mod_poly_struct * polys;
+    const slong * degs;
+    slong num;
+    slong start;
+    slong step;
+    slong num_threads;
+}
+_equal_deg_arg_t;
+
+static void
+_equal_deg_components(_equal_deg_arg_t * arg)
+{
+    slong i;
+
+    for (i = arg->start; i < arg->num; i += arg->step)
+        fmpz_mod_poly_factor_equal_deg_threaded(arg->factors + i,
+                                             arg->polys + i, arg->degs[i]);
+}
+
+static void *
+_equal_deg_worker(void * arg_ptr)
+{
+    _equal_deg_arg_t * arg = (_equal_deg_arg_t *) arg_ptr;
+
+    flint_set_num_threads(arg->num_threads);
+    _equal_deg_components(arg);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+   The distinct degree components are independent, so they are split
+   between the threads, each of which may use further threads within its
+   own splitting. The factors are appended to res in component order.
+*/
+static void
+_fmpz_mod_poly_factor_equal_deg_vec(fmpz_mod_poly_factor_t res,
+            const fmpz_mod_poly_struct * polys, const slong * degs, slong num)
+{
+    slong i, workers, num_threads = flint_get_num_threads();
+    fmpz_mod_poly_factor_struct * factors;
+    _equal_deg_arg_t * args;
+    pthread_t * threads;
+
+    if (num == 0)
+        return;
+
+    workers = FLINT_MIN(num, num_threads);
+
+    factors = flint_malloc(num*sizeof(fmpz_mod_poly_factor_struct));
+    args    = flint_malloc(workers*sizeof(_equal_deg_arg_t));
+    threads = flint_malloc(workers*sizeof(pthread_t));
+
+    for (i = 0; i < num; i++)
+        fmpz_mod_poly_factor_init(factors + i);
+
+    for (i = 0; i < workers; i++)
+    {
+        args[i].factors = factors;
+        args[i].polys = polys;
+        args[i].degs = degs;
+        args[i].num = num;
+        args[i].start = i;
+        args[i].step = workers;
+        args[i].num_threads = num_threads/workers
+                            + (i < num_threads % workers);
+    }
+
+    for (i = 1; i < workers; i++)
+        pthread_create(&threads[i], NULL, _equal_deg_worker, &args[i]);
+
+    flint_set_num_threads(args[0].num_threads);
+    _equal_deg_components(&args[0]);
+    flint_set_num_threads(num_threads);
+
+    for (i = 1; i < workers; i++)
+        pthread_join(threads[i], NULL);
+
+    for (i = 0; i < num; i++)
+    {
+        fmpz_mod_poly_factor_concat(res, factors + i);
+        fmpz_mod_poly_factor_clear(factors + i);
+    }
+
+    flint_free(factors);
+    flint_free(args);
+    flint_free(threads);
+}
+
 void
 fmpz_mod_poly_factor_kaltofen_shoup(fmpz_mod_poly_factor_t res,
                                     const fmpz_mod_poly_t poly)
@@ -59,14 +164,29 @@ fmpz_mod_poly_factor_kaltofen_shoup(fmpz_mod_poly_factor_t res,
                                               &degs);
 
         /* compute equal-degree factorisation */
-        for (j = dist_deg_num, l = 0; j < dist_deg->num; j++, l++)
+        if (flint_get_num_threads() > 1)
         {
             res_num = res->num;
 
-            fmpz_mod_poly_factor_equal_deg(res, dist_deg->poly + j, degs[l]);
+            _fmpz_mod_poly_factor_equal_deg_vec(res,
+                                 dist_deg->poly + dist_deg_num, degs,
+                                 dist_deg->num - dist_deg_num);
             for (k = res_num; k < res->num; k++)
                 res->exp[k] = fmpz_mod_poly_remove(v, res->poly + k);
         }
+        else
+        {
+            for (j = dist_deg_num, l = 0; j < dist_deg->num; j++, l++)
+            {
+                res_num = res->num;
+
+                fmpz_mod_poly_factor_equal_deg(res, dist_deg->poly + j,
+                                               degs[l]);
+                _fmpz_mod_poly_factor_sort(res, res_num);
+                for (k = res_num; k < res->num; k++)
+                    res->exp[k] = fmpz_mod_poly_remove(v, res->poly + k);
+            }
+        }
     }
 
     flint_free(degs);
@@ -30,6 +30,7 @@ int fmpz_mod_poly_is_irreducible_ddf(const fmpz_mod_poly_t poly)
     fmpz_mat_t HH;
     slong i, j, l, m, n, d;
     fmpz_t p;
+    fmpz_mod_ctx_t ctx;
     double beta;
     int result = 1;
 
@@ -48,6 +49,7 @@ int fmpz_mod_poly_is_irreducible_ddf(const fmpz_mod_poly_t poly)
     /* initialization */
     fmpz_init(p);
     fmpz_set(p, &poly->p);
+    fmpz_mod_ctx_init(ctx, p);
 
     fmpz_mod_poly_init(f, p);
     fmpz_mod_poly_init(v, p);
@@ -76,7 +78,7 @@ int fmpz_mod_poly_is_irreducible_ddf(const fmpz_mod_poly_t poly)
     fmpz_mod_poly_inv_series_newton (vinv, vinv, v->length);
     /* compute baby steps: h[i]=x^{p^i}mod v */
     fmpz_mod_poly_set_coeff_ui(h[0], 1, 1);
-    fmpz_mod_poly_powmod_x_fmpz_preinv(h[1], p, v, vinv);
+    fmpz_mod_poly_powmod_x_fmpz_preinv_ctx(h[1], p, v, vinv, ctx);
     if (fmpz_sizeinbase(p, 2) > ((n_sqrt(v->length - 1) + 1) * 3) / 4)
     {
         for (i= 1; i < FLINT_BIT_COUNT (l); i++)
@@ -98,8 +100,8 @@ int fmpz_mod_poly_is_irreducible_ddf(const fmpz_mod_poly_t poly)
         for (i = 2; i < l + 1; i++)
         {
             fmpz_mod_poly_init(h[i], p);
-            fmpz_mod_poly_powmod_fmpz_binexp_preinv(h[i], h[i - 1], p,
-                                              v, vinv);
+            fmpz_mod_poly_powmod_fmpz_binexp_preinv_ctx(h[i], h[i - 1], p,
+                                              v, vinv, ctx);
         }
     }
 
@@ -120,7 +122,7 @@ int fmpz_mod_poly_is_irreducible_ddf(const fmpz_mod_poly_t poly)
         {
             fmpz_mod_poly_rem(tmp, h[i], v);
             fmpz_mod_poly_sub(tmp, H[j], tmp);
-            fmpz_mod_poly_mulmod_preinv (I[j], tmp, I[j], v, vinv);
+            fmpz_mod_poly_mulmod_preinv_ctx(I[j], tmp, I[j], v, vinv, ctx);
         }
 
         /* compute F_j=f^{[j*l+1]} * ... * f^{[j*l+l]} */
@@ -134,6 +136,7 @@ int fmpz_mod_poly_is_irreducible_ddf(const fmpz_mod_poly_t poly)
     }
 
     fmpz_clear(p);
+    fmpz_mod_ctx_clear(ctx);
     fmpz_mod_poly_clear(f);
     fmpz_mod_poly_clear(v);
     fmpz_mod_poly_clear(vinv);
@@ -0,0 +1,75 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mod_poly.h"
+
+typedef struct
+{
+    fmpz_mod_poly_struct poly;
+    slong exp;
+} _fmpz_mod_poly_factor_entry;
+
+static int
+_fmpz_mod_poly_factor_entry_cmp(const void * x, const void * y)
+{
+    const fmpz_mod_poly_struct * a, * b;
+    slong i;
+    int c;
+
+    a = &((const _fmpz_mod_poly_factor_entry *) x)->poly;
+    b = &((const _fmpz_mod_poly_factor_entry *) y)->poly;
+
+    if (a->length != b->length)
+        return a->length < b->length ? -1 : 1;
+
+    for (i = a->length - 1; i >= 0; i--)
+    {
+        c = fmpz_cmp(a->coeffs + i, b->coeffs + i);
+        if (c != 0)
+            return c;
+    }
+
+    return 0;
+}
+
+void
+_fmpz_mod_poly_factor_sort(fmpz_mod_poly_factor_t fac, slong start)
+{
+    slong i, n = fac->num - start;
+    _fmpz_mod_poly_factor_entry * t;
+
+    if (n < 2)
+        return;
+
+    /* the polynomial structs are moved, not copied */
+    t = flint_malloc(n*sizeof(_fmpz_mod_poly_factor_entry));
+
+    for (i = 0; i < n; i++)
+    {
+        t[i].poly = fac->poly[start + i];
+        t[i].exp = fac->exp[start + i];
+    }
+
+    qsort(t, n, sizeof(_fmpz_mod_poly_factor_entry),
+                                          _fmpz_mod_poly_factor_entry_cmp);
+
+    for (i = 0; i < n; i++)
+    {
+        fac->poly[start + i] = t[i].poly;
+        fac->exp[start + i] = t[i].exp;
+    }
+
+    flint_free(t);
+}
@@ -0,0 +1,119 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "fmpz_mod_poly.h"
+#include "ulong_extras.h"
+#include "flint.h"
+
+int
+main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("factor_equal_deg_threaded....");
+    fflush(stdout);
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+
+    for (iter = 0; iter < 10 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mod_poly_t poly1, poly, q, r, product;
+        fmpz_mod_poly_factor_t res;
+        fmpz_t modulus;
+        slong i, d, num;
+
+        fmpz_init(modulus);
+        fmpz_set_ui(modulus,
+                    n_randprime(state, 10 + n_randint(state, 40), 1));
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpz_mod_poly_init(poly1, modulus);
+        fmpz_mod_poly_init(poly, modulus);
+        fmpz_mod_poly_init(q, modulus);
+        fmpz_mod_poly_init(r, modulus);
+        fmpz_mod_poly_init(product, modulus);
+
+        d = n_randint(state, 4) + 1;
+        num = n_randint(state, 20)
+            + FMPZ_MOD_POLY_FACTOR_EQUAL_DEG_THREADED_CUTOFF/d;
+
+        fmpz_mod_poly_set_coeff_ui(poly1, 0, 1);
+
+        for (i = 0; i < num; i++)
+        {
+            do
+            {
+                fmpz_mod_poly_randtest_monic_irreducible(poly, state, d + 1);
+                fmpz_mod_poly_divrem(q, r, poly1, poly);
+            }
+            while (r->length == 0);
+
+            fmpz_mod_poly_mul(poly1, poly1, poly);
+        }
+
+        fmpz_mod_poly_factor_init(res);
+        fmpz_mod_poly_factor_equal_deg_threaded(res, poly1, d);
+
+        if (res->num != num)
+        {
+            flint_printf("Error: number of factors incorrect\n");
+            flint_printf("%wd != %wd\n", res->num, num);
+            abort();
+        }
+
+        fmpz_mod_poly_set_coeff_ui(product, 0, 1);
+        for (i = 0; i < res->num; i++)
+        {
+            if (fmpz_mod_poly_degree(res->poly + i) != d || res->exp[i] != 1)
+            {
+                flint_printf("Error: factor of incorrect degree\n");
+                flint_printf("factor:\n"); fmpz_mod_poly_print(res->poly + i); flint_printf("\n");
+                abort();
+            }
+
+            fmpz_mod_poly_mul(product, product, res->poly + i);
+        }
+
+        if (!fmpz_mod_poly_equal(poly1, product))
+        {
+            flint_printf("Error: product of factors does not equal to the original polynomial\n");
+            flint_printf("poly:\n"); fmpz_mod_poly_print(poly1); flint_printf("\n");
+            flint_printf("product:\n"); fmpz_mod_poly_print(product); flint_printf("\n");
+            abort();
+        }
+
+        fmpz_mod_poly_clear(product);
+        fmpz_mod_poly_clear(q);
+        fmpz_mod_poly_clear(r);
+        fmpz_mod_poly_clear(poly1);
+        fmpz_mod_poly_clear(poly);
+        fmpz_mod_poly_factor_clear(res);
+        fmpz_clear(modulus);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+
+#else
+
+   FLINT_TEST_CLEANUP(state);
+
+   flint_printf("SKIPPED\n");
+   return 0;
+
+#endif
+
+}
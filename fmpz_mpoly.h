@@ -741,6 +741,21 @@ FLINT_DLL int _fmpz_mpoly_fprint_pretty(FILE * file, const fmpz * poly,
 FLINT_DLL int fmpz_mpoly_fprint_pretty(FILE * file, 
          const fmpz_mpoly_t poly, const char ** x, const fmpz_mpoly_ctx_t ctx);
 
+FLINT_DLL slong _fmpz_mpoly_bin_words_per_exp(const ulong * dims,
+                                                  const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL int fmpz_mpoly_fwrite_bin(FILE * file, const fmpz_mpoly_t poly,
+                                                  const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL int fmpz_mpoly_fread_bin(FILE * file, fmpz_mpoly_t poly,
+                                                  const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL size_t fmpz_mpoly_bin_view_init(fmpz_mpoly_t poly,
+                    const void * buf, size_t size, const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL void fmpz_mpoly_bin_view_clear(fmpz_mpoly_t poly,
+                                                  const fmpz_mpoly_ctx_t ctx);
+
 FMPZ_MPOLY_INLINE
 int _fmpz_mpoly_print_pretty(const fmpz * poly, 
                        const ulong * exps, slong len, const char ** x,
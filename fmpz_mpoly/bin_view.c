@@ -0,0 +1,63 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "fmpz_vec.h"
+#include "fmpz_mpoly.h"
+#include "bin_io.h"
+
+size_t fmpz_mpoly_bin_view_init(fmpz_mpoly_t poly, const void * buf,
+                                     size_t size, const fmpz_mpoly_ctx_t ctx)
+{
+    ulong dims[4];
+    slong i, N, len;
+    size_t h, d;
+    const char * data;
+
+    fmpz_mpoly_init(poly, ctx);
+
+    h = flint_bin_view_header(dims, buf, size, FLINT_BIN_FMPZ_MPOLY);
+    if (h == 0 || (N = _fmpz_mpoly_bin_words_per_exp(dims, ctx)) == 0)
+        return 0;
+
+    len = dims[0];
+    data = (const char *) buf + h;
+
+    d = _fmpz_vec_bin_view_data(&poly->coeffs, data, size - h, len);
+    if (d == 0)
+        return 0;
+
+    for (i = 0; i < len; i++)
+        if (fmpz_is_zero(poly->coeffs + i))
+            break;
+
+    if (i < len || (ulong) (N * len) > (size - h - d) / sizeof(ulong))
+    {
+        _fmpz_vec_bin_view_data_clear(poly->coeffs, data);
+        poly->coeffs = NULL;
+        return 0;
+    }
+
+    /* alloc is nonzero iff the coefficients had to be copied out */
+    poly->exps = (ulong *) (data + d);
+    poly->length = len;
+    poly->bits = dims[3];
+    if (poly->coeffs != (const fmpz *) data + 2)
+        poly->alloc = len;
+
+    return h + d + N * len * sizeof(ulong);
+}
+
+void fmpz_mpoly_bin_view_clear(fmpz_mpoly_t poly, const fmpz_mpoly_ctx_t ctx)
+{
+    if (poly->alloc != 0)
+        flint_free(poly->coeffs);
+}
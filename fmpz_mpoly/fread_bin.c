@@ -0,0 +1,78 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "fmpz_vec.h"
+#include "fmpz_mpoly.h"
+#include "bin_io.h"
+
+/*
+   Returns the number of words per exponent vector for the given header,
+   or 0 if it does not match ctx
+*/
+slong _fmpz_mpoly_bin_words_per_exp(const ulong * dims,
+                                                   const fmpz_mpoly_ctx_t ctx)
+{
+    slong N, bits;
+
+    if (dims[0] > WORD_MAX || dims[1] != (ulong) ctx->minfo->nvars
+           || dims[2] != (ulong) ctx->minfo->ord
+           || dims[3] == 0 || dims[3] > (UWORD(1) << 20))
+        return 0;
+
+    bits = dims[3];
+    if (mpoly_fix_bits(bits, ctx->minfo) != bits)
+        return 0;
+
+    N = mpoly_words_per_exp(bits, ctx->minfo);
+
+    if (dims[0] != 0 && (ulong) N > WORD_MAX / dims[0])
+        return 0;
+
+    return N;
+}
+
+int fmpz_mpoly_fread_bin(FILE * file, fmpz_mpoly_t poly,
+                                                   const fmpz_mpoly_ctx_t ctx)
+{
+    ulong dims[4];
+    slong i, N, len;
+
+    _fmpz_mpoly_set_length(poly, 0, ctx);
+
+    if (!flint_bin_fread_header(file, FLINT_BIN_FMPZ_MPOLY, dims)
+           || (N = _fmpz_mpoly_bin_words_per_exp(dims, ctx)) == 0)
+        return 0;
+
+    len = dims[0];
+
+    /* the exponents are read as they are, so take on their packing */
+    fmpz_mpoly_fit_bits(poly, dims[3], ctx);
+    poly->bits = dims[3];
+    fmpz_mpoly_fit_length(poly, len, ctx);
+
+    if (!_fmpz_vec_fread_bin_data(file, poly->coeffs, len))
+        return 0;
+
+    for (i = 0; i < len; i++)
+        if (fmpz_is_zero(poly->coeffs + i))
+            break;
+
+    if (i < len || !flint_bin_fread_words(poly->exps, N * len, file))
+    {
+        _fmpz_vec_zero(poly->coeffs, len);
+        return 0;
+    }
+
+    _fmpz_mpoly_set_length(poly, len, ctx);
+
+    return 1;
+}
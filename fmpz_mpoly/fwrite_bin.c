@@ -0,0 +1,31 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "fmpz_vec.h"
+#include "fmpz_mpoly.h"
+#include "bin_io.h"
+
+int fmpz_mpoly_fwrite_bin(FILE * file, const fmpz_mpoly_t poly,
+                                                   const fmpz_mpoly_ctx_t ctx)
+{
+    ulong dims[4];
+    slong N = mpoly_words_per_exp(poly->bits, ctx->minfo);
+
+    dims[0] = poly->length;
+    dims[1] = ctx->minfo->nvars;
+    dims[2] = ctx->minfo->ord;
+    dims[3] = poly->bits;
+
+    return flint_bin_fwrite_header(file, FLINT_BIN_FMPZ_MPOLY, dims)
+        && _fmpz_vec_fwrite_bin_data(file, poly->coeffs, poly->length)
+        && flint_bin_fwrite_words(file, poly->exps, N * poly->length);
+}
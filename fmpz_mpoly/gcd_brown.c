@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2018 Daniel Schultz
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -11,6 +12,7 @@
 
 #include "fmpz_mpoly.h"
 #include "nmod_mpoly.h"
+#include "instrument.h"
 
 
 void fmpz_mpolyd_swap(fmpz_mpolyd_t A, fmpz_mpolyd_t B)
@@ -760,6 +762,8 @@ choose_next_prime:
     fmpz_set_ui(pp, p);
     if (fmpz_divisible(lA, pp) || fmpz_divisible(lB, pp))
         goto choose_next_prime;
+    FLINT_INSTR_COUNT(FLINT_INSTR_FMPZ_MPOLY_GCD_BROWN_PRIMES,
+                                                   1, FLINT_BIT_COUNT(p), 0);
 
     nmodf_ctx_reset(fctx, p);
     fmpz_mpolyd_to_nmod_mpolyd(Ap, A, fctx);
@@ -919,7 +923,8 @@ int fmpz_mpoly_gcd_brown(fmpz_mpoly_t G,
     fmpz_mpoly_convert_to_fmpz_mpolyd(Ad, dctx, A, ctx);
     fmpz_mpoly_convert_to_fmpz_mpolyd(Bd, dctx, B, ctx);
 
-    success = fmpz_mpolyd_gcd_brown(Gd, Abar, Bbar, Ad, Bd);
+    FLINT_INSTR(FLINT_INSTR_FMPZ_MPOLY_GCD_BROWN, A->length, B->length,
+        success = fmpz_mpolyd_gcd_brown(Gd, Abar, Bbar, Ad, Bd));
     if (!success)
     {
         fmpz_mpoly_zero(G, ctx);
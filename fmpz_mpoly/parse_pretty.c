@@ -113,15 +113,14 @@ void _fmpz_mpoly_parse_pretty_fit_ostack(slong ** ostack,
 const char * _fmpz_mpoly_parse_pretty_int(const char * s, const char * end,
                                                            fmpz_t c, int * ret)
 {
-    char * buffer, * v;
-    TMP_INIT;
-    TMP_START;
-    v = buffer = (char *) TMP_ALLOC((end - s + 1)*sizeof(char));
+    const char * start = s;
+
     while (s < end && '0' <= *s && *s <= '9')
-        *v++ = *s++;
-    *v++ = '\0';
-    *ret = fmpz_set_str(c, buffer, 10);
-    TMP_END;
+        s++;
+
+    /* convert in place rather than copying the digits out */
+    _fmpz_set_str_dec(c, start, s - start);
+    *ret = (s == start) ? -1 : 0;
     return s;
 }
 
@@ -0,0 +1,103 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "fmpz_mpoly.h"
+#include "bin_io.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("fwrite_bin....");
+#if !defined( _MSC_VER )
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_mpoly_ctx_t ctx;
+        fmpz_mpoly_t f, g, h;
+        ordering_t ord;
+        slong nvars, len, coeff_bits, exp_bits;
+        flint_bin_map_t map;
+        size_t s = 0;
+        FILE * file = fopen("fmpz_mpoly_bin_test", "wb");
+
+        if (!file)
+        {
+            flint_printf("Error: unable to open file for writing.\n");
+            abort();
+        }
+
+        ord = mpoly_ordering_randtest(state);
+        nvars = n_randint(state, 20) + 1;
+
+        fmpz_mpoly_ctx_init(ctx, nvars, ord);
+
+        fmpz_mpoly_init(f, ctx);
+        fmpz_mpoly_init(g, ctx);
+
+        len = n_randint(state, 100);
+        exp_bits = n_randint(state, 200) + 1;
+        coeff_bits = n_randint(state, 200);
+
+        fmpz_mpoly_randtest_bits(f, state, len, coeff_bits, exp_bits, ctx);
+        fmpz_mpoly_randtest_bits(g, state, len, coeff_bits, exp_bits, ctx);
+
+        result = fmpz_mpoly_fwrite_bin(file, f, ctx);
+        fclose(file);
+
+        file = fopen("fmpz_mpoly_bin_test", "rb");
+        result = result && fmpz_mpoly_fread_bin(file, g, ctx)
+                        && fmpz_mpoly_equal(f, g, ctx);
+        fclose(file);
+
+        if (result && flint_bin_map(map, "fmpz_mpoly_bin_test"))
+        {
+            s = fmpz_mpoly_bin_view_init(h, map->data, map->size, ctx);
+            result = (s == map->size && fmpz_mpoly_equal(f, h, ctx));
+            fmpz_mpoly_bin_view_clear(h, ctx);
+
+            flint_bin_unmap(map);
+        } else
+            result = 0;
+
+        if (!result)
+        {
+            printf("FAIL\n");
+            flint_printf("s = %wu\n", (ulong) s);
+            fmpz_mpoly_print_pretty(f, NULL, ctx), flint_printf("\n\n");
+            fmpz_mpoly_print_pretty(g, NULL, ctx), flint_printf("\n\n");
+            remove("fmpz_mpoly_bin_test");
+            flint_abort();
+        }
+
+        if (remove("fmpz_mpoly_bin_test"))
+        {
+            flint_printf("Error, unable to delete file fmpz_mpoly_bin_test\n");
+            abort();
+        }
+
+        fmpz_mpoly_clear(f, ctx);
+        fmpz_mpoly_clear(g, ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+#else
+    flint_printf("SKIPPED\n");
+#endif
+    return 0;
+}
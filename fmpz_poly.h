@@ -42,6 +42,7 @@
 #define FMPZ_POLY_INV_NEWTON_CUTOFF 32
 #define FMPZ_POLY_SQRT_DIVCONQUER_CUTOFF 16
 #define FMPZ_POLY_SQRTREM_DIVCONQUER_CUTOFF 16
+#define FMPZ_POLY_GCD_MODULAR_THREADED_CUTOFF 64
 
 /*  Type definitions *********************************************************/
 
@@ -1103,6 +1104,15 @@ FLINT_DLL int fmpz_poly_fread(FILE * file, fmpz_poly_t poly);
 
 FLINT_DLL int fmpz_poly_fread_pretty(FILE *file, fmpz_poly_t poly, char **x);
 
+FLINT_DLL int fmpz_poly_fwrite_bin(FILE * file, const fmpz_poly_t poly);
+
+FLINT_DLL int fmpz_poly_fread_bin(FILE * file, fmpz_poly_t poly);
+
+FLINT_DLL size_t fmpz_poly_bin_view_init(fmpz_poly_t poly,
+                                              const void * buf, size_t size);
+
+FLINT_DLL void fmpz_poly_bin_view_clear(fmpz_poly_t poly);
+
 FMPZ_POLY_INLINE
 int fmpz_poly_read(fmpz_poly_t poly)
 {
@@ -1225,6 +1235,10 @@ FLINT_DLL void fmpz_poly_hensel_lift_tree_recursive(slong *link,
 FLINT_DLL void fmpz_poly_hensel_lift_tree(slong *link, fmpz_poly_t *v, fmpz_poly_t *w, 
     fmpz_poly_t f, slong r, const fmpz_t p, slong e0, slong e1, slong inv);
 
+FLINT_DLL void fmpz_poly_hensel_lift_tree_multi(slong *link, fmpz_poly_t *v, 
+    fmpz_poly_t *w, fmpz_poly_t f, slong r, const fmpz_t p, const slong * e, 
+    const slong * inv, slong n);
+
 FLINT_DLL slong _fmpz_poly_hensel_start_lift(fmpz_poly_factor_t lifted_fac, slong *link, 
     fmpz_poly_t *v, fmpz_poly_t *w, const fmpz_poly_t f, 
     const nmod_poly_factor_t local_fac, slong target_exp);
@@ -0,0 +1,59 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "bin_io.h"
+
+size_t fmpz_poly_bin_view_init(fmpz_poly_t poly,
+                                                const void * buf, size_t size)
+{
+    ulong dims[4];
+    size_t h, d;
+
+    poly->coeffs = NULL;
+    poly->alloc = 0;
+    poly->length = 0;
+
+    h = flint_bin_view_header(dims, buf, size, FLINT_BIN_FMPZ_POLY);
+    if (h == 0 || dims[0] > WORD_MAX)
+        return 0;
+
+    d = _fmpz_vec_bin_view_data(&poly->coeffs,
+                                    (const char *) buf + h, size - h, dims[0]);
+    if (d == 0)
+        return 0;
+
+    /* a view must be normalised, since it cannot be changed */
+    if (dims[0] != 0 && fmpz_is_zero(poly->coeffs + dims[0] - 1))
+    {
+        _fmpz_vec_bin_view_data_clear(poly->coeffs, (const char *) buf + h);
+        poly->coeffs = NULL;
+        return 0;
+    }
+
+    /* alloc is nonzero iff the coefficients had to be copied out */
+    poly->length = dims[0];
+    if (poly->coeffs != (const fmpz *) ((const char *) buf + h) + 2)
+        poly->alloc = poly->length;
+
+    return h + d;
+}
+
+void fmpz_poly_bin_view_clear(fmpz_poly_t poly)
+{
+    if (poly->alloc != 0)
+        flint_free(poly->coeffs);
+}
@@ -13,12 +13,13 @@
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
+#include "fmpz_vec.h"
 #include "fmpz_poly.h"
 
 int fmpz_poly_fread(FILE * file, fmpz_poly_t poly)
 {
     int r;
-    slong i, len;
+    slong len;
     mpz_t t;
 
     mpz_init(t);
@@ -38,12 +39,9 @@ int fmpz_poly_fread(FILE * file, fmpz_poly_t poly)
 
     fmpz_poly_fit_length(poly, len);
 
-    for (i = 0; i < len; i++)
-    {
-        r = fmpz_fread(file, poly->coeffs + i);
-        if (r <= 0)
-            return r;
-    }
+    r = _fmpz_vec_fread_bulk(file, poly->coeffs, len);
+    if (r <= 0)
+        return r;
 
     _fmpz_poly_set_length(poly, len);
     _fmpz_poly_normalise(poly);
@@ -0,0 +1,39 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "bin_io.h"
+
+int fmpz_poly_fread_bin(FILE * file, fmpz_poly_t poly)
+{
+    ulong dims[4];
+
+    fmpz_poly_zero(poly);
+
+    if (!flint_bin_fread_header(file, FLINT_BIN_FMPZ_POLY, dims)
+           || dims[0] > WORD_MAX)
+        return 0;
+
+    fmpz_poly_fit_length(poly, dims[0]);
+
+    if (!_fmpz_vec_fread_bin_data(file, poly->coeffs, dims[0]))
+        return 0;
+
+    _fmpz_poly_set_length(poly, dims[0]);
+    _fmpz_poly_normalise(poly);
+
+    return 1;
+}
@@ -0,0 +1,28 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "bin_io.h"
+
+int fmpz_poly_fwrite_bin(FILE * file, const fmpz_poly_t poly)
+{
+    ulong dims[4] = {0, 0, 0, 0};
+
+    dims[0] = poly->length;
+
+    return flint_bin_fwrite_header(file, FLINT_BIN_FMPZ_POLY, dims)
+        && _fmpz_vec_fwrite_bin_data(file, poly->coeffs, poly->length);
+}
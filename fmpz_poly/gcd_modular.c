@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2011 William Hart
+    Copyright (C) 2011, 2018 William Hart
 
     This file is part of FLINT.
 
@@ -9,13 +9,140 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#undef ulong
+#define ulong ulongxx/* interferes with system includes */
+
+#include <pthread.h>
+
+#undef ulong
+
 #include <gmp.h>
+
+#define ulong mp_limb_t
+
 #include "flint.h"
 #include "fmpz.h"
 #include "fmpz_vec.h"
 #include "fmpz_poly.h"
 #include "mpn_extras.h"
 
+typedef struct
+{
+    const fmpz * A;
+    slong len1;
+    const fmpz * B;
+    slong len2;
+    const fmpz * g;
+    int g_pm1;
+    const mp_limb_t * primes;
+    mp_ptr images;
+    slong * hlens;
+    slong start;
+    slong stop;
+}
+_gcd_images_arg_t;
+
+/*
+   Computes the images of the gcd modulo primes[start], ..., primes[stop - 1],
+   scaled to have leading coefficient g. Image k is written to
+   images + k*len2 and its length to hlens[k].
+*/
+static void
+_gcd_images(_gcd_images_arg_t * arg)
+{
+    const slong len1 = arg->len1, len2 = arg->len2;
+    mp_ptr a, b, h;
+    mp_limb_t h_inv, g_mod;
+    nmod_t mod;
+    slong k, hlen;
+
+    a = _nmod_vec_init(len1);
+    b = _nmod_vec_init(len2);
+
+    for (k = arg->start; k < arg->stop; k++)
+    {
+        h = arg->images + k*len2;
+
+        nmod_init(&mod, arg->primes[k]);
+
+        /* reduce polynomials modulo p */
+        _fmpz_vec_get_nmod_vec(a, arg->A, len1, mod);
+        _fmpz_vec_get_nmod_vec(b, arg->B, len2, mod);
+
+        /* compute gcd over Z/pZ */
+        hlen = _nmod_poly_gcd(h, a, len1, b, len2, mod);
+
+        /* scale new polynomial mod p appropriately */
+        if (hlen > 1)
+        {
+            if (arg->g_pm1) _nmod_poly_make_monic(h, h, hlen, mod);
+            else
+            {
+                h_inv = n_invmod(h[hlen - 1], mod.n);
+                g_mod = fmpz_fdiv_ui(arg->g, mod.n);
+                h_inv = n_mulmod2_preinv(h_inv, g_mod, mod.n, mod.ninv);
+                _nmod_vec_scalar_mul_nmod(h, h, hlen, h_inv, mod);
+            }
+        }
+
+        arg->hlens[k] = hlen;
+    }
+
+    _nmod_vec_clear(a);
+    _nmod_vec_clear(b);
+}
+
+static void *
+_gcd_images_worker(void * arg_ptr)
+{
+    _gcd_images((_gcd_images_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+   Returns 1 if (G, lenG) divides (A, len1) and (B, len2). Before the
+   trial divisions, checks that G(x) divides A(x) and B(x) at a point x
+   chosen from the last prime p, which rejects most wrong candidates
+   at the cost of three evaluations.
+*/
+static int
+_gcd_divides(fmpz * Q, const fmpz * A, slong len1, const fmpz * B, slong len2,
+                                   const fmpz * G, slong lenG, mp_limb_t p)
+{
+    fmpz_t x, e, t;
+    int result = 1;
+
+    fmpz_init(x);
+    fmpz_init(e);
+    fmpz_init(t);
+
+    fmpz_set_ui(x, 2 + p % 61);
+
+    _fmpz_poly_evaluate_fmpz(e, G, lenG, x);
+    fmpz_abs(e, e);
+
+    if (!fmpz_is_zero(e))
+    {
+        _fmpz_poly_evaluate_fmpz(t, B, len2, x);
+        result = fmpz_divisible(t, e);
+
+        if (result)
+        {
+            _fmpz_poly_evaluate_fmpz(t, A, len1, x);
+            result = fmpz_divisible(t, e);
+        }
+    }
+
+    fmpz_clear(x);
+    fmpz_clear(e);
+    fmpz_clear(t);
+
+    return result && _fmpz_poly_divides(Q, B, len2, G, lenG)
+                  && _fmpz_poly_divides(Q, A, len1, G, lenG);
+}
+
 
 void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1, 
                                         const fmpz * poly2, slong len2)
@@ -23,10 +150,13 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
     mp_bitcnt_t bits1, bits2, nb1, nb2, bits_small, pbits, curr_bits = 0, new_bits;   
     fmpz_t ac, bc, hc, d, g, l, eval_A, eval_B, eval_GCD, modulus;
     fmpz * A, * B, * Q, * lead_A, * lead_B;
-    mp_ptr a, b, h;
-    mp_limb_t p, h_inv, g_mod;
+    mp_ptr h, images;
+    mp_limb_t p, * primes;
     nmod_t mod;
-    slong i, n, n0, unlucky, hlen, bound;
+    slong i, k, n, n0, unlucky, hlen, hmin, bound, num_primes, num_threads;
+    slong * hlens;
+    _gcd_images_arg_t * args;
+    pthread_t * threads;
     int g_pm1;
 
     fmpz_init(ac);
@@ -126,10 +256,33 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
 
     Q = _fmpz_vec_init(len1);
 
+    /* one prime per thread in each round, only one if the images are cheap */
+    num_threads = flint_get_num_threads();
+    if (len2 < FMPZ_POLY_GCD_MODULAR_THREADED_CUTOFF)
+        num_threads = 1;
+    num_primes = num_threads;
+
     /* make space for polynomials mod p */
-    a = _nmod_vec_init(len1);
-    b = _nmod_vec_init(len2);
-    h = _nmod_vec_init(len2);
+    primes = (mp_limb_t *) flint_malloc(num_primes*sizeof(mp_limb_t));
+    hlens = (slong *) flint_malloc(num_primes*sizeof(slong));
+    images = _nmod_vec_init(num_primes*len2);
+    args = (_gcd_images_arg_t *) flint_malloc(num_threads*sizeof(_gcd_images_arg_t));
+    threads = (pthread_t *) flint_malloc(num_threads*sizeof(pthread_t));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].A = A;
+        args[i].len1 = len1;
+        args[i].B = B;
+        args[i].len2 = len2;
+        args[i].g = g;
+        args[i].g_pm1 = g_pm1;
+        args[i].primes = primes;
+        args[i].images = images;
+        args[i].hlens = hlens;
+        args[i].start = (i*num_primes)/num_threads;
+        args[i].stop = ((i + 1)*num_primes)/num_threads;
+    }
 
     /* zero entire output */
     _fmpz_vec_zero(res, len2);
@@ -145,142 +298,153 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
 
     for (;;)
     {
-        /* get new prime and initialise modulus */
-        p = n_nextprime(p, 0);
-        if (fmpz_fdiv_ui(l, p) == 0)
+        /* get new primes for this round */
+        for (k = 0; k < num_primes; )
         {
-            unlucky += pbits;
-            continue;
+            p = n_nextprime(p, 0);
+            if (fmpz_fdiv_ui(l, p) == 0)
+                unlucky += pbits;
+            else
+                primes[k++] = p;
         }
-        nmod_init(&mod, p);
 
-        /* reduce polynomials modulo p */
-        _fmpz_vec_get_nmod_vec(a, A, len1, mod);
-        _fmpz_vec_get_nmod_vec(b, B, len2, mod);
+        /* compute the images of the gcd modulo each prime concurrently */
+        for (i = 1; i < num_threads; i++)
+            pthread_create(&threads[i], NULL, _gcd_images_worker, &args[i]);
 
-        /* compute gcd over Z/pZ */
-        hlen = _nmod_poly_gcd(h, a, len1, b, len2, mod);
+        _gcd_images(&args[0]);
 
-        if (hlen == 1) /* gcd is 1 */
-        {
-            fmpz_one(res);
-            _fmpz_vec_zero(res + 1, len2 - 1);
-            break; 
-        }
+        for (i = 1; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
 
-        if (hlen > n + 1) /* discard this prime */
-        {
-            unlucky += pbits;
-            continue;
-        }
+        /*
+           unlucky primes can only raise the degree of the image, so the
+           images of more than the least degree in the round are discarded
+        */
+        hmin = hlens[0];
+        for (k = 1; k < num_primes; k++)
+            hmin = FLINT_MIN(hmin, hlens[k]);
 
-        /* scale new polynomial mod p appropriately */
-        if (g_pm1) _nmod_poly_make_monic(h, h, hlen, mod);
-        else
+        if (hmin == 1) /* gcd is 1 */
         {
-            h_inv = n_invmod(h[hlen - 1], mod.n);
-            g_mod = fmpz_fdiv_ui(g, mod.n);
-            h_inv = n_mulmod2_preinv(h_inv, g_mod, mod.n, mod.ninv);
-            _nmod_vec_scalar_mul_nmod(h, h, hlen, h_inv, mod);
+            hlen = 1;
+            fmpz_one(res);
+            _fmpz_vec_zero(res + 1, len2 - 1);
+            goto done; 
         }
 
-        if (hlen <= n) /* we have a new bound on size of result */
+        for (k = 0; k < num_primes; k++)
         {
-            unlucky += fmpz_bits(modulus);
-            _fmpz_vec_set_nmod_vec(res, h, hlen, mod);
-            _fmpz_vec_zero(res + hlen, len2 - hlen);
+            hlen = hlens[k];
+            h = images + k*len2;
+            p = primes[k];
+            nmod_init(&mod, p);
 
-            if (g_pm1)
+            if (hlen > hmin || hlen > n + 1) /* discard this prime */
             {
-                /* are we done? */
-                if (_fmpz_poly_divides(Q, B, len2, res, hlen) &&
-                    _fmpz_poly_divides(Q, A, len1, res, hlen))
-                break;
+                unlucky += pbits;
+                continue;
             }
-            else
+
+            if (hlen <= n) /* we have a new bound on size of result */
             {
-                if (pbits + unlucky >= bound) /* if we reach the bound with one prime */
-                { 
-                    _fmpz_vec_content(hc, res, hlen);
+                unlucky += fmpz_bits(modulus);
+                _fmpz_vec_set_nmod_vec(res, h, hlen, mod);
+                _fmpz_vec_zero(res + hlen, len2 - hlen);
 
-                   /* divide by content */
-                   _fmpz_vec_scalar_divexact_fmpz(res, res, hlen, hc);
-                   break;
+                if (g_pm1)
+                {
+                    /* are we done? */
+                    if (_gcd_divides(Q, A, len1, B, len2, res, hlen, p))
+                        goto done;
                 }
-
-                if (pbits >= bits_small) /* if one prime is already big enough to check */
+                else
                 {
-                    /* divide by content */
-                    _fmpz_vec_content(hc, res, hlen);
+                    if (pbits + unlucky >= bound) /* if we reach the bound with one prime */
+                    { 
+                        _fmpz_vec_content(hc, res, hlen);
 
-                    /* correct sign of leading term */
-                    if (fmpz_sgn(res + hlen - 1) < 0)
-                        fmpz_neg(hc, hc);
+                       /* divide by content */
+                       _fmpz_vec_scalar_divexact_fmpz(res, res, hlen, hc);
+                       goto done;
+                    }
 
-                    _fmpz_vec_scalar_divexact_fmpz(res, res, hlen, hc);
+                    if (pbits >= bits_small) /* if one prime is already big enough to check */
+                    {
+                        /* divide by content */
+                        _fmpz_vec_content(hc, res, hlen);
 
-                    /* are we done? */
-                    if (_fmpz_poly_divides(Q, B, len2, res, hlen) &&
-                        _fmpz_poly_divides(Q, A, len1, res, hlen))
-                        break;
+                        /* correct sign of leading term */
+                        if (fmpz_sgn(res + hlen - 1) < 0)
+                            fmpz_neg(hc, hc);
 
-                    /* no, so multiply by content again */
-                    _fmpz_vec_scalar_mul_fmpz(res, res, hlen, hc);
+                        _fmpz_vec_scalar_divexact_fmpz(res, res, hlen, hc);
+
+                        /* are we done? */
+                        if (_gcd_divides(Q, A, len1, B, len2, res, hlen, p))
+                            goto done;
+
+                        /* no, so multiply by content again */
+                        _fmpz_vec_scalar_mul_fmpz(res, res, hlen, hc);
+                    }
                 }
-            }
 
-            curr_bits = FLINT_ABS(_fmpz_vec_max_bits(res, hlen));
-            fmpz_set_ui(modulus, p);
-            n = hlen - 1; /* if we reach this we have a new bound on length of result */
-            continue;
-        }
+                curr_bits = FLINT_ABS(_fmpz_vec_max_bits(res, hlen));
+                fmpz_set_ui(modulus, p);
+                n = hlen - 1; /* if we reach this we have a new bound on length of result */
+                continue;
+            }
 
-        _fmpz_poly_CRT_ui(res, res, hlen, modulus, h, hlen, mod.n, mod.ninv, 1);
-        fmpz_mul_ui(modulus, modulus, mod.n);
+            _fmpz_poly_CRT_ui(res, res, hlen, modulus, h, hlen, mod.n, mod.ninv, 1);
+            fmpz_mul_ui(modulus, modulus, mod.n);
 
-        new_bits = _fmpz_vec_max_bits(res, hlen);
-        new_bits = FLINT_ABS(new_bits);
+            new_bits = _fmpz_vec_max_bits(res, hlen);
+            new_bits = FLINT_ABS(new_bits);
 
-        if (new_bits == curr_bits || fmpz_bits(modulus) >= bits_small)
-        {
-            if (!g_pm1)
+            if (new_bits == curr_bits || fmpz_bits(modulus) >= bits_small)
             {
-                _fmpz_vec_content(hc, res, hlen);
+                if (!g_pm1)
+                {
+                    _fmpz_vec_content(hc, res, hlen);
 
-                /* correct sign of leading term */
-                if (fmpz_sgn(res + hlen - 1) < 0)
-                    fmpz_neg(hc, hc);
+                    /* correct sign of leading term */
+                    if (fmpz_sgn(res + hlen - 1) < 0)
+                        fmpz_neg(hc, hc);
 
-                /* divide by content */
-                _fmpz_vec_scalar_divexact_fmpz(res, res, hlen, hc);      
-            }
+                    /* divide by content */
+                    _fmpz_vec_scalar_divexact_fmpz(res, res, hlen, hc);      
+                }
 
-            if (fmpz_bits(modulus) + unlucky >= bound)
-                break;
+                if (fmpz_bits(modulus) + unlucky >= bound)
+                    goto done;
 
-            /* are we done? */
-            if (_fmpz_poly_divides(Q, B, len2, res, hlen) &&
-                _fmpz_poly_divides(Q, A, len1, res, hlen))
-                break;
+                /* are we done? */
+                if (_gcd_divides(Q, A, len1, B, len2, res, hlen, p))
+                    goto done;
 
-            if (!g_pm1) 
-            {            
-                /* no, so multiply by content again */
-                _fmpz_vec_scalar_mul_fmpz(res, res, hlen, hc);
+                if (!g_pm1) 
+                {            
+                    /* no, so multiply by content again */
+                    _fmpz_vec_scalar_mul_fmpz(res, res, hlen, hc);
+                }
             }
-        }
 
-        curr_bits = new_bits;
+            curr_bits = new_bits;
+        }
     }
 
+done:
+
     fmpz_clear(modulus);
     fmpz_clear(g); 
     fmpz_clear(l); 
     fmpz_clear(hc);
 
-    _nmod_vec_clear(a);
-    _nmod_vec_clear(b);
-    _nmod_vec_clear(h); 
+    flint_free(primes);
+    flint_free(hlens);
+    _nmod_vec_clear(images);
+    flint_free(args);
+    flint_free(threads);
 
     /* finally multiply by content */
     _fmpz_vec_scalar_mul_fmpz(res, res, hlen, d);
@@ -54,24 +54,42 @@ slong _fmpz_poly_hensel_continue_lift(fmpz_poly_factor_t lifted_fac,
     }
 
     {
-        slong *e, n = 3 + FLINT_FLOG2(N - prev);
+        slong *e, *s, *inv, k, m, n = 3 + FLINT_FLOG2(N - prev);
 
-        e = flint_malloc(n * sizeof(slong));
+        e = flint_malloc(3 * n * sizeof(slong));
+        s = e + n;
+        inv = s + n;
 
         for (e[i = 0] = N; e[i] > curr; i++)
             e[i + 1] = (e[i] + 1) / 2;
         e[i]   = curr;
         e[i+1] = prev;
 
+        /*
+            Lift through the whole schedule in one traversal of the tree:
+            first the inverses from prev to curr, then all the doubling
+            steps, keeping the inverses for all but the final one.
+         */
+        m = 0;
+        s[0] = e[i+1];
+
         if (prev < curr)
-            fmpz_poly_hensel_lift_tree(link, v, w, monic_f, r, p, e[i+1], e[i], -1);
+        {
+            s[1] = e[i];
+            inv[0] = -1;
+            m = 1;
+        }
 
-        for (i--; i > 0; i--)
-            fmpz_poly_hensel_lift_tree(link, v, w, monic_f, r, p, e[i+1], e[i], 1);
+        for (k = i - 1; k >= 0; k--)
+        {
+            s[m + 1] = e[k];
+            inv[m] = (k == 0) ? 0 : 1;
+            m++;
+        }
 
-        fmpz_poly_hensel_lift_tree(link, v, w, monic_f, r, p, e[i+1], e[i], 0);
+        fmpz_poly_hensel_lift_tree_multi(link, v, w, monic_f, r, p, s, inv, m);
 
-        new_prev = e[i+1];
+        new_prev = (i > 0) ? e[1] : e[i+1];
 
         flint_free(e);
     }
@@ -18,17 +18,10 @@
 void fmpz_poly_hensel_lift_tree(slong *link, fmpz_poly_t *v, fmpz_poly_t *w, 
     fmpz_poly_t f, slong r, const fmpz_t p, slong e0, slong e1, slong inv)
 {
-    fmpz_t p0, p1;
+    slong e[2];
 
-    fmpz_init(p0);
-    fmpz_init(p1);
+    e[0] = e0;
+    e[1] = e1;
 
-    fmpz_pow_ui(p0, p, e0);
-    fmpz_pow_ui(p1, p, e1 - e0);
-
-    fmpz_poly_hensel_lift_tree_recursive(link, v, w, f, 2*r - 4, inv, p0, p1);
-
-    fmpz_clear(p0);
-    fmpz_clear(p1);
+    fmpz_poly_hensel_lift_tree_multi(link, v, w, f, r, p, e, &inv, 1);
 }
-
@@ -0,0 +1,140 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+
+typedef struct
+{
+    slong * link;
+    fmpz_poly_t * v;
+    fmpz_poly_t * w;
+    fmpz_poly_struct * f;
+    slong j;
+    const slong * inv;
+    const fmpz * p0;
+    const fmpz * p1;
+    slong n;
+    slong num_threads;
+}
+lift_arg_t;
+
+static void
+_lift_node(slong * link, fmpz_poly_t * v, fmpz_poly_t * w, fmpz_poly_t f,
+       slong j, const slong * inv, const fmpz * p0, const fmpz * p1, slong n)
+{
+    slong k;
+
+    for (k = 0; k < n; k++)
+    {
+        if (inv[k] == 1)
+            fmpz_poly_hensel_lift(v[j], v[j + 1], w[j], w[j + 1], f,
+                                  v[j], v[j + 1], w[j], w[j + 1],
+                                  p0 + k, p1 + k);
+        else if (inv[k] == -1)
+            fmpz_poly_hensel_lift_only_inverse(w[j], w[j + 1],
+                                 v[j], v[j + 1], w[j], w[j + 1], p0 + k, p1 + k);
+        else
+            fmpz_poly_hensel_lift_without_inverse(v[j], v[j + 1], f,
+                                                  v[j], v[j + 1], w[j], w[j + 1],
+                                                  p0 + k, p1 + k);
+    }
+}
+
+static void * _lift_worker(void * arg_ptr);
+
+/*
+   Each node is lifted through all the steps before its children, which
+   only read it. The results agree with lifting the whole tree one step
+   at a time, since each step at a node only depends on its parent modulo
+   the target of that step, and lifting does not change lower residues.
+*/
+static void
+_lift_recursive(slong * link, fmpz_poly_t * v, fmpz_poly_t * w,
+       fmpz_poly_t f, slong j, const slong * inv, const fmpz * p0,
+       const fmpz * p1, slong n, slong num_threads)
+{
+    if (j < 0)
+        return;
+
+    _lift_node(link, v, w, f, j, inv, p0, p1, n);
+
+    /* the two subtrees are disjoint, lift them concurrently */
+    if (num_threads > 1 && link[j] >= 0 && link[j + 1] >= 0)
+    {
+        pthread_t thread;
+        lift_arg_t arg;
+
+        arg.link = link;
+        arg.v = v;
+        arg.w = w;
+        arg.f = v[j];
+        arg.j = link[j];
+        arg.inv = inv;
+        arg.p0 = p0;
+        arg.p1 = p1;
+        arg.n = n;
+        arg.num_threads = num_threads / 2;
+
+        pthread_create(&thread, NULL, _lift_worker, &arg);
+
+        _lift_recursive(link, v, w, v[j + 1], link[j + 1], inv, p0, p1, n,
+                                                num_threads - num_threads / 2);
+
+        pthread_join(thread, NULL);
+    }
+    else
+    {
+        _lift_recursive(link, v, w, v[j], link[j], inv, p0, p1, n, num_threads);
+        _lift_recursive(link, v, w, v[j + 1], link[j + 1], inv, p0, p1, n,
+                                                                   num_threads);
+    }
+}
+
+static void *
+_lift_worker(void * arg_ptr)
+{
+    lift_arg_t arg = *((lift_arg_t *) arg_ptr);
+
+    _lift_recursive(arg.link, arg.v, arg.w, arg.f, arg.j, arg.inv,
+                    arg.p0, arg.p1, arg.n, arg.num_threads);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void fmpz_poly_hensel_lift_tree_multi(slong *link, fmpz_poly_t *v,
+    fmpz_poly_t *w, fmpz_poly_t f, slong r, const fmpz_t p, const slong * e,
+    const slong * inv, slong n)
+{
+    slong k;
+    fmpz * p0, * p1;
+
+    if (n < 1)
+        return;
+
+    p0 = _fmpz_vec_init(2*n);
+    p1 = p0 + n;
+
+    for (k = 0; k < n; k++)
+    {
+        fmpz_pow_ui(p0 + k, p, e[k]);
+        fmpz_pow_ui(p1 + k, p, e[k + 1] - e[k]);
+    }
+
+    _lift_recursive(link, v, w, f, 2*r - 4, inv, p0, p1, n,
+                                                      flint_get_num_threads());
+
+    _fmpz_vec_clear(p0, 2*n);
+}
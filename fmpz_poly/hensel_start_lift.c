@@ -58,24 +58,28 @@ slong _fmpz_poly_hensel_start_lift(fmpz_poly_factor_t lifted_fac, slong *link,
     fmpz_poly_hensel_build_tree(link, v, w, local_fac);
 
     {
-        slong *e, n = FLINT_CLOG2(N) + 1;
+        slong *e, *s, *inv, k, n = FLINT_CLOG2(N) + 1;
+
+        e = flint_malloc(3 * n * sizeof(slong));
+        s = e + n;
+        inv = s + n;
 
-        e = flint_malloc(n * sizeof(slong));
         for (e[i = 0] = N; e[i] > 1; i++)
             e[i + 1] = (e[i] + 1) / 2;
 
-        for (i--; i > 0; i--)
-        {
-            fmpz_poly_hensel_lift_tree(link, v, w, monic_f, r, 
-                p, e[i+1], e[i], 1);
-        }
-        if (N > 1)
+        /*
+            Lift through the whole schedule in one traversal of the tree,
+            keeping the inverses for all but the final step.
+         */
+        for (k = 0; k <= i; k++)
         {
-            fmpz_poly_hensel_lift_tree(link, v, w, monic_f, r, 
-                p, e[i+1], e[i], 0);
+            s[k] = e[i - k];
+            inv[k] = (k == i - 1) ? 0 : 1;
         }
 
-        preve = e[i+1];
+        fmpz_poly_hensel_lift_tree_multi(link, v, w, monic_f, r, p, s, inv, i);
+
+        preve = (i > 0) ? e[1] : e[0];
 
         flint_free(e);
     }
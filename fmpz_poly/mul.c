@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2008, 2009 William Hart
     Copyright (C) 2014 Fredrik Johansson
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -15,6 +16,7 @@
 #include "fmpz.h"
 #include "fmpz_vec.h"
 #include "fmpz_poly.h"
+#include "instrument.h"
 
 void
 _fmpz_poly_mul_tiny1(fmpz * res, const fmpz * poly1,
@@ -124,19 +126,22 @@ _fmpz_poly_mul(fmpz * res, const fmpz * poly1,
 
         if (rbits <= FLINT_BITS - 2)
         {
-            _fmpz_poly_mul_tiny1(res, poly1, len1, poly2, len2);
+            FLINT_INSTR(FLINT_INSTR_FMPZ_POLY_MUL_TINY1, len1, len2,
+                _fmpz_poly_mul_tiny1(res, poly1, len1, poly2, len2));
             return;
         }
         else if (rbits <= 2 * FLINT_BITS - 1)
         {
-            _fmpz_poly_mul_tiny2(res, poly1, len1, poly2, len2);
+            FLINT_INSTR(FLINT_INSTR_FMPZ_POLY_MUL_TINY2, len1, len2,
+                _fmpz_poly_mul_tiny2(res, poly1, len1, poly2, len2));
             return;
         }
     }
 
     if (len2 < 7)
     {
-        _fmpz_poly_mul_classical(res, poly1, len1, poly2, len2);
+        FLINT_INSTR(FLINT_INSTR_FMPZ_POLY_MUL_CLASSICAL, len1, len2,
+            _fmpz_poly_mul_classical(res, poly1, len1, poly2, len2));
         return;
     }
 
@@ -144,15 +149,16 @@ _fmpz_poly_mul(fmpz * res, const fmpz * poly1,
     limbs2 = (bits2 + FLINT_BITS - 1) / FLINT_BITS;
 
     if (len1 < 16 && (limbs1 > 12 || limbs2 > 12))
-        _fmpz_poly_mul_karatsuba(res, poly1, len1, poly2, len2);
-    else if (limbs1 + limbs2 <= 8)
-        _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2);
-    else if ((limbs1+limbs2)/2048 > len1 + len2)
-        _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2);
-    else if ((limbs1 + limbs2)*FLINT_BITS*4 < len1 + len2)
-       _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2);
+        FLINT_INSTR(FLINT_INSTR_FMPZ_POLY_MUL_KARATSUBA, len1, len2,
+            _fmpz_poly_mul_karatsuba(res, poly1, len1, poly2, len2));
+    else if (limbs1 + limbs2 <= 8
+          || (limbs1+limbs2)/2048 > len1 + len2
+          || (limbs1 + limbs2)*FLINT_BITS*4 < len1 + len2)
+        FLINT_INSTR(FLINT_INSTR_FMPZ_POLY_MUL_KS, len1, len2,
+            _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2));
     else
-       _fmpz_poly_mul_SS(res, poly1, len1, poly2, len2);
+        FLINT_INSTR(FLINT_INSTR_FMPZ_POLY_MUL_SS, len1, len2,
+            _fmpz_poly_mul_SS(res, poly1, len1, poly2, len2));
 }
 
 void
@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "bin_io.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("fwrite_bin....");
+#if !defined( _MSC_VER )
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c;
+        flint_bin_map_t map;
+        size_t s = 0;
+        FILE * f = fopen("fmpz_poly_bin_test", "wb");
+
+        if (!f)
+        {
+            flint_printf("Error: unable to open file for writing.\n");
+            abort();
+        }
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_randtest(a, state, n_randint(state, 100), n_randint(state, 300));
+        fmpz_poly_randtest(b, state, n_randint(state, 100), n_randint(state, 300));
+
+        result = fmpz_poly_fwrite_bin(f, a);
+        fclose(f);
+
+        f = fopen("fmpz_poly_bin_test", "rb");
+        result = result && fmpz_poly_fread_bin(f, b) && fmpz_poly_equal(a, b);
+        fclose(f);
+
+        if (result && flint_bin_map(map, "fmpz_poly_bin_test"))
+        {
+            s = fmpz_poly_bin_view_init(c, map->data, map->size);
+            result = (s == map->size && fmpz_poly_equal(a, c));
+            fmpz_poly_bin_view_clear(c);
+
+            flint_bin_unmap(map);
+        } else
+            result = 0;
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("s = %wu\n", (ulong) s);
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(b), flint_printf("\n\n");
+            remove("fmpz_poly_bin_test");
+            abort();
+        }
+
+        if (remove("fmpz_poly_bin_test"))
+        {
+            flint_printf("Error, unable to delete file fmpz_poly_bin_test\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+#else
+    flint_printf("SKIPPED\n");
+#endif
+    return 0;
+}
@@ -179,6 +179,50 @@ main(void)
         fmpz_poly_clear(r);
     }
 
+    /* Check that a == GCD(af, ag) when GCD(f, g) = 1, with threads */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, d, f, g;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(d);
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
+        fmpz_poly_randtest_not_zero(a, state, n_randint(state, 100) + 1, 200);
+        do {
+           fmpz_poly_randtest(f, state, n_randint(state, 100) + 64, 100);
+           fmpz_poly_randtest(g, state, n_randint(state, 100) + 64, 100);
+           fmpz_poly_gcd_heuristic(d, f, g);
+        } while (!(d->length == 1 && fmpz_is_one(d->coeffs)));
+
+        fmpz_poly_mul(f, a, f);
+        fmpz_poly_mul(g, a, g);
+        fmpz_poly_gcd_modular(d, f, g);
+
+        if (!_t_gcd_is_canonical(a)) fmpz_poly_neg(a, a);
+
+        result = fmpz_poly_equal(d, a) && _t_gcd_is_canonical(d);
+        if (!result)
+        {
+           flint_printf("FAIL (check a == gcd(af, ag) with threads):\n");
+           flint_printf("f = "), fmpz_poly_print(f), flint_printf("\n");
+           flint_printf("g = "), fmpz_poly_print(g), flint_printf("\n");
+           flint_printf("a = "), fmpz_poly_print(a), flint_printf("\n");
+           flint_printf("d = "), fmpz_poly_print(d), flint_printf("\n");
+           abort();
+        } 
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(d);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+    }
+
+    flint_set_num_threads(1);
+
     /* Sebastian's test case */
     {
         fmpz_poly_t a, b, d;
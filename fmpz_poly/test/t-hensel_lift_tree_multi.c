@@ -0,0 +1,157 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("hensel_lift_tree_multi....");
+    fflush(stdout);
+
+    /* Check lifting through a schedule in one traversal agrees with
+       lifting the tree one step at a time */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t F, G;
+        nmod_poly_t f;
+        nmod_poly_factor_t f_fac;
+        fmpz_poly_t *v, *w, *v2, *w2;
+        slong *link, *link2, e[8], inv[7];
+        slong j, k, r, n, num, N;
+        mp_limb_t p;
+        fmpz_t P, p0, p1;
+
+        p = n_randprime(state, n_randint(state, 8) + 2, 0);
+        num = n_randint(state, 6) + 2;
+
+        fmpz_poly_init(F);
+        fmpz_poly_init(G);
+        nmod_poly_init(f, p);
+        nmod_poly_factor_init(f_fac);
+        fmpz_init(P);
+        fmpz_init(p0);
+        fmpz_init(p1);
+        fmpz_set_ui(P, p);
+
+        do {
+            fmpz_poly_one(F);
+            for (j = 0; j < num; j++)
+            {
+                do {
+                    fmpz_poly_randtest(G, state, n_randint(state, 20) + 2, 30);
+                } while (G->length < 2);
+                fmpz_one(fmpz_poly_lead(G));
+                fmpz_poly_mul(F, F, G);
+            }
+
+            fmpz_poly_get_nmod_poly(f, F);
+        } while (!nmod_poly_is_squarefree(f));
+
+        nmod_poly_factor(f_fac, f);
+        r = f_fac->num;
+
+        if (r < 2)
+            goto cleanup;
+
+        link = flint_malloc(2 * (2*r - 2) * sizeof(slong));
+        link2 = link + (2*r - 2);
+        v = flint_malloc(4 * (2*r - 2) * sizeof(fmpz_poly_t));
+        w = v + (2*r - 2);
+        v2 = w + (2*r - 2);
+        w2 = v2 + (2*r - 2);
+
+        for (j = 0; j < 2*r - 2; j++)
+        {
+            fmpz_poly_init(v[j]);
+            fmpz_poly_init(w[j]);
+            fmpz_poly_init(v2[j]);
+            fmpz_poly_init(w2[j]);
+        }
+
+        fmpz_poly_hensel_build_tree(link, v, w, f_fac);
+        fmpz_poly_hensel_build_tree(link2, v2, w2, f_fac);
+
+        /* a schedule of up to 7 steps, each at most doubling */
+        n = n_randint(state, 7) + 1;
+        e[0] = 1;
+        for (k = 0; k < n; k++)
+        {
+            e[k + 1] = e[k] + 1 + n_randint(state, e[k]);
+            inv[k] = (k == n - 1 && n_randint(state, 2)) ? 0 : 1;
+        }
+        N = e[n];
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        fmpz_poly_hensel_lift_tree_multi(link, v, w, F, r, P, e, inv, n);
+
+        for (k = 0; k < n; k++)
+        {
+            fmpz_pow_ui(p0, P, e[k]);
+            fmpz_pow_ui(p1, P, e[k + 1] - e[k]);
+            fmpz_poly_hensel_lift_tree_recursive(link2, v2, w2, F,
+                                                 2*r - 4, inv[k], p0, p1);
+        }
+
+        result = 1;
+        for (j = 0; j < 2*r - 2; j++)
+        {
+            result &= fmpz_poly_equal(v[j], v2[j]);
+            if (inv[n - 1] != 0)
+                result &= fmpz_poly_equal(w[j], w2[j]);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("p = %wu, r = %wd, N = %wd\n", p, r, N);
+            fmpz_poly_print(F); flint_printf("\n\n");
+            abort();
+        }
+
+        for (j = 0; j < 2*r - 2; j++)
+        {
+            fmpz_poly_clear(v[j]);
+            fmpz_poly_clear(w[j]);
+            fmpz_poly_clear(v2[j]);
+            fmpz_poly_clear(w2[j]);
+        }
+        flint_free(link);
+        flint_free(v);
+
+cleanup:
+        nmod_poly_factor_clear(f_fac);
+        nmod_poly_clear(f);
+        fmpz_poly_clear(F);
+        fmpz_poly_clear(G);
+        fmpz_clear(P);
+        fmpz_clear(p0);
+        fmpz_clear(p1);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
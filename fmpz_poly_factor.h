@@ -73,6 +73,9 @@ FLINT_DLL void _fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t final_fac,
 FLINT_DLL void fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t fac, 
                                                           const fmpz_poly_t G);
 
+/* number of local factors below which CLD data is computed serially */
+#define FMPZ_POLY_FACTOR_CLD_MAT_THREADED_CUTOFF 8
+
 FLINT_DLL slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
                              fmpz_poly_factor_t lifted_fac, fmpz_t P, ulong k);
 
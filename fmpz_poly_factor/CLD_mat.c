@@ -1,5 +1,5 @@
 /*
-    Copyright (C) 2011, 2016 William Hart
+    Copyright (C) 2011, 2016, 2018 William Hart
     Copyright (C) 2011 Andy Novocin
 
     This file is part of FLINT.
@@ -10,8 +10,18 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
-#include <gmp.h>
+#undef ulong
+#define ulong ulongxx/* interferes with system includes */
+
+#include <pthread.h>
 #include <stdlib.h>
+
+#undef ulong
+
+#include <gmp.h>
+
+#define ulong mp_limb_t
+
 #include "flint.h"
 #include "fmpz.h"
 #include "fmpz_poly.h"
@@ -19,6 +29,99 @@
 
 #include "fmpz_mod_poly.h"
 
+typedef struct
+{
+   fmpz_mat_struct * res;
+   const fmpz_poly_struct * f;
+   const fmpz_poly_factor_struct * lifted_fac;
+   const fmpz * P;
+   slong lo_n;
+   slong hi_n;
+   slong start;
+   slong step;
+}
+_CLD_rows_arg_t;
+
+/*
+   Compute the CLD data for the local factors start, start + step, ...
+   Each row only depends on its own factor, so distinct rows may be
+   computed concurrently.
+*/
+static void
+_CLD_rows(_CLD_rows_arg_t * arg)
+{
+   fmpz_mat_struct * res = arg->res;
+   const fmpz_poly_struct * f = arg->f;
+   const fmpz_poly_factor_struct * lifted_fac = arg->lifted_fac;
+   const slong lo_n = arg->lo_n, hi_n = arg->hi_n, r = lifted_fac->num;
+   slong i, zeroes;
+   fmpz_poly_t gd, gcld, temp;
+   fmpz_poly_t trunc_f, trunc_fac; /* don't initialise trunc_f, trunc_fac */
+   const fmpz * P = arg->P;
+
+   fmpz_poly_init(gd);
+   fmpz_poly_init(gcld);
+   /* do not initialise trunc_f */
+   /* do not initialise trunc_fac */
+
+   if (lo_n > 0)
+   {
+      for (i = arg->start; i < r; i += arg->step)
+      {
+         zeroes = 0;
+         while (fmpz_is_zero(lifted_fac->p[i].coeffs + zeroes))
+            zeroes++;
+
+         fmpz_poly_attach_truncate(trunc_fac, lifted_fac->p + i, lo_n + zeroes + 1);
+         fmpz_poly_derivative(gd, trunc_fac);
+         fmpz_poly_mullow(gcld, f, gd, lo_n + zeroes);
+         fmpz_poly_divlow_smodp(res->rows[i], gcld, trunc_fac, P, lo_n);
+      }
+   }
+
+   if (hi_n > 0)
+   {
+      fmpz_poly_init(temp);
+
+      fmpz_poly_attach_shift(trunc_f, f, f->length - hi_n);
+
+      for (i = arg->start; i < r; i += arg->step)
+      {
+         slong len = lifted_fac->p[i].length - hi_n - 1;
+
+         if (len < 0)
+         {
+            fmpz_poly_shift_left(temp, lifted_fac->p + i, -len);
+            fmpz_poly_derivative(gd, temp);
+            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
+            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, temp, P, hi_n);
+         } else
+         {
+            fmpz_poly_attach_shift(trunc_fac, lifted_fac->p + i, len);
+            fmpz_poly_derivative(gd, trunc_fac);
+            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
+            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, trunc_fac, P, hi_n);
+         }
+      }
+
+      fmpz_poly_clear(temp);
+   }
+
+   /* do not clear trunc_fac */
+   /* do not clear trunc_f */
+   fmpz_poly_clear(gd);
+   fmpz_poly_clear(gcld);
+}
+
+static void *
+_CLD_rows_worker(void * arg_ptr)
+{
+   _CLD_rows((_CLD_rows_arg_t *) arg_ptr);
+
+   flint_cleanup();
+   return NULL;
+}
+
 slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
                               fmpz_poly_factor_t lifted_fac, fmpz_t P, ulong k)
 {
@@ -30,10 +133,8 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
       initialised to be of size (r + 1, 2k).
    */
 
-   slong i, zeroes, bound, lo_n, hi_n, r = lifted_fac->num;
+   slong i, bound, lo_n, hi_n, num_threads, r = lifted_fac->num;
    slong bit_r = FLINT_MAX(r, 20);
-   fmpz_poly_t gd, gcld, temp;
-   fmpz_poly_t trunc_f, trunc_fac; /* don't initialise trunc_f, trunc_fac */
    fmpz_t t;
 
    /* insert CLD bounds in last row of matrix */
@@ -70,54 +171,45 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
 
    fmpz_clear(t);
 
-   /* now insert data into matrix */
+   /* now insert data into matrix, one stride of local factors per thread */
 
-   fmpz_poly_init(gd);
-   fmpz_poly_init(gcld);
-   /* do not initialise trunc_f */
-   /* do not initialise trunc_fac */
-
-   if (lo_n > 0)
+   if (lo_n + hi_n > 0 && r > 0)
    {
-      for (i = 0; i < r; i++)
-      {
-         zeroes = 0;
-         while (lifted_fac->p[i].coeffs + zeroes)
-            zeroes++;
+      _CLD_rows_arg_t * args;
+      pthread_t * threads;
 
-         fmpz_poly_attach_truncate(trunc_fac, lifted_fac->p + i, lo_n + zeroes + 1);
-         fmpz_poly_derivative(gd, trunc_fac);
-         fmpz_poly_mullow(gcld, f, gd, lo_n + zeroes);
-         fmpz_poly_divlow_smodp(res->rows[i], gcld, trunc_fac, P, lo_n);
-      }      
-   }
+      num_threads = flint_get_num_threads();
 
-   if (hi_n > 0)
-   {
-      fmpz_poly_init(temp);
+      if (r < FMPZ_POLY_FACTOR_CLD_MAT_THREADED_CUTOFF)
+         num_threads = 1;
+      else
+         num_threads = FLINT_MIN(num_threads, r);
 
-      fmpz_poly_attach_shift(trunc_f, f, f->length - hi_n);
-      
-      for (i = 0; i < r; i++)
-      {
-         slong len = lifted_fac->p[i].length - hi_n - 1;
+      args = flint_malloc(num_threads*sizeof(_CLD_rows_arg_t));
+      threads = flint_malloc(num_threads*sizeof(pthread_t));
 
-         if (len < 0)
-         {
-            fmpz_poly_shift_left(temp, lifted_fac->p + i, -len);
-            fmpz_poly_derivative(gd, temp);
-            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
-            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, temp, P, hi_n);
-         } else
-         {
-            fmpz_poly_attach_shift(trunc_fac, lifted_fac->p + i, len);
-            fmpz_poly_derivative(gd, trunc_fac);
-            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
-            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, trunc_fac, P, hi_n);
-         }
+      for (i = 0; i < num_threads; i++)
+      {
+         args[i].res = res;
+         args[i].f = f;
+         args[i].lifted_fac = lifted_fac;
+         args[i].P = P;
+         args[i].lo_n = lo_n;
+         args[i].hi_n = hi_n;
+         args[i].start = i;
+         args[i].step = num_threads;
       }
 
-      fmpz_poly_clear(temp);      
+      for (i = 1; i < num_threads; i++)
+         pthread_create(&threads[i], NULL, _CLD_rows_worker, &args[i]);
+
+      _CLD_rows(&args[0]);
+
+      for (i = 1; i < num_threads; i++)
+         pthread_join(threads[i], NULL);
+
+      flint_free(args);
+      flint_free(threads);
    }
 
    if (hi_n > 0)
@@ -127,11 +219,6 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
          fmpz_set(res->rows[r] + lo_n + i, res->rows[r] + 2*k - hi_n + i);
    }
 
-   /* do not clear trunc_fac */
-   /* do not clear trunc_f */
-   fmpz_poly_clear(gd);
-   fmpz_poly_clear(gcld);
-
    return lo_n + hi_n;
 }
 
@@ -12,9 +12,181 @@
 */
 
 #include <stdlib.h>
+#include <pthread.h>
 #include "fmpz_poly.h"
+#include "fmpz_poly_factor.h"
 
-#define TRACE 0
+/*
+   Data shared by the threads testing the subsets of size k of the
+   local factors avail[0], ..., avail[m - 1] in one round.
+*/
+typedef struct
+{
+    const fmpz_poly_factor_struct * lifted_fac;
+    const fmpz_poly_struct * f;
+    const fmpz * P;
+    const fmpz * lead;          /* leading coefficient of f */
+    const fmpz * cnst;          /* lead * f(0), or NULL to skip the test */
+    const fmpz * trace_bound;   /* bound on the traces, or NULL */
+    const fmpz * c;             /* constant terms of the local factors */
+    const fmpz * t;             /* traces of the local factors */
+    const slong * avail;
+    slong m;
+    slong k;
+    slong * used;               /* local factors already in a factor */
+    fmpz_poly_struct * hits;
+    slong * hit_idx;
+    slong * hit_sub;
+    slong num_hits;
+    pthread_mutex_t mutex;
+}
+recomb_round_struct;
+
+typedef struct
+{
+    recomb_round_struct * R;
+    slong thread;
+    slong num_threads;
+}
+recomb_arg_t;
+
+/* Steps to the next k-subset of {0, ..., m - 1} in lex order */
+static int
+_next_subset(slong * sub, slong k, slong m)
+{
+    slong i, l;
+
+    for (i = k - 1; i >= 0 && sub[i] == m - k + i; i--) ;
+
+    if (i < 0)
+        return 0;
+
+    sub[i]++;
+    for (l = i + 1; l < k; l++)
+        sub[l] = sub[l - 1] + 1;
+
+    return 1;
+}
+
+static void *
+_recomb_worker(void * arg_ptr)
+{
+    recomb_arg_t arg = *((recomb_arg_t *) arg_ptr);
+    recomb_round_struct * R = arg.R;
+    const slong k = R->k, m = R->m;
+    slong i, l, idx, * sub, * lused;
+    fmpz_poly_t tryme, Q;
+    fmpz_t s;
+    int ok;
+
+    sub = flint_malloc((k + m) * sizeof(slong));
+    lused = sub + k;
+
+    fmpz_poly_init(tryme);
+    fmpz_poly_init(Q);
+    fmpz_init(s);
+
+    pthread_mutex_lock(&R->mutex);
+    for (i = 0; i < m; i++)
+        lused[i] = R->used[R->avail[i]];
+    pthread_mutex_unlock(&R->mutex);
+
+    for (l = 0; l < k; l++)
+        sub[l] = l;
+
+    idx = 0;
+
+    do
+    {
+        if (idx++ % arg.num_threads != arg.thread)
+            continue;
+
+        for (l = 0; l < k && !lused[sub[l]]; l++) ;
+
+        if (l < k)
+            continue;
+
+        /* the x^{d-1} coefficient of lead * g_1 ... g_k is bounded */
+        if (R->trace_bound != NULL)
+        {
+            fmpz_zero(s);
+            for (l = 0; l < k; l++)
+                fmpz_add(s, s, R->t + R->avail[sub[l]]);
+            fmpz_mul(s, s, R->lead);
+            fmpz_mods(s, s, R->P);
+
+            if (fmpz_cmpabs(s, R->trace_bound) > 0)
+                continue;
+        }
+
+        /* the constant coefficient divides lead * f(0) */
+        if (R->cnst != NULL)
+        {
+            fmpz_set(s, R->lead);
+            for (l = 0; l < k; l++)
+            {
+                fmpz_mul(s, s, R->c + R->avail[sub[l]]);
+                fmpz_mod(s, s, R->P);
+            }
+            fmpz_mods(s, s, R->P);
+
+            fmpz_abs(s, s);
+
+            if (fmpz_is_zero(s) || !fmpz_divisible(R->cnst, s))
+                continue;
+        }
+
+        fmpz_poly_set_fmpz(tryme, R->lead);
+        for (l = 0; l < k; l++)
+            fmpz_poly_mul(tryme, tryme, R->lifted_fac->p + R->avail[sub[l]]);
+
+        fmpz_poly_scalar_smod_fmpz(tryme, tryme, R->P);
+        fmpz_poly_primitive_part(tryme, tryme);
+
+        ok = fmpz_poly_divides(Q, R->f, tryme);
+
+        /* record the factor and pick up those found by other threads */
+        pthread_mutex_lock(&R->mutex);
+
+        if (ok)
+        {
+            for (l = 0; l < k && !R->used[R->avail[sub[l]]]; l++) ;
+
+            if (l == k)
+            {
+                fmpz_poly_swap(R->hits + R->num_hits, tryme);
+                R->hit_idx[R->num_hits] = idx - 1;
+                for (l = 0; l < k; l++)
+                {
+                    R->hit_sub[R->num_hits * k + l] = R->avail[sub[l]];
+                    R->used[R->avail[sub[l]]] = 1;
+                }
+                R->num_hits++;
+            }
+        }
+
+        for (i = 0; i < m; i++)
+            lused[i] = R->used[R->avail[i]];
+
+        pthread_mutex_unlock(&R->mutex);
+    }
+    while (_next_subset(sub, k, m));
+
+    fmpz_poly_clear(tryme);
+    fmpz_poly_clear(Q);
+    fmpz_clear(s);
+    flint_free(sub);
+
+    return NULL;
+}
+
+static void *
+_recomb_thread(void * arg_ptr)
+{
+    _recomb_worker(arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
 
 void fmpz_poly_factor_zassenhaus_recombination(fmpz_poly_factor_t final_fac, 
 	const fmpz_poly_factor_t lifted_fac, 
@@ -22,111 +194,163 @@ void fmpz_poly_factor_zassenhaus_recombination(fmpz_poly_factor_t final_fac,
 {
     const slong r = lifted_fac->num;
 
-    slong k, *used_arr, *sub_arr;
-    fmpz_poly_t f, Q, R, tryme;
-    fmpz *leadF;
+    slong i, j, k, m, num_threads;
+    slong * used, * avail, * perm;
+    fmpz * c, * t;
+    fmpz_t cnst, bound, u;
+    fmpz_poly_t f;
+    recomb_round_struct R;
+
+    used = flint_calloc(5 * r + r * r, sizeof(slong));
+    avail = used + r;
+    perm = avail + r;
+    R.hit_idx = perm + r;
+    R.hit_sub = R.hit_idx + r;
+
+    c = _fmpz_vec_init(2 * r);
+    t = c + r;
 
-    used_arr = flint_calloc(2 * r, sizeof(slong));
-    sub_arr  = used_arr + r;
+    R.hits = flint_malloc(r * sizeof(fmpz_poly_struct));
+    for (i = 0; i < r; i++)
+        fmpz_poly_init(R.hits + i);
 
+    fmpz_init(cnst);
+    fmpz_init(bound);
+    fmpz_init(u);
     fmpz_poly_init(f);
-    fmpz_poly_init(Q);
-    fmpz_poly_init(R);
-    fmpz_poly_init(tryme);
     fmpz_poly_set(f, F);
 
-#if TRACE == 1
-    fmpz_poly_factor_print(lifted_fac); flint_printf(" lifted_fac\n");
-#endif
+    /* constant terms and traces of the monic local factors */
+    for (i = 0; i < r; i++)
+    {
+        const fmpz_poly_struct * g = lifted_fac->p + i;
+
+        fmpz_set(c + i, g->coeffs + 0);
+        if (g->length >= 2)
+            fmpz_set(t + i, g->coeffs + g->length - 2);
+    }
+
+    num_threads = flint_get_num_threads();
+    pthread_mutex_init(&R.mutex, NULL);
 
-    leadF = fmpz_poly_lead(F);
+    R.lifted_fac = lifted_fac;
+    R.f = f;
+    R.P = P;
+    R.c = c;
+    R.t = t;
+    R.used = used;
+    R.avail = avail;
 
-    for (k = 1; k < r; k++)
+    m = r;
+
+    /*
+       Once all factors made from fewer than k local factors have been
+       removed, the cofactor is irreducible if fewer than 2k local factors
+       remain.
+    */
+    for (k = 1; 2 * k <= m; k++)
     {
-        slong count = 0, indx = k - 1, l;
+        slong len = f->length;
+        slong nt;
+
+        /* lead * f(0) and a bound on the traces, if P determines them */
+        fmpz_mul(cnst, fmpz_poly_lead(f), f->coeffs + 0);
+        fmpz_mul_2exp(u, cnst, 1);
+        R.cnst = (!fmpz_is_zero(cnst) && fmpz_cmpabs(u, P) < 0) ? cnst : NULL;
+
+        fmpz_zero(bound);
+        for (i = 0; i < len - 1; i++)
+            if (fmpz_cmpabs(f->coeffs + i, bound) > 0)
+                fmpz_abs(bound, f->coeffs + i);
+        fmpz_abs(u, fmpz_poly_lead(f));
+        fmpz_add(bound, bound, u);
+        fmpz_mul_ui(bound, bound, len - 1);
+        fmpz_mul_2exp(u, bound, 1);
+        R.trace_bound = (fmpz_cmpabs(u, P) < 0) ? bound : NULL;
 
-        for(l = 0; l < k; l++)
-            sub_arr[l] = l;
+        for (i = 0, j = 0; i < r; i++)
+            if (!used[i])
+                avail[j++] = i;
 
-        sub_arr[indx]--;
-        while ((indx >= 0))
+        R.lead = fmpz_poly_lead(f);
+        R.m = m;
+        R.k = k;
+        R.num_hits = 0;
+
+        nt = num_threads;
+        if (m < 8)
+            nt = 1;
+
+        if (nt <= 1)
         {
-            sub_arr[indx] = sub_arr[indx] + 1;
+            recomb_arg_t arg;
 
-            for (l = indx + 1; l < k; l++)
-                sub_arr[l] = sub_arr[l - 1] + 1;
+            arg.R = &R;
+            arg.thread = 0;
+            arg.num_threads = 1;
 
-            if (sub_arr[k - 1] > r - 1)
-                indx--;
-            else
-            {
-                for(l = 0; l < k; l++)
-                {
-                    if (used_arr[sub_arr[l]] == 1)
-                        break;
-                }
+            _recomb_worker(&arg);
+        }
+        else
+        {
+            pthread_t * threads;
+            recomb_arg_t * args;
 
-             /* Need to involve leadF, perhaps set coeff 0 to leadF and do 
-                leadF * rest and check if under M_bits... here I'm using a 
-                trial division... */
-                fmpz_poly_set_fmpz(tryme, leadF);
+            threads = flint_malloc(nt * sizeof(pthread_t));
+            args = flint_malloc(nt * sizeof(recomb_arg_t));
 
-                for(l = 0; l < k; l++)
-                    fmpz_poly_mul(tryme, tryme, lifted_fac->p + (sub_arr[l]));
+            for (i = 0; i < nt; i++)
+            {
+                args[i].R = &R;
+                args[i].thread = i;
+                args[i].num_threads = nt;
 
-                fmpz_poly_scalar_smod_fmpz(tryme, tryme, P);
-                fmpz_poly_primitive_part(tryme, tryme);
-                fmpz_poly_divrem(Q, R, f, tryme);
+                pthread_create(&threads[i], NULL, _recomb_thread, &args[i]);
+            }
 
-#if TRACE == 1
-                fmpz_poly_print(tryme); flint_printf(" is tryme\n");
-                fmpz_poly_print(R); flint_printf(" is R\n");
-#endif
+            for (i = 0; i < nt; i++)
+                pthread_join(threads[i], NULL);
 
-                if (fmpz_poly_is_zero(R))
-                {
-                    fmpz_poly_factor_insert(final_fac, tryme, exp);
-
-                    for(l = 0; l < k; l++)
-                    {
-                        used_arr[sub_arr[l]] = 1;
-                        count++;
-                    }
-
-                    fmpz_poly_set(f, Q);
-                    leadF = fmpz_poly_lead(f);
-                 /* If r - count = k then the rest are irreducible.  
-                    TODO: Add a test for that case */
-                }
+            flint_free(threads);
+            flint_free(args);
+        }
 
-                indx = k - 1;
+        /* remove the factors found, in the order of the subsets */
+        for (i = 0; i < R.num_hits; i++)
+            perm[i] = i;
+
+        for (i = 1; i < R.num_hits; i++)
+            for (j = i; j > 0 && R.hit_idx[perm[j - 1]] > R.hit_idx[perm[j]]; j--)
+            {
+                slong tmp = perm[j];
+                perm[j] = perm[j - 1];
+                perm[j - 1] = tmp;
             }
+
+        for (i = 0; i < R.num_hits; i++)
+        {
+            fmpz_poly_struct * g = R.hits + perm[i];
+
+            fmpz_poly_div(f, f, g);
+            fmpz_poly_factor_insert(final_fac, g, exp);
         }
 
-     /* This is where we switch to the next loop for k.  So we will have 
-        found all factors using <= k local factors.  We should/could update 
-        f to be the rest divided away (or multiply the remaining), could 
-        also adjust r.  It is the number of remaining factors so if you 
-        update then test if r = k or k+1 in which case the remaining f is 
-        irreducible. */
+        m -= k * R.num_hits;
     }
 
-    {
-        slong test = 0;
+    if (m > 0)
+        fmpz_poly_factor_insert(final_fac, f, exp);
 
-        for (k = 0; k < r; k++)
-            test = test + used_arr[k];
+    pthread_mutex_destroy(&R.mutex);
 
-        if (test == 0)
-            fmpz_poly_factor_insert(final_fac, f, exp);
-    }
+    for (i = 0; i < r; i++)
+        fmpz_poly_clear(R.hits + i);
+    flint_free(R.hits);
 
+    _fmpz_vec_clear(c, 2 * r);
+    fmpz_clear(cnst);
+    fmpz_clear(bound);
+    fmpz_clear(u);
     fmpz_poly_clear(f);
-    fmpz_poly_clear(tryme);
-    fmpz_poly_clear(Q);
-    fmpz_poly_clear(R);
-    flint_free(used_arr);
+    flint_free(used);
 }
-
-#undef TRACE
-
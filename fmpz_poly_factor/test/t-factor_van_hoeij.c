@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "fmpz_poly.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("factor_van_hoeij....");
+    fflush(stdout);
+
+    /* products of many small factors force van Hoeij recombination */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t f, g, h, t;
+        fmpz_poly_factor_t fac;
+        slong j, n = 12 + n_randint(state, 20);
+        slong facs1 = 0, facs2 = 0;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_init(h);
+        fmpz_poly_init(t);
+        fmpz_poly_factor_init(fac);
+
+        fmpz_poly_set_ui(f, 1);
+
+        for (j = 0; j < n; j++)
+        {
+            do {
+               fmpz_poly_randtest(g, state, n_randint(state, 3) + 2, n_randint(state, 20) + 1);
+            } while (g->length < 2 || fmpz_is_zero(g->coeffs + 0));
+
+            facs1++; /* rough lower bound of factors of f */
+            fmpz_poly_mul(f, f, g);
+        }
+
+        fmpz_poly_factor(fac, f);
+
+        fmpz_poly_set_fmpz(h, &fac->c);
+        for (j = 0; j < fac->num; j++)
+        {
+            fmpz_poly_pow(t, fac->p + j, fac->exp[j]);
+            fmpz_poly_mul(h, h, t);
+            facs2 += fac->exp[j];
+        }
+
+        result = fmpz_poly_equal(f, h) && facs1 <= facs2;
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("facs1 = %wd, facs2 = %wd\n", facs1, facs2);
+            flint_printf("f = "), fmpz_poly_print(f), flint_printf("\n\n");
+            flint_printf("h = "), fmpz_poly_print(h), flint_printf("\n\n");
+            flint_printf("fac = "), fmpz_poly_factor_print(fac), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_clear(h);
+        fmpz_poly_clear(t);
+        fmpz_poly_factor_clear(fac);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,103 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "fmpz_poly.h"
+#include "fmpz_poly_factor.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("zassenhaus_recombination....");
+    fflush(stdout);
+
+    /* Check that factorisations with many local factors agree for
+       different numbers of threads and multiply back to the input */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t f, g, h;
+        fmpz_poly_factor_t fac1, fac2;
+        slong j, n = n_randint(state, 4);
+        ulong m = 0;
+
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_init(h);
+        fmpz_poly_factor_init(fac1);
+        fmpz_poly_factor_init(fac2);
+
+        fmpz_poly_swinnerton_dyer(f, n_randint(state, 3) + 1);
+
+        /* distinct cyclotomic polynomials split into many local factors */
+        for (j = 0; j < n; j++)
+        {
+            m += n_randint(state, 12) + 1;
+            fmpz_poly_cyclotomic(g, m);
+            fmpz_poly_mul(f, f, g);
+        }
+
+        if (n_randint(state, 2))
+        {
+            do {
+                fmpz_poly_randtest(g, state, n_randint(state, 6) + 2,
+                                             n_randint(state, 20) + 1);
+            } while (g->length < 2 || fmpz_is_zero(g->coeffs));
+
+            fmpz_poly_primitive_part(g, g);
+            fmpz_poly_mul(h, f, g);
+            if (fmpz_poly_is_squarefree(h))
+                fmpz_poly_swap(f, h);
+        }
+
+        flint_set_num_threads(1);
+        _fmpz_poly_factor_zassenhaus(fac1, 1, f, 20, 0);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+        _fmpz_poly_factor_zassenhaus(fac2, 1, f, 20, 0);
+
+        result = (fac1->num == fac2->num) && (fac1->num >= n + 1);
+        for (j = 0; result && j < fac1->num; j++)
+            result = fmpz_poly_equal(fac1->p + j, fac2->p + j);
+
+        fmpz_poly_set_fmpz(h, &fac2->c);
+        for (j = 0; j < fac2->num; j++)
+            fmpz_poly_mul(h, h, fac2->p + j);
+
+        result = result && fmpz_poly_equal(f, h);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("f = "), fmpz_poly_print(f), flint_printf("\n\n");
+            flint_printf("fac1 = "), fmpz_poly_factor_print(fac1), flint_printf("\n\n");
+            flint_printf("fac2 = "), fmpz_poly_factor_print(fac2), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_clear(h);
+        fmpz_poly_factor_clear(fac1);
+        fmpz_poly_factor_clear(fac2);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
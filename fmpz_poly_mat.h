@@ -23,6 +23,7 @@
 #include "fmpz.h"
 #include "fmpz_mat.h"
 #include "fmpz_poly.h"
+#include "nmod_poly_mat.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -159,6 +160,16 @@ FLINT_DLL void fmpz_poly_mat_sub(fmpz_poly_mat_t C, const fmpz_poly_mat_t A,
 
 FLINT_DLL void fmpz_poly_mat_neg(fmpz_poly_mat_t B, const fmpz_poly_mat_t A);
 
+/*
+   fmpz_poly_mat_mul uses multimodular rather than KS multiplication when
+   dim^2 * bits * sqrt(len) * threads reaches this cutoff, where dim is the
+   smallest dimension and len and bits are the maximum length and bit size
+   of the entries, and dim and len are at least the minimums below
+*/
+#define FMPZ_POLY_MAT_MUL_MULTI_MOD_CUTOFF 1000000
+#define FMPZ_POLY_MAT_MUL_MULTI_MOD_MIN_DIM 16
+#define FMPZ_POLY_MAT_MUL_MULTI_MOD_MIN_LEN 8
+
 FLINT_DLL void fmpz_poly_mat_mul(fmpz_poly_mat_t C, const fmpz_poly_mat_t A,
                                             const fmpz_poly_mat_t B);
 
@@ -168,6 +179,12 @@ FLINT_DLL void fmpz_poly_mat_mul_classical(fmpz_poly_mat_t C, const fmpz_poly_ma
 FLINT_DLL void fmpz_poly_mat_mul_KS(fmpz_poly_mat_t C, const fmpz_poly_mat_t A,
                                             const fmpz_poly_mat_t B);
 
+FLINT_DLL void _fmpz_poly_mat_mul_multi_mod(fmpz_poly_mat_t C,
+     const fmpz_poly_mat_t A, const fmpz_poly_mat_t B, mp_bitcnt_t bits);
+
+FLINT_DLL void fmpz_poly_mat_mul_multi_mod(fmpz_poly_mat_t C,
+                        const fmpz_poly_mat_t A, const fmpz_poly_mat_t B);
+
 FLINT_DLL void fmpz_poly_mat_mullow(fmpz_poly_mat_t C, const fmpz_poly_mat_t A,
     const fmpz_poly_mat_t B, slong len);
 
@@ -192,6 +209,14 @@ FLINT_DLL void fmpz_poly_mat_prod(fmpz_poly_mat_t res,
 FLINT_DLL void fmpz_poly_mat_evaluate_fmpz(fmpz_mat_t B,
                         const fmpz_poly_mat_t A, const fmpz_t x);
 
+/* Modular reduction and reconstruction **************************************/
+
+FLINT_DLL void fmpz_poly_mat_multi_mod_ui(nmod_poly_mat_t * residues,
+                        slong nres, const fmpz_poly_mat_t mat);
+
+FLINT_DLL void fmpz_poly_mat_multi_CRT_ui(fmpz_poly_mat_t mat,
+                        nmod_poly_mat_t * const residues, slong nres, int sign);
+
 /* Row reduction *************************************************************/
 
 FLINT_DLL slong fmpz_poly_mat_find_pivot_any(const fmpz_poly_mat_t mat,
@@ -212,12 +237,25 @@ FLINT_DLL void fmpz_poly_mat_trace(fmpz_poly_t trace, const fmpz_poly_mat_t mat)
 
 /* Determinant and rank ******************************************************/
 
+/*
+   fmpz_poly_mat_det uses the multimodular algorithm for matrices of
+   dimension at least 15 whose entries have length at least
+   FMPZ_POLY_MAT_DET_MULTI_MOD_LEN or bit size at least
+   FMPZ_POLY_MAT_DET_MULTI_MOD_BITS, or with several threads from
+   dimension FMPZ_POLY_MAT_DET_MULTI_MOD_THREADED_DIM
+*/
+#define FMPZ_POLY_MAT_DET_MULTI_MOD_LEN 16
+#define FMPZ_POLY_MAT_DET_MULTI_MOD_BITS 500
+#define FMPZ_POLY_MAT_DET_MULTI_MOD_THREADED_DIM 30
+
 FLINT_DLL void fmpz_poly_mat_det(fmpz_poly_t det, const fmpz_poly_mat_t A);
 
 FLINT_DLL void fmpz_poly_mat_det_fflu(fmpz_poly_t det, const fmpz_poly_mat_t A);
 
 FLINT_DLL void fmpz_poly_mat_det_interpolate(fmpz_poly_t det, const fmpz_poly_mat_t A);
 
+FLINT_DLL void fmpz_poly_mat_det_multi_mod(fmpz_poly_t det, const fmpz_poly_mat_t A);
+
 FLINT_DLL slong fmpz_poly_mat_rank(const fmpz_poly_mat_t A);
 
 /* Inverse *******************************************************************/
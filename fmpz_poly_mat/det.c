@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -44,6 +45,19 @@ fmpz_poly_mat_det(fmpz_poly_t det, const fmpz_poly_mat_t A)
     }
     else
     {
-        fmpz_poly_mat_det_interpolate(det, A);
+        slong len = fmpz_poly_mat_max_length(A);
+        slong bits = FLINT_ABS(fmpz_poly_mat_max_bits(A));
+
+        if (len >= FMPZ_POLY_MAT_DET_MULTI_MOD_LEN
+            || bits >= FMPZ_POLY_MAT_DET_MULTI_MOD_BITS
+            || (flint_get_num_threads() > 1
+                && n >= FMPZ_POLY_MAT_DET_MULTI_MOD_THREADED_DIM))
+        {
+            fmpz_poly_mat_det_multi_mod(det, A);
+        }
+        else
+        {
+            fmpz_poly_mat_det_interpolate(det, A);
+        }
     }
 }
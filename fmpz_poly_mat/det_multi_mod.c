@@ -0,0 +1,187 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "nmod_mat.h"
+#include "nmod_poly_mat.h"
+#include "fmpz_poly_mat.h"
+
+typedef struct
+{
+    nmod_poly_mat_t * D;
+    nmod_poly_mat_t * A;
+    slong k0;
+    slong k1;
+    int num_threads;
+}
+det_arg_t;
+
+static void *
+_det_worker(void * arg_ptr)
+{
+    det_arg_t arg = *((det_arg_t *) arg_ptr);
+    slong k;
+
+    /* threads left over when there are few primes go to each determinant */
+    flint_set_num_threads(arg.num_threads);
+
+    for (k = arg.k0; k < arg.k1; k++)
+        nmod_poly_mat_det(nmod_poly_mat_entry(arg.D[k], 0, 0), arg.A[k]);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+   Bounds the number of bits of the coefficients of the determinant. On
+   the unit circle each entry is bounded by its 1-norm, so by Hadamard's
+   inequality the coefficients are bounded by the product of the 2-norms
+   of the rows of 1-norms.
+*/
+static mp_bitcnt_t
+_det_bound_bits(const fmpz_poly_mat_t A)
+{
+    slong i, j, k;
+    mp_bitcnt_t bits;
+    fmpz_t s, t;
+    const fmpz_poly_struct * a;
+
+    fmpz_init(s);
+    fmpz_init(t);
+
+    bits = 0;
+
+    for (i = 0; i < A->r; i++)
+    {
+        fmpz_zero(s);
+
+        for (j = 0; j < A->c; j++)
+        {
+            a = fmpz_poly_mat_entry(A, i, j);
+
+            fmpz_zero(t);
+            for (k = 0; k < a->length; k++)
+            {
+                if (fmpz_sgn(a->coeffs + k) >= 0)
+                    fmpz_add(t, t, a->coeffs + k);
+                else
+                    fmpz_sub(t, t, a->coeffs + k);
+            }
+
+            fmpz_addmul(s, t, t);
+        }
+
+        bits += fmpz_bits(s);
+    }
+
+    fmpz_clear(s);
+    fmpz_clear(t);
+
+    return bits / 2 + 1;
+}
+
+void
+fmpz_poly_mat_det_multi_mod(fmpz_poly_t det, const fmpz_poly_mat_t A)
+{
+    slong i, n, num_primes, num_threads;
+    mp_bitcnt_t bits;
+    mp_limb_t * primes;
+    nmod_poly_mat_t * mod_A, * mod_D;
+    fmpz_poly_mat_t D;
+
+    n = A->r;
+
+    if (n == 0)
+    {
+        fmpz_poly_one(det);
+        return;
+    }
+
+    if (fmpz_poly_mat_max_length(A) == 0)
+    {
+        fmpz_poly_zero(det);
+        return;
+    }
+
+    /* one extra bit for the sign */
+    bits = _det_bound_bits(A) + 1;
+
+    /* Round up in the division */
+    num_primes = (bits + NMOD_MAT_OPTIMAL_MODULUS_BITS - 1)
+                                               / NMOD_MAT_OPTIMAL_MODULUS_BITS;
+
+    primes = flint_malloc(sizeof(mp_limb_t) * num_primes);
+    primes[0] = n_nextprime(UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS, 0);
+    for (i = 1; i < num_primes; i++)
+        primes[i] = n_nextprime(primes[i - 1], 0);
+
+    mod_A = flint_malloc(sizeof(nmod_poly_mat_t) * num_primes);
+    mod_D = flint_malloc(sizeof(nmod_poly_mat_t) * num_primes);
+    for (i = 0; i < num_primes; i++)
+    {
+        nmod_poly_mat_init(mod_A[i], n, n, primes[i]);
+        nmod_poly_mat_init(mod_D[i], 1, 1, primes[i]);
+    }
+
+    fmpz_poly_mat_multi_mod_ui(mod_A, num_primes, A);
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), num_primes);
+
+    if (num_threads <= 1)
+    {
+        for (i = 0; i < num_primes; i++)
+            nmod_poly_mat_det(nmod_poly_mat_entry(mod_D[i], 0, 0), mod_A[i]);
+    }
+    else
+    {
+        pthread_t * threads;
+        det_arg_t * args;
+
+        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        args = flint_malloc(sizeof(det_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].D = mod_D;
+            args[i].A = mod_A;
+            args[i].k0 = (num_primes * i) / num_threads;
+            args[i].k1 = (num_primes * (i + 1)) / num_threads;
+            args[i].num_threads = flint_get_num_threads() / num_threads;
+
+            pthread_create(&threads[i], NULL, _det_worker, &args[i]);
+        }
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(threads);
+        flint_free(args);
+    }
+
+    fmpz_poly_mat_init(D, 1, 1);
+    fmpz_poly_mat_multi_CRT_ui(D, mod_D, num_primes, 1);
+    fmpz_poly_swap(det, fmpz_poly_mat_entry(D, 0, 0));
+    fmpz_poly_mat_clear(D);
+
+    for (i = 0; i < num_primes; i++)
+    {
+        nmod_poly_mat_clear(mod_A[i]);
+        nmod_poly_mat_clear(mod_D[i]);
+    }
+
+    flint_free(mod_A);
+    flint_free(mod_D);
+    flint_free(primes);
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -11,6 +12,7 @@
 
 #include <stdlib.h>
 #include "flint.h"
+#include "ulong_extras.h"
 #include "fmpz_poly.h"
 #include "fmpz_poly_mat.h"
 
@@ -18,9 +20,34 @@ void
 fmpz_poly_mat_mul(fmpz_poly_mat_t C, const fmpz_poly_mat_t A,
     const fmpz_poly_mat_t B)
 {
+    slong dim, len, bits;
+
     if (A->r < 8 || B->r < 8 || B->c < 8)
     {
         fmpz_poly_mat_mul_classical(C, A, B);
+        return;
+    }
+
+    dim = FLINT_MIN(A->r, FLINT_MIN(B->r, B->c));
+    len = FLINT_MAX(fmpz_poly_mat_max_length(A),
+                    fmpz_poly_mat_max_length(B));
+
+    /* KS for small or low degree inputs, whatever the number of threads */
+    if (dim < FMPZ_POLY_MAT_MUL_MULTI_MOD_MIN_DIM ||
+        len < FMPZ_POLY_MAT_MUL_MULTI_MOD_MIN_LEN)
+    {
+        fmpz_poly_mat_mul_KS(C, A, B);
+        return;
+    }
+
+    bits = FLINT_MAX(FLINT_ABS(fmpz_poly_mat_max_bits(A)),
+                     FLINT_ABS(fmpz_poly_mat_max_bits(B)));
+
+    /* the prime images are computed in parallel */
+    if ((double) dim * dim * bits * n_sqrt(len) * flint_get_num_threads()
+            >= FMPZ_POLY_MAT_MUL_MULTI_MOD_CUTOFF)
+    {
+        fmpz_poly_mat_mul_multi_mod(C, A, B);
     }
     else
     {
@@ -0,0 +1,149 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_poly.h"
+#include "nmod_mat.h"
+#include "nmod_poly_mat.h"
+#include "fmpz_poly_mat.h"
+
+typedef struct
+{
+    nmod_poly_mat_t * C;
+    nmod_poly_mat_t * A;
+    nmod_poly_mat_t * B;
+    slong k0;
+    slong k1;
+    int num_threads;
+}
+mul_arg_t;
+
+static void *
+_mul_worker(void * arg_ptr)
+{
+    mul_arg_t arg = *((mul_arg_t *) arg_ptr);
+    slong k;
+
+    /* threads left over when there are few primes go to each product */
+    flint_set_num_threads(arg.num_threads);
+
+    for (k = arg.k0; k < arg.k1; k++)
+        nmod_poly_mat_mul(arg.C[k], arg.A[k], arg.B[k]);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_fmpz_poly_mat_mul_multi_mod(fmpz_poly_mat_t C, const fmpz_poly_mat_t A,
+                               const fmpz_poly_mat_t B, mp_bitcnt_t bits)
+{
+    slong i, num_primes, num_threads;
+    mp_limb_t * primes;
+    nmod_poly_mat_t * mod_A, * mod_B, * mod_C;
+
+    /* Round up in the division */
+    num_primes = (bits + NMOD_MAT_OPTIMAL_MODULUS_BITS - 1)
+                                               / NMOD_MAT_OPTIMAL_MODULUS_BITS;
+    num_primes = FLINT_MAX(num_primes, 1);
+
+    primes = flint_malloc(sizeof(mp_limb_t) * num_primes);
+    primes[0] = n_nextprime(UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS, 0);
+    for (i = 1; i < num_primes; i++)
+        primes[i] = n_nextprime(primes[i - 1], 0);
+
+    mod_A = flint_malloc(sizeof(nmod_poly_mat_t) * num_primes);
+    mod_B = flint_malloc(sizeof(nmod_poly_mat_t) * num_primes);
+    mod_C = flint_malloc(sizeof(nmod_poly_mat_t) * num_primes);
+    for (i = 0; i < num_primes; i++)
+    {
+        nmod_poly_mat_init(mod_A[i], A->r, A->c, primes[i]);
+        nmod_poly_mat_init(mod_B[i], B->r, B->c, primes[i]);
+        nmod_poly_mat_init(mod_C[i], C->r, C->c, primes[i]);
+    }
+
+    fmpz_poly_mat_multi_mod_ui(mod_A, num_primes, A);
+    fmpz_poly_mat_multi_mod_ui(mod_B, num_primes, B);
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), num_primes);
+
+    if (num_threads <= 1)
+    {
+        for (i = 0; i < num_primes; i++)
+            nmod_poly_mat_mul(mod_C[i], mod_A[i], mod_B[i]);
+    }
+    else
+    {
+        pthread_t * threads;
+        mul_arg_t * args;
+
+        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        args = flint_malloc(sizeof(mul_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].C = mod_C;
+            args[i].A = mod_A;
+            args[i].B = mod_B;
+            args[i].k0 = (num_primes * i) / num_threads;
+            args[i].k1 = (num_primes * (i + 1)) / num_threads;
+            args[i].num_threads = flint_get_num_threads() / num_threads;
+
+            pthread_create(&threads[i], NULL, _mul_worker, &args[i]);
+        }
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(threads);
+        flint_free(args);
+    }
+
+    fmpz_poly_mat_multi_CRT_ui(C, mod_C, num_primes, 1);
+
+    for (i = 0; i < num_primes; i++)
+    {
+        nmod_poly_mat_clear(mod_A[i]);
+        nmod_poly_mat_clear(mod_B[i]);
+        nmod_poly_mat_clear(mod_C[i]);
+    }
+
+    flint_free(mod_A);
+    flint_free(mod_B);
+    flint_free(mod_C);
+    flint_free(primes);
+}
+
+void
+fmpz_poly_mat_mul_multi_mod(fmpz_poly_mat_t C, const fmpz_poly_mat_t A,
+    const fmpz_poly_mat_t B)
+{
+    slong A_len, B_len, A_bits, B_bits;
+
+    A_len = fmpz_poly_mat_max_length(A);
+    B_len = fmpz_poly_mat_max_length(B);
+
+    if (A_len == 0 || B_len == 0 || B->r == 0)
+    {
+        fmpz_poly_mat_zero(C);
+        return;
+    }
+
+    A_bits = fmpz_poly_mat_max_bits(A);
+    B_bits = fmpz_poly_mat_max_bits(B);
+
+    /* each output coefficient is a sum of B->r * min(A_len, B_len) terms */
+    _fmpz_poly_mat_mul_multi_mod(C, A, B, FLINT_ABS(A_bits)
+        + FLINT_ABS(B_bits) + FLINT_BIT_COUNT(B->r * FLINT_MIN(A_len, B_len))
+        + 1);
+}
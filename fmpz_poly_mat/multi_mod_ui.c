@@ -0,0 +1,166 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "nmod_vec.h"
+#include "nmod_poly_mat.h"
+#include "fmpz_poly_mat.h"
+
+typedef struct
+{
+    nmod_poly_mat_t * residues;
+    slong nres;
+    const fmpz_poly_mat_struct * mat;
+    const fmpz_comb_struct * comb;
+    const slong * offsets;
+    slong c0;
+    slong c1;
+}
+multi_mod_arg_t;
+
+/*
+   Reduces the coefficients with global indices c0, ..., c1 - 1, where
+   the coefficients of entry e have indices offsets[e], ...,
+   offsets[e + 1] - 1.
+*/
+static void
+_multi_mod_range(nmod_poly_mat_t * residues, slong nres,
+        const fmpz_poly_mat_t mat, const fmpz_comb_t comb,
+        const slong * offsets, slong c0, slong c1)
+{
+    slong e, i, j, k, c;
+    fmpz_comb_temp_t temp;
+    fmpz_poly_struct * poly;
+    mp_ptr r;
+
+    if (c0 >= c1)
+        return;
+
+    r = _nmod_vec_init(nres);
+    fmpz_comb_temp_init(temp, comb);
+
+    for (e = 0; offsets[e + 1] <= c0; e++) ;
+
+    for (c = c0; c < c1; c++)
+    {
+        while (offsets[e + 1] <= c)
+            e++;
+
+        i = e / mat->c;
+        j = e % mat->c;
+        poly = fmpz_poly_mat_entry(mat, i, j);
+
+        fmpz_multi_mod_ui(r, poly->coeffs + c - offsets[e], comb, temp);
+        for (k = 0; k < nres; k++)
+            nmod_poly_mat_entry(residues[k], i, j)->coeffs[c - offsets[e]] = r[k];
+    }
+
+    fmpz_comb_temp_clear(temp);
+    _nmod_vec_clear(r);
+}
+
+static void *
+_multi_mod_worker(void * arg_ptr)
+{
+    multi_mod_arg_t arg = *((multi_mod_arg_t *) arg_ptr);
+
+    _multi_mod_range(arg.residues, arg.nres, arg.mat, arg.comb,
+                     arg.offsets, arg.c0, arg.c1);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+fmpz_poly_mat_multi_mod_ui(nmod_poly_mat_t * residues, slong nres,
+                                                 const fmpz_poly_mat_t mat)
+{
+    fmpz_comb_t comb;
+    mp_ptr primes;
+    slong * offsets;
+    slong i, j, k, e, len, total, num_entries, num_threads;
+
+    num_entries = mat->r * mat->c;
+
+    if (num_entries == 0)
+        return;
+
+    primes = _nmod_vec_init(nres);
+    for (k = 0; k < nres; k++)
+        primes[k] = residues[k]->modulus;
+
+    fmpz_comb_init(comb, primes, nres);
+
+    offsets = flint_malloc(sizeof(slong) * (num_entries + 1));
+    offsets[0] = 0;
+
+    for (e = 0; e < num_entries; e++)
+    {
+        i = e / mat->c;
+        j = e % mat->c;
+        len = fmpz_poly_mat_entry(mat, i, j)->length;
+        offsets[e + 1] = offsets[e] + len;
+
+        for (k = 0; k < nres; k++)
+        {
+            nmod_poly_fit_length(nmod_poly_mat_entry(residues[k], i, j), len);
+            nmod_poly_mat_entry(residues[k], i, j)->length = len;
+        }
+    }
+
+    total = offsets[num_entries];
+    num_threads = FLINT_MIN(flint_get_num_threads(), total / 64);
+
+    if (num_threads <= 1)
+    {
+        _multi_mod_range(residues, nres, mat, comb, offsets, 0, total);
+    }
+    else
+    {
+        pthread_t * threads;
+        multi_mod_arg_t * args;
+
+        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        args = flint_malloc(sizeof(multi_mod_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].residues = residues;
+            args[i].nres = nres;
+            args[i].mat = mat;
+            args[i].comb = comb;
+            args[i].offsets = offsets;
+            args[i].c0 = (total * i) / num_threads;
+            args[i].c1 = (total * (i + 1)) / num_threads;
+
+            pthread_create(&threads[i], NULL, _multi_mod_worker, &args[i]);
+        }
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(threads);
+        flint_free(args);
+    }
+
+    for (e = 0; e < num_entries; e++)
+        for (k = 0; k < nres; k++)
+            _nmod_poly_normalise(nmod_poly_mat_entry(residues[k],
+                                                     e / mat->c, e % mat->c));
+
+    flint_free(offsets);
+    fmpz_comb_clear(comb);
+    _nmod_vec_clear(primes);
+}
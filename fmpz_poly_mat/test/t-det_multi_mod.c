@@ -0,0 +1,77 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "fmpz_poly.h"
+#include "fmpz_poly_mat.h"
+
+
+int
+main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("det_multi_mod....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_mat_t A;
+        fmpz_poly_t a, b;
+        slong n, bits, deg;
+
+        n = n_randint(state, 10);
+        deg = 1 + n_randint(state, 5);
+        bits = 1 + n_randint(state, 200);
+
+        fmpz_poly_mat_init(A, n, n);
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+
+        fmpz_poly_mat_randtest(A, state, deg, bits);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        fmpz_poly_mat_det_fflu(a, A);
+        fmpz_poly_mat_det_multi_mod(b, A);
+
+        if (!fmpz_poly_equal(a, b))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("determinants don't agree!\n");
+            flint_printf("A:\n");
+            fmpz_poly_mat_print(A, "x");
+            flint_printf("det(A):\n");
+            fmpz_poly_print_pretty(a, "x");
+            flint_printf("\ndet_multi_mod(A):\n");
+            fmpz_poly_print_pretty(b, "x");
+            flint_printf("\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+
+        fmpz_poly_mat_clear(A);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -28,6 +28,9 @@
  extern "C" {
 #endif
 
+/* decimal digits in a block read by _fmpz_vec_fread_bulk before threading */
+#define FMPZ_VEC_FREAD_BULK_THREADED_CUTOFF 65536
+
 #define FMPZ_VEC_NORM(vec, i)          \
 do {                                   \
     while ((i) && vec[(i) - 1] == WORD(0))  \
@@ -90,6 +93,27 @@ int _fmpz_vec_read(fmpz ** vec, slong * len)
     return _fmpz_vec_fread(stdin, vec, len);
 }
 
+FLINT_DLL int _fmpz_vec_fread_bulk(FILE * file, fmpz * vec, slong len);
+
+FLINT_DLL int _fmpz_vec_fwrite_bin_data(FILE * file,
+                                                const fmpz * vec, slong len);
+
+FLINT_DLL int _fmpz_vec_fwrite_bin(FILE * file, const fmpz * vec, slong len);
+
+FLINT_DLL int _fmpz_vec_fread_bin_data(FILE * file, fmpz * vec, slong len);
+
+FLINT_DLL int _fmpz_vec_fread_bin(FILE * file, fmpz ** vec, slong * len);
+
+FLINT_DLL size_t _fmpz_vec_bin_view_data(fmpz ** vec,
+                                  const void * buf, size_t size, slong len);
+
+FLINT_DLL void _fmpz_vec_bin_view_data_clear(fmpz * vec, const void * buf);
+
+FLINT_DLL size_t _fmpz_vec_bin_view_init(fmpz ** vec, slong * len,
+                                              const void * buf, size_t size);
+
+FLINT_DLL void _fmpz_vec_bin_view_clear(fmpz * vec, const void * buf);
+
 /*  Conversions  *************************************************************/
 
 FLINT_DLL void _fmpz_vec_set_nmod_vec(fmpz * res, 
@@ -0,0 +1,140 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "bin_io.h"
+
+size_t _fmpz_vec_bin_view_data(fmpz ** vec, const void * buf,
+                                                       size_t size, slong len)
+{
+    const ulong * w = (const ulong *) buf;
+    ulong words = size / sizeof(ulong);
+    slong i, k, n, nbig, nlimbs, total;
+    const slong * sizes;
+    const ulong * limbs;
+    const fmpz * slots;
+    fmpz * block;
+    __mpz_struct * z;
+
+    *vec = NULL;
+
+    if (((size_t) buf) % sizeof(ulong) != 0 || words < 2)
+        return 0;
+
+    nbig = w[0];
+    nlimbs = w[1];
+
+    if (nbig < 0 || nbig > len || nlimbs < nbig || (ulong) len > words - 2
+          || (ulong) nbig + (ulong) nlimbs > words - 2 - len)
+        return 0;
+
+    slots = (const fmpz *) (w + 2);
+
+    for (i = 0, k = 0; i < len; i++)
+    {
+        if (COEFF_IS_MPZ(slots[i]) ? (slots[i] & ~FLINT_BIN_BIG_TAG) != k++
+                              : (slots[i] < COEFF_MIN || slots[i] > COEFF_MAX))
+            return 0;
+    }
+
+    if (k != nbig)
+        return 0;
+
+    /* only small entries, which are used in place */
+    if (nbig == 0)
+    {
+        if (nlimbs != 0)
+            return 0;
+
+        *vec = (fmpz *) slots;
+        return (2 + len) * sizeof(ulong);
+    }
+
+    sizes = (const slong *) (w + 2 + len);
+    limbs = w + 2 + len + nbig;
+
+    for (k = 0, total = 0; k < nbig; k++)
+    {
+        n = FLINT_ABS(sizes[k]);
+        if (n == 0 || n > nlimbs - total || limbs[total + n - 1] == 0
+                  || (n == 1 && limbs[total] <= COEFF_MAX))
+            return 0;
+        total += n;
+    }
+
+    if (total != nlimbs)
+        return 0;
+
+    /*
+       The slots are copied, with the large entries pointing to mpz structs
+       whose limbs are left in the buffer
+    */
+    block = flint_malloc(len * sizeof(fmpz) + nbig * sizeof(__mpz_struct));
+    z = (__mpz_struct *) (block + len);
+
+    for (i = 0, k = 0, total = 0; i < len; i++)
+    {
+        if (!COEFF_IS_MPZ(slots[i]))
+        {
+            block[i] = slots[i];
+            continue;
+        }
+
+        n = FLINT_ABS(sizes[k]);
+        z[k]._mp_alloc = n;
+        z[k]._mp_size = sizes[k];
+        z[k]._mp_d = (mp_ptr) (limbs + total);
+        block[i] = PTR_TO_COEFF(z + k);
+        total += n;
+        k++;
+    }
+
+    *vec = block;
+    return (2 + len + nbig + nlimbs) * sizeof(ulong);
+}
+
+void _fmpz_vec_bin_view_data_clear(fmpz * vec, const void * buf)
+{
+    if (vec != (const fmpz *) buf + 2)
+        flint_free(vec);
+}
+
+size_t _fmpz_vec_bin_view_init(fmpz ** vec, slong * len,
+                                                const void * buf, size_t size)
+{
+    ulong dims[4];
+    size_t h, d;
+
+    *vec = NULL;
+    *len = 0;
+
+    h = flint_bin_view_header(dims, buf, size, FLINT_BIN_FMPZ_VEC);
+    if (h == 0 || dims[0] > WORD_MAX)
+        return 0;
+
+    d = _fmpz_vec_bin_view_data(vec, (const char *) buf + h, size - h, dims[0]);
+    if (d == 0)
+        return 0;
+
+    *len = dims[0];
+
+    return h + d;
+}
+
+void _fmpz_vec_bin_view_clear(fmpz * vec, const void * buf)
+{
+    _fmpz_vec_bin_view_data_clear(vec,
+                                   (const char *) buf + FLINT_BIN_HEADER_BYTES);
+}
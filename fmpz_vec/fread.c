@@ -19,7 +19,6 @@
 int _fmpz_vec_fread(FILE * file, fmpz ** vec, slong * len)
 {
     int alloc, r;
-    slong i;
     mpz_t t;
 
     alloc = (*vec == NULL);
@@ -53,21 +52,14 @@ int _fmpz_vec_fread(FILE * file, fmpz ** vec, slong * len)
     }
     mpz_clear(t);
 
-    for (i = 0; i < *len; i++)
+    r = _fmpz_vec_fread_bulk(file, *vec, *len);
+    if (r <= 0 && alloc)
     {
-        r = fmpz_fread(file, (*vec) + i);
-        if (r <= 0)
-        {
-            if (alloc)
-            {
-                _fmpz_vec_clear(*vec, *len);
-                *vec = NULL;
-                *len = 0;
-            }
-            return r;
-        }
+        _fmpz_vec_clear(*vec, *len);
+        *vec = NULL;
+        *len = 0;
     }
 
-    return 1;
+    return r;
 }
 
@@ -0,0 +1,153 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "bin_io.h"
+
+/* zeroes entries from start on, which hold small values or slots */
+static void
+_fmpz_vec_clear_slots(fmpz * vec, slong start, slong len)
+{
+    slong i;
+
+    for (i = start; i < len; i++)
+        vec[i] = 0;
+}
+
+int _fmpz_vec_fread_bin_data(FILE * file, fmpz * vec, slong len)
+{
+    ulong h[2];
+    slong i, k, n, nbig, nlimbs, total;
+    slong * sizes;
+    __mpz_struct * z;
+
+    _fmpz_vec_zero(vec, len);
+
+    if (!flint_bin_fread_words(h, 2, file))
+        return 0;
+
+    nbig = h[0];
+    nlimbs = h[1];
+
+    if (nbig < 0 || nbig > len || nlimbs < nbig)
+        return 0;
+
+    /* vec only holds small values now, so it can take the slots directly */
+    if (!flint_bin_fread_words((ulong *) vec, len, file))
+    {
+        _fmpz_vec_clear_slots(vec, 0, len);
+        return 0;
+    }
+
+    for (i = 0, k = 0; i < len; i++)
+    {
+        if (COEFF_IS_MPZ(vec[i]) ? (vec[i] & ~FLINT_BIN_BIG_TAG) != k++
+                                 : (vec[i] < COEFF_MIN || vec[i] > COEFF_MAX))
+            break;
+    }
+
+    if (i < len || k != nbig)
+    {
+        _fmpz_vec_clear_slots(vec, 0, len);
+        return 0;
+    }
+
+    if (nbig == 0)
+        return (nlimbs == 0);
+
+    sizes = flint_malloc(nbig * sizeof(slong));
+
+    if (!flint_bin_fread_words((ulong *) sizes, nbig, file))
+        nlimbs = -1;
+
+    for (k = 0, total = 0; k < nbig && nlimbs >= 0; k++)
+    {
+        n = FLINT_ABS(sizes[k]);
+        if (n == 0 || n > nlimbs - total)
+            nlimbs = -1;
+        else
+            total += n;
+    }
+
+    if (nlimbs < 0 || total != nlimbs)
+    {
+        flint_free(sizes);
+        _fmpz_vec_clear_slots(vec, 0, len);
+        return 0;
+    }
+
+    for (i = 0, k = 0; i < len; i++)
+    {
+        if (!COEFF_IS_MPZ(vec[i]))
+            continue;
+
+        n = FLINT_ABS(sizes[k]);
+        vec[i] = 0;
+        z = _fmpz_promote(vec + i);
+        if (z->_mp_alloc < n)
+            mpz_realloc2(z, n * FLINT_BITS);
+
+        if (!flint_bin_fread_words(z->_mp_d, n, file) || z->_mp_d[n - 1] == 0)
+        {
+            _fmpz_vec_clear_slots(vec, i + 1, len);
+            _fmpz_vec_zero(vec, i + 1);
+            flint_free(sizes);
+            return 0;
+        }
+
+        z->_mp_size = sizes[k];
+        _fmpz_demote_val(vec + i);
+        k++;
+    }
+
+    flint_free(sizes);
+
+    return 1;
+}
+
+int _fmpz_vec_fread_bin(FILE * file, fmpz ** vec, slong * len)
+{
+    ulong dims[4];
+    int alloc, r;
+
+    alloc = (*vec == NULL);
+
+    if (!flint_bin_fread_header(file, FLINT_BIN_FMPZ_VEC, dims)
+           || dims[0] > WORD_MAX)
+    {
+        if (alloc)
+            *len = 0;
+        return 0;
+    }
+
+    if (alloc)
+    {
+        *len = dims[0];
+        *vec = _fmpz_vec_init(*len);
+    }
+    else if (*len != (slong) dims[0])
+        return 0;
+
+    r = _fmpz_vec_fread_bin_data(file, *vec, *len);
+
+    if (!r && alloc)
+    {
+        _fmpz_vec_clear(*vec, *len);
+        *vec = NULL;
+        *len = 0;
+    }
+
+    return r;
+}
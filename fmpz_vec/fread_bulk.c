@@ -0,0 +1,294 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <pthread.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+/*
+   Seekable streams are read in chunks and the position is restored
+   afterwards with fseek. Elsewhere, and when ftell fails (pipes, ttys),
+   the stream is read with getc so that nothing past the last token
+   is consumed. Text mode streams on Windows cannot be repositioned by
+   byte counts, so they always take the getc path.
+*/
+#if !defined(_MSC_VER) && !defined(__MINGW32__)
+#define FREAD_BULK_SEEK 1
+#else
+#define FREAD_BULK_SEEK 0
+#endif
+
+#define CHUNK_MIN 4096
+#define CHUNK_MAX (WORD(1) << 20)
+
+/* tokens are converted in blocks of at most this many tokens or digits */
+#define BLOCK_TOKENS 65536
+#define BLOCK_DIGITS (WORD(1) << 24)
+
+typedef struct
+{
+    FILE * file;
+    char * buf;
+    slong pos;
+    slong len;
+    slong alloc;
+    long offset; /* stream position of buf[0], negative when using getc */
+    int eof;
+}
+_bulk_reader_struct;
+
+static int
+_bulk_reader_fill(_bulk_reader_struct * rd)
+{
+    if (rd->offset < 0)
+        return getc(rd->file);
+
+    if (rd->eof)
+        return EOF;
+
+    rd->offset += rd->len;
+    rd->pos = 0;
+
+    if (rd->alloc < CHUNK_MAX)
+    {
+        rd->alloc = rd->alloc == 0 ? CHUNK_MIN : 2*rd->alloc;
+        rd->buf = flint_realloc(rd->buf, rd->alloc);
+    }
+
+    rd->len = fread(rd->buf, 1, rd->alloc, rd->file);
+    if (rd->len == 0)
+    {
+        rd->eof = 1;
+        return EOF;
+    }
+
+    return (unsigned char) rd->buf[rd->pos++];
+}
+
+#define NEXT_CHAR(rd) \
+    ((rd)->pos < (rd)->len ? (int) (unsigned char) (rd)->buf[(rd)->pos++] \
+                           : _bulk_reader_fill(rd))
+
+/* hands back the lookahead c, which was the last character read */
+static void
+_bulk_reader_finish(_bulk_reader_struct * rd, int c)
+{
+    if (rd->offset < 0)
+    {
+        if (c != EOF)
+            ungetc(c, rd->file);
+    }
+    else if (!rd->eof)
+    {
+        /* c was the last character taken from the buffer */
+        fseek(rd->file, rd->offset + rd->pos - 1, SEEK_SET);
+    }
+
+    flint_free(rd->buf);
+}
+
+typedef struct
+{
+    fmpz * vec;
+    const char * digits;
+    const slong * off;
+    const char * neg;
+    slong start;
+    slong stop;
+}
+_convert_arg_t;
+
+static void
+_convert_tokens(_convert_arg_t * arg)
+{
+    slong i;
+
+    for (i = arg->start; i < arg->stop; i++)
+    {
+        _fmpz_set_str_dec(arg->vec + i, arg->digits + arg->off[i],
+                                          arg->off[i + 1] - arg->off[i]);
+        if (arg->neg[i])
+            fmpz_neg(arg->vec + i, arg->vec + i);
+    }
+}
+
+static void *
+_convert_worker(void * arg_ptr)
+{
+    _convert_tokens((_convert_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* converts the num tokens of a block, splitting by digit count */
+static void
+_convert_block(fmpz * vec, const char * digits, const slong * off,
+                                                  const char * neg, slong num)
+{
+    slong i, k, num_threads, total = off[num];
+    pthread_t * threads;
+    _convert_arg_t * args;
+
+    num_threads = flint_get_num_threads();
+    num_threads = FLINT_MIN(num_threads, num);
+
+    if (num_threads <= 1 || total < FMPZ_VEC_FREAD_BULK_THREADED_CUTOFF)
+    {
+        _convert_arg_t arg;
+
+        arg.vec = vec;
+        arg.digits = digits;
+        arg.off = off;
+        arg.neg = neg;
+        arg.start = 0;
+        arg.stop = num;
+        _convert_tokens(&arg);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t)*num_threads);
+    args = flint_malloc(sizeof(_convert_arg_t)*num_threads);
+
+    for (i = 0, k = 0; i < num_threads; i++)
+    {
+        args[i].vec = vec;
+        args[i].digits = digits;
+        args[i].off = off;
+        args[i].neg = neg;
+        args[i].start = k;
+
+        if (i == num_threads - 1)
+            k = num;
+        else
+            while (k < num && off[k] < (total/num_threads)*(i + 1))
+                k++;
+
+        args[i].stop = k;
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _convert_worker, &args[i]);
+
+    _convert_tokens(&args[0]);
+
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
+int _fmpz_vec_fread_bulk(FILE * file, fmpz * vec, slong len)
+{
+    _bulk_reader_struct rd[1];
+    char * digits, * neg;
+    slong * off;
+    slong i, j, q, num, dalloc;
+    int c, result = 1;
+
+    if (len <= 0)
+        return 1;
+
+    rd->file = file;
+    rd->buf = NULL;
+    rd->pos = rd->len = rd->alloc = 0;
+    rd->eof = 0;
+#if FREAD_BULK_SEEK
+    rd->offset = ftell(file);
+#else
+    rd->offset = -1;
+#endif
+
+    num = FLINT_MIN(len, BLOCK_TOKENS);
+    dalloc = 64*num;
+    digits = flint_malloc(dalloc);
+    off = flint_malloc((num + 1)*sizeof(slong));
+    neg = flint_malloc(num);
+
+    c = NEXT_CHAR(rd);
+
+    for (i = 0; i < len; )
+    {
+        /* scan a block of tokens, with the same syntax as mpz_inp_str */
+        off[0] = 0;
+
+        for (j = 0; j < BLOCK_TOKENS && i + j < len
+                                     && off[j] < BLOCK_DIGITS; j++)
+        {
+            slong d = off[j];
+
+            while (c != EOF && isspace(c))
+                c = NEXT_CHAR(rd);
+
+            neg[j] = (c == '-');
+            if (neg[j])
+                c = NEXT_CHAR(rd);
+
+            if (c < '0' || c > '9')
+            {
+                result = 0;
+                break;
+            }
+
+            do
+            {
+                /* take the rest of the run of digits in the buffer at once */
+                for (q = rd->pos; q < rd->len
+                          && rd->buf[q] >= '0' && rd->buf[q] <= '9'; q++) ;
+                q -= rd->pos;
+
+                if (d + 1 + q > dalloc)
+                {
+                    dalloc = FLINT_MAX(2*dalloc, d + 1 + q);
+                    digits = flint_realloc(digits, dalloc);
+                }
+
+                digits[d++] = c;
+                if (q > 0)
+                {
+                    memcpy(digits + d, rd->buf + rd->pos, q);
+                    d += q;
+                    rd->pos += q;
+                }
+
+                c = NEXT_CHAR(rd);
+            } while (c >= '0' && c <= '9');
+
+            off[j + 1] = d;
+        }
+
+        /* entries before a parse error are still set */
+        _convert_block(vec + i, digits, off, neg, j);
+        i += j;
+
+        if (!result)
+            break;
+    }
+
+    _bulk_reader_finish(rd, c);
+
+    flint_free(digits);
+    flint_free(off);
+    flint_free(neg);
+
+    return result;
+}
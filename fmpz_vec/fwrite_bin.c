@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "bin_io.h"
+
+/* number of words collected before each call to fwrite */
+#define BUF_WORDS 4096
+
+/*
+   The payload is: the number of multiprecision entries nbig and the total
+   number of their limbs, then one slot per entry holding either the value
+   of a small entry or FLINT_BIN_BIG_TAG plus the index of a large one,
+   then the nbig signed sizes and finally all the limbs, in order.
+*/
+int _fmpz_vec_fwrite_bin_data(FILE * file, const fmpz * vec, slong len)
+{
+    ulong buf[BUF_WORDS];
+    slong i, j, n, nbig = 0, nlimbs = 0;
+    __mpz_struct * z;
+
+    for (i = 0; i < len; i++)
+    {
+        if (COEFF_IS_MPZ(vec[i]))
+        {
+            nbig++;
+            nlimbs += FLINT_ABS(COEFF_TO_PTR(vec[i])->_mp_size);
+        }
+    }
+
+    buf[0] = nbig;
+    buf[1] = nlimbs;
+    j = 2;
+
+    for (i = 0, n = 0; i < len; i++)
+    {
+        if (j == BUF_WORDS)
+        {
+            if (!flint_bin_fwrite_words(file, buf, j))
+                return 0;
+            j = 0;
+        }
+
+        buf[j++] = COEFF_IS_MPZ(vec[i]) ? (n++ | FLINT_BIN_BIG_TAG) : vec[i];
+    }
+
+    for (i = 0; i < len && nbig != 0; i++)
+    {
+        if (!COEFF_IS_MPZ(vec[i]))
+            continue;
+
+        if (j == BUF_WORDS)
+        {
+            if (!flint_bin_fwrite_words(file, buf, j))
+                return 0;
+            j = 0;
+        }
+
+        buf[j++] = COEFF_TO_PTR(vec[i])->_mp_size;
+    }
+
+    for (i = 0; i < len && nbig != 0; i++)
+    {
+        if (!COEFF_IS_MPZ(vec[i]))
+            continue;
+
+        z = COEFF_TO_PTR(vec[i]);
+        n = FLINT_ABS(z->_mp_size);
+
+        if (n > BUF_WORDS - j)
+        {
+            if (!flint_bin_fwrite_words(file, buf, j))
+                return 0;
+            j = 0;
+
+            /* long integers are written straight from their limbs */
+            if (n >= BUF_WORDS)
+            {
+                if (!flint_bin_fwrite_words(file, z->_mp_d, n))
+                    return 0;
+                continue;
+            }
+        }
+
+        memcpy(buf + j, z->_mp_d, n * sizeof(ulong));
+        j += n;
+    }
+
+    return flint_bin_fwrite_words(file, buf, j);
+}
+
+int _fmpz_vec_fwrite_bin(FILE * file, const fmpz * vec, slong len)
+{
+    ulong dims[4] = {0, 0, 0, 0};
+
+    dims[0] = len;
+
+    return flint_bin_fwrite_header(file, FLINT_BIN_FMPZ_VEC, dims)
+        && _fmpz_vec_fwrite_bin_data(file, vec, len);
+}
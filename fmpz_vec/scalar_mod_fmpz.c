@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2011 Sebastian Pancratz
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -18,7 +19,18 @@ void _fmpz_vec_scalar_mod_fmpz(fmpz *res, const fmpz *vec, slong len, const fmpz
 {
     slong i;
 
-    for (i = 0; i < len; i++)
-        fmpz_mod(res + i, vec + i, p);
+    if (COEFF_IS_MPZ(*p) && fmpz_val2(p) == fmpz_bits(p) - 1)
+    {
+        /* reduction modulo a large power of two is a truncation */
+        const mp_bitcnt_t e = fmpz_bits(p) - 1;
+
+        for (i = 0; i < len; i++)
+            fmpz_fdiv_r_2exp(res + i, vec + i, e);
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
+            fmpz_mod(res + i, vec + i, p);
+    }
 }
 
@@ -0,0 +1,197 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("fread_bulk....");
+#if !defined( _MSC_VER )
+    fflush(stdout);
+
+    /* write two vectors with random separators and read them back */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz * a, * b;
+        slong j, len1, len2;
+        int c, sgn;
+        FILE * f = fopen("fmpz_vec_bulk_test", "w");
+
+        if (!f)
+        {
+            flint_printf("Error: unable to open file for writing.\n");
+            abort();
+        }
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        len1 = n_randint(state, 200);
+        len2 = n_randint(state, 200) + 1;
+        a = _fmpz_vec_init(len1 + len2);
+        b = _fmpz_vec_init(len1 + len2);
+
+        if (n_randint(state, 10) == 0)
+            _fmpz_vec_randtest(a, state, len1 + len2, 30000);
+        else
+            _fmpz_vec_randtest(a, state, len1 + len2,
+                                                n_randint(state, 300) + 1);
+
+        for (j = 0; j < len1 + len2; j++)
+        {
+            if (j != 0 || n_randint(state, 2))
+            {
+                switch (n_randint(state, 4))
+                {
+                    case 0: fputc(' ', f); break;
+                    case 1: fputc('\n', f); break;
+                    case 2: fputs("\t  ", f); break;
+                    default: fputs(" \n ", f);
+                }
+            }
+
+            /* sign, optional leading zeros, then the absolute value */
+            sgn = fmpz_sgn(a + j);
+            if (sgn < 0)
+                fputc('-', f);
+
+            if (n_randint(state, 10) == 0)
+                fputs("00", f);
+
+            fmpz_abs(a + j, a + j);
+            fmpz_fprint(f, a + j);
+            if (sgn < 0)
+                fmpz_neg(a + j, a + j);
+        }
+
+        fputs("x", f);
+        fclose(f);
+
+        f = fopen("fmpz_vec_bulk_test", "r");
+
+        result = _fmpz_vec_fread_bulk(f, b, len1)
+              && _fmpz_vec_fread_bulk(f, b + len1, len2)
+              && _fmpz_vec_equal(a, b, len1 + len2);
+
+        /* the stream is left just after the last integer */
+        c = getc(f);
+        result = result && (c == 'x') && getc(f) == EOF;
+
+        /* and there is nothing more to read */
+        result = result && !_fmpz_vec_fread_bulk(f, b, 1);
+
+        fclose(f);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("len1 = %wd, len2 = %wd, c = %d\n", len1, len2, c);
+            _fmpz_vec_print(a, len1 + len2), flint_printf("\n\n");
+            _fmpz_vec_print(b, len1 + len2), flint_printf("\n\n");
+            abort();
+        }
+
+        _fmpz_vec_clear(a, len1 + len2);
+        _fmpz_vec_clear(b, len1 + len2);
+    }
+
+    /* a long vector, read with the same result on any number of threads */
+    {
+        fmpz * a, * b;
+        slong len = 20000;
+        FILE * f = fopen("fmpz_vec_bulk_test", "w");
+
+        if (!f)
+        {
+            flint_printf("Error: unable to open file for writing.\n");
+            abort();
+        }
+
+        a = _fmpz_vec_init(len);
+        b = _fmpz_vec_init(len);
+        _fmpz_vec_randtest(a, state, len, 500);
+
+        result = _fmpz_vec_fprint(f, a, len) > 0;
+        fclose(f);
+
+        for (i = 1; result && i <= 4; i++)
+        {
+            slong l = 0;
+            fmpz * c = NULL;
+
+            flint_set_num_threads(i);
+
+            f = fopen("fmpz_vec_bulk_test", "r");
+            result = _fmpz_vec_fread(f, &c, &l) > 0
+                  && l == len && _fmpz_vec_equal(a, c, len);
+            fclose(f);
+
+            if (c != NULL)
+                _fmpz_vec_clear(c, l);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL (long vector, %d threads):\n", i - 1);
+            abort();
+        }
+
+        _fmpz_vec_clear(a, len);
+        _fmpz_vec_clear(b, len);
+    }
+
+    /* bad data */
+    {
+        fmpz * b = _fmpz_vec_init(3);
+        FILE * f = fopen("fmpz_vec_bulk_test", "w");
+
+        if (!f)
+        {
+            flint_printf("Error: unable to open file for writing.\n");
+            abort();
+        }
+
+        fputs("12 -3 blah", f);
+        fclose(f);
+
+        f = fopen("fmpz_vec_bulk_test", "r");
+        result = !_fmpz_vec_fread_bulk(f, b, 3)
+              && fmpz_equal_si(b + 0, 12) && fmpz_equal_si(b + 1, -3);
+        fclose(f);
+
+        if (!result)
+        {
+            flint_printf("FAIL (bad data):\n");
+            abort();
+        }
+
+        _fmpz_vec_clear(b, 3);
+    }
+
+    remove("fmpz_vec_bulk_test");
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+#else
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("SKIPPED\n");
+#endif
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "bin_io.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("fwrite_bin....");
+#if !defined( _MSC_VER )
+    fflush(stdout);
+
+    /* write two vectors, read them back and view them in a mapping */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz * a, * b, * c, * d;
+        slong len1, len2, lenb, lenc, lend;
+        flint_bin_map_t map;
+        size_t s1 = 0, s2 = 0;
+        FILE * f = fopen("fmpz_vec_bin_test", "wb");
+
+        if (!f)
+        {
+            flint_printf("Error: unable to open file for writing.\n");
+            abort();
+        }
+
+        len1 = n_randint(state, 100);
+        len2 = n_randint(state, 100);
+        a = _fmpz_vec_init(len1 + len2);
+        _fmpz_vec_randtest(a, state, len1 + len2, n_randint(state, 300) + 1);
+
+        result = _fmpz_vec_fwrite_bin(f, a, len1)
+              && _fmpz_vec_fwrite_bin(f, a + len1, len2);
+        fclose(f);
+
+        f = fopen("fmpz_vec_bin_test", "rb");
+
+        b = NULL;
+        result = result && _fmpz_vec_fread_bin(f, &b, &lenb)
+                        && lenb == len1 && _fmpz_vec_equal(a, b, len1);
+
+        lenc = len2;
+        c = _fmpz_vec_init(len2);
+        result = result && _fmpz_vec_fread_bin(f, &c, &lenc)
+                        && _fmpz_vec_equal(a + len1, c, len2);
+
+        d = NULL;
+        result = result && !_fmpz_vec_fread_bin(f, &d, &lend) && d == NULL;
+
+        fclose(f);
+
+        if (result && flint_bin_map(map, "fmpz_vec_bin_test"))
+        {
+            s1 = _fmpz_vec_bin_view_init(&d, &lend, map->data, map->size);
+            result = (s1 != 0 && lend == len1 && _fmpz_vec_equal(a, d, len1));
+            if (s1 != 0)
+                _fmpz_vec_bin_view_clear(d, map->data);
+
+            s2 = _fmpz_vec_bin_view_init(&d, &lend,
+                                           map->data + s1, map->size - s1);
+            result = result && s2 != 0 && s1 + s2 == map->size
+                            && lend == len2 && _fmpz_vec_equal(a + len1, d, len2);
+            if (s2 != 0)
+                _fmpz_vec_bin_view_clear(d, map->data + s1);
+
+            /* truncated data is rejected */
+            result = result && !_fmpz_vec_bin_view_init(&d, &lend,
+                                           map->data, s1 - sizeof(ulong));
+
+            flint_bin_unmap(map);
+        } else
+            result = 0;
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("len1 = %wd, len2 = %wd, s1 = %wu, s2 = %wu\n",
+                                        len1, len2, (ulong) s1, (ulong) s2);
+            _fmpz_vec_print(a, len1 + len2), flint_printf("\n\n");
+            remove("fmpz_vec_bin_test");
+            abort();
+        }
+
+        if (remove("fmpz_vec_bin_test"))
+        {
+            flint_printf("Error, unable to delete file fmpz_vec_bin_test\n");
+            abort();
+        }
+
+        _fmpz_vec_clear(a, len1 + len2);
+        _fmpz_vec_clear(b, lenb);
+        _fmpz_vec_clear(c, lenc);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+#else
+    flint_printf("SKIPPED\n");
+#endif
+    return 0;
+}
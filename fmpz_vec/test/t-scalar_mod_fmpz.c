@@ -95,6 +95,45 @@ main(void)
         fmpz_clear(p);
     }
 
+    /* Check powers of two against fmpz_mod */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p, r;
+        fmpz *a, *b;
+        slong j, len = n_randint(state, 100);
+
+        fmpz_init(p);
+        fmpz_init(r);
+        fmpz_setbit(p, n_randint(state, 200));
+
+        a = _fmpz_vec_init(len);
+        b = _fmpz_vec_init(len);
+        _fmpz_vec_randtest(a, state, len, 300);
+
+        _fmpz_vec_scalar_mod_fmpz(b, a, len, p);
+
+        result = 1;
+        for (j = 0; j < len; j++)
+        {
+            fmpz_mod(r, a + j, p);
+            result &= fmpz_equal(r, b + j);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            _fmpz_vec_print(a, len), flint_printf("\n\n");
+            _fmpz_vec_print(b, len), flint_printf("\n\n");
+            fmpz_print(p), flint_printf("\n\n");
+            abort();
+        }
+
+        _fmpz_vec_clear(a, len);
+        _fmpz_vec_clear(b, len);
+        fmpz_clear(p);
+        fmpz_clear(r);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -30,10 +30,16 @@
 /* Cutoff between classical and recursive LU decomposition */
 #define FQ_NMOD_MAT_LU_RECURSIVE_CUTOFF 4
 
+/*
+   Cutoff between packed classical and Kronecker substitution
+   multiplication, which falls with the degree and with the size of p
+*/
 FQ_NMOD_MAT_INLINE
 int FQ_NMOD_MAT_MUL_KS_CUTOFF(slong r, slong c, const fq_nmod_ctx_t ctx)
 {
-    if (FLINT_MIN(r, c) > fq_nmod_ctx_degree(ctx) / 20 + 6)
+    slong d = fq_nmod_ctx_degree(ctx), b = FLINT_BIT_COUNT(ctx->mod.n);
+
+    if (FLINT_MIN(r, c) > FLINT_MIN(10*b/(d/16 + 1), 256))
         return 1;
     else
         return 0;
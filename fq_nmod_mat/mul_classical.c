@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -9,14 +10,50 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <gmp.h>
+#include "flint.h"
+#include "fq_nmod_vec.h"
 #include "fq_nmod_mat.h"
 
-#ifdef T
-#undef T
-#endif
+void fq_nmod_mat_mul_classical(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                               const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    slong ar, bc, br;
+    slong i, j;
+    mp_ptr AP, BP;
 
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_mat_templates/mul_classical.c"
-#undef CAP_T
-#undef T
+    ar = A->r;
+    br = B->r;
+    bc = B->c;
+
+    if (br == 0)
+    {
+        fq_nmod_mat_zero(C, ctx);
+        return;
+    }
+
+    /*
+       Pack the rows of A and the columns of B into contiguous arrays, so
+       that each entry of C is a single packed dot product, reduced once.
+       As the inputs are packed before C is written, C may alias A or B.
+    */
+    AP = flint_malloc(ar*br*d*sizeof(mp_limb_t));
+    BP = flint_malloc(bc*br*d*sizeof(mp_limb_t));
+
+    for (i = 0; i < ar; i++)
+        _fq_nmod_vec_pack(AP + i*br*d, A->rows[i], br, ctx);
+
+    for (i = 0; i < br; i++)
+        for (j = 0; j < bc; j++)
+            _fq_nmod_vec_pack(BP + (j*br + i)*d,
+                                       fq_nmod_mat_entry(B, i, j), 1, ctx);
+
+    for (i = 0; i < ar; i++)
+        for (j = 0; j < bc; j++)
+            _fq_nmod_vec_dot_packed(fq_nmod_mat_entry(C, i, j),
+                                    AP + i*br*d, BP + j*br*d, br, ctx);
+
+    flint_free(AP);
+    flint_free(BP);
+}
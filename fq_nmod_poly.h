@@ -29,9 +29,36 @@
 #define FQ_NMOD_POLY_DIVREM_DIVCONQUER_CUTOFF  16
 #define FQ_NMOD_COMPOSE_MOD_LENH_CUTOFF 6
 #define FQ_NMOD_COMPOSE_MOD_PREINV_LENH_CUTOFF 6
-#define FQ_NMOD_MUL_CLASSICAL_CUTOFF 6
-#define FQ_NMOD_SQR_CLASSICAL_CUTOFF 6
-#define FQ_NMOD_MULLOW_CLASSICAL_CUTOFF 6
+
+/*
+   Cutoffs below which the packed classical products beat Kronecker
+   substitution. The crossover falls as the degree of the extension grows
+   and as the prime shrinks, since both shorten the KS integers relative
+   to the classical work per coefficient.
+*/
+FQ_NMOD_POLY_INLINE
+slong FQ_NMOD_MUL_CLASSICAL_CUTOFF(const fq_nmod_ctx_t ctx)
+{
+    slong d = fq_nmod_ctx_degree(ctx), b = FLINT_BIT_COUNT(ctx->mod.n);
+
+    return FLINT_MIN(3*(b + 20)/(d/4 + 2), 96);
+}
+
+FQ_NMOD_POLY_INLINE
+slong FQ_NMOD_SQR_CLASSICAL_CUTOFF(const fq_nmod_ctx_t ctx)
+{
+    slong d = fq_nmod_ctx_degree(ctx), b = FLINT_BIT_COUNT(ctx->mod.n);
+
+    return FLINT_MIN(2*(b + 20)/(d/4 + 2), 64);
+}
+
+FQ_NMOD_POLY_INLINE
+slong FQ_NMOD_MULLOW_CLASSICAL_CUTOFF(const fq_nmod_ctx_t ctx)
+{
+    slong d = fq_nmod_ctx_degree(ctx), b = FLINT_BIT_COUNT(ctx->mod.n);
+
+    return FLINT_MIN(4*(b + 20)/(d/4 + 2), 160);
+}
 
 #define FQ_NMOD_POLY_HGCD_CUTOFF 25
 #define FQ_NMOD_POLY_SMALL_GCD_CUTOFF 110
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -9,14 +10,47 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <gmp.h>
+#include "flint.h"
 #include "fq_nmod_poly.h"
 
-#ifdef T
-#undef T
-#endif
+void _fq_nmod_poly_mul_classical(fq_nmod_struct * rop,
+                                 const fq_nmod_struct * op1, slong len1,
+                                 const fq_nmod_struct * op2, slong len2,
+                                 const fq_nmod_ctx_t ctx)
+{
+    _fq_nmod_poly_mullow_classical(rop, op1, len1, op2, len2,
+                                   len1 + len2 - 1, ctx);
+}
 
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_poly_templates/mul_classical.c"
-#undef CAP_T
-#undef T
+void fq_nmod_poly_mul_classical(fq_nmod_poly_t rop, const fq_nmod_poly_t op1,
+                                const fq_nmod_poly_t op2,
+                                const fq_nmod_ctx_t ctx)
+{
+    const slong len = op1->length + op2->length - 1;
+
+    if (op1->length == 0 || op2->length == 0)
+    {
+        fq_nmod_poly_zero(rop, ctx);
+        return;
+    }
+
+    if (rop == op1 || rop == op2)
+    {
+        fq_nmod_poly_t t;
+
+        fq_nmod_poly_init2(t, len, ctx);
+        _fq_nmod_poly_mul_classical(t->coeffs, op1->coeffs, op1->length,
+                                    op2->coeffs, op2->length, ctx);
+        fq_nmod_poly_swap(rop, t, ctx);
+        fq_nmod_poly_clear(t, ctx);
+    }
+    else
+    {
+        fq_nmod_poly_fit_length(rop, len, ctx);
+        _fq_nmod_poly_mul_classical(rop->coeffs, op1->coeffs, op1->length,
+                                    op2->coeffs, op2->length, ctx);
+    }
+
+    _fq_nmod_poly_set_length(rop, len, ctx);
+}
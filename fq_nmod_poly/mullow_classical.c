@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -9,14 +10,85 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <gmp.h>
+#include "flint.h"
+#include "fq_nmod_vec.h"
 #include "fq_nmod_poly.h"
 
-#ifdef T
-#undef T
-#endif
+void _fq_nmod_poly_mullow_classical(fq_nmod_struct * rop,
+                                    const fq_nmod_struct * op1, slong len1,
+                                    const fq_nmod_struct * op2, slong len2,
+                                    slong n, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    slong i, lo, hi;
+    mp_ptr P1, P2;
 
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_poly_templates/mullow_classical.c"
-#undef CAP_T
-#undef T
+    if ((len1 == 1 && len2 == 1) || n == 1)
+    {
+        fq_nmod_mul(rop, op1, op2, ctx);
+        return;
+    }
+
+    len1 = FLINT_MIN(len1, n);
+    len2 = FLINT_MIN(len2, n);
+
+    /*
+       Pack op1 and the reverse of op2, so that each coefficient of the
+       product is a packed dot product of contiguous runs, reduced once.
+    */
+    P1 = flint_malloc((len1 + len2)*d*sizeof(mp_limb_t));
+    P2 = P1 + len1*d;
+
+    _fq_nmod_vec_pack(P1, op1, len1, ctx);
+    for (i = 0; i < len2; i++)
+        _fq_nmod_vec_pack(P2 + (len2 - 1 - i)*d, op2 + i, 1, ctx);
+
+    for (i = 0; i < n; i++)
+    {
+        lo = FLINT_MAX(0, i - len2 + 1);
+        hi = FLINT_MIN(len1 - 1, i);
+
+        _fq_nmod_vec_dot_packed(rop + i, P1 + lo*d,
+                                P2 + (len2 - 1 - i + lo)*d, hi - lo + 1, ctx);
+    }
+
+    flint_free(P1);
+}
+
+void fq_nmod_poly_mullow_classical(fq_nmod_poly_t rop,
+                                   const fq_nmod_poly_t op1,
+                                   const fq_nmod_poly_t op2, slong n,
+                                   const fq_nmod_ctx_t ctx)
+{
+    const slong len = op1->length + op2->length - 1;
+
+    if (op1->length == 0 || op2->length == 0 || n == 0)
+    {
+        fq_nmod_poly_zero(rop, ctx);
+        return;
+    }
+
+    if (n > len)
+        n = len;
+
+    if (rop == op1 || rop == op2)
+    {
+        fq_nmod_poly_t t;
+
+        fq_nmod_poly_init2(t, n, ctx);
+        _fq_nmod_poly_mullow_classical(t->coeffs, op1->coeffs, op1->length,
+                                       op2->coeffs, op2->length, n, ctx);
+        fq_nmod_poly_swap(rop, t, ctx);
+        fq_nmod_poly_clear(t, ctx);
+    }
+    else
+    {
+        fq_nmod_poly_fit_length(rop, n, ctx);
+        _fq_nmod_poly_mullow_classical(rop->coeffs, op1->coeffs, op1->length,
+                                       op2->coeffs, op2->length, n, ctx);
+    }
+
+    _fq_nmod_poly_set_length(rop, n, ctx);
+    _fq_nmod_poly_normalise(rop, ctx);
+}
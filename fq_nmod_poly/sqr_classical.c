@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -9,14 +10,43 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <gmp.h>
+#include "flint.h"
 #include "fq_nmod_poly.h"
 
-#ifdef T
-#undef T
-#endif
+void _fq_nmod_poly_sqr_classical(fq_nmod_struct * rop,
+                                 const fq_nmod_struct * op, slong len,
+                                 const fq_nmod_ctx_t ctx)
+{
+    /* the packed product beats the symmetric template code */
+    _fq_nmod_poly_mullow_classical(rop, op, len, op, len, 2*len - 1, ctx);
+}
 
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_poly_templates/sqr_classical.c"
-#undef CAP_T
-#undef T
+void fq_nmod_poly_sqr_classical(fq_nmod_poly_t rop, const fq_nmod_poly_t op,
+                                const fq_nmod_ctx_t ctx)
+{
+    const slong len = 2*op->length - 1;
+
+    if (op->length == 0)
+    {
+        fq_nmod_poly_zero(rop, ctx);
+        return;
+    }
+
+    if (rop == op)
+    {
+        fq_nmod_poly_t t;
+
+        fq_nmod_poly_init2(t, len, ctx);
+        _fq_nmod_poly_sqr_classical(t->coeffs, op->coeffs, op->length, ctx);
+        fq_nmod_poly_swap(rop, t, ctx);
+        fq_nmod_poly_clear(t, ctx);
+    }
+    else
+    {
+        fq_nmod_poly_fit_length(rop, len, ctx);
+        _fq_nmod_poly_sqr_classical(rop->coeffs, op->coeffs, op->length, ctx);
+    }
+
+    _fq_nmod_poly_set_length(rop, len, ctx);
+}
@@ -48,4 +48,26 @@ do {                                          \
 #undef CAP_T
 #undef T
 
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*  Packed vectors ***********************************************************/
+
+/*
+   A packed vector of length len stores element i as the d coefficients
+   P[i*d], ..., P[i*d + d - 1], zero padded, where d is the degree of the
+   field, so that the whole vector is one contiguous array of len*d limbs.
+*/
+
+FLINT_DLL void _fq_nmod_vec_pack(mp_ptr P, const fq_nmod_struct * vec,
+                                 slong len, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void _fq_nmod_vec_dot_packed(fq_nmod_t res, mp_srcptr A,
+                      mp_srcptr B, slong len, const fq_nmod_ctx_t ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
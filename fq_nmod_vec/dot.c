@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -9,14 +10,32 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <gmp.h>
+#include "flint.h"
 #include "fq_nmod_vec.h"
 
-#ifdef T
-#undef T
-#endif
+void _fq_nmod_vec_dot(fq_nmod_t res, const fq_nmod_struct * vec1,
+                      const fq_nmod_struct * vec2, slong len2,
+                      const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    mp_ptr P;
+    TMP_INIT;
 
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_vec_templates/dot.c"
-#undef CAP_T
-#undef T
+    if (len2 == 0)
+    {
+        fq_nmod_zero(res, ctx);
+        return;
+    }
+
+    TMP_START;
+
+    P = TMP_ALLOC(2*len2*d*sizeof(mp_limb_t));
+
+    _fq_nmod_vec_pack(P, vec1, len2, ctx);
+    _fq_nmod_vec_pack(P + len2*d, vec2, len2, ctx);
+
+    _fq_nmod_vec_dot_packed(res, P, P + len2*d, len2, ctx);
+
+    TMP_END;
+}
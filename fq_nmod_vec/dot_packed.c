@@ -0,0 +1,124 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "longlong.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "fq_nmod_vec.h"
+
+void _fq_nmod_vec_dot_packed(fq_nmod_t res, mp_srcptr A, mp_srcptr B,
+                                        slong len, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    const slong m = 2*d - 1;
+    const nmod_t mod = ctx->mod;
+    slong i, j, k;
+    mp_limb_t a, t0, t1;
+    mp_ptr r, s;
+    int nlimbs;
+    TMP_INIT;
+
+    if (len == 0)
+    {
+        fq_nmod_zero(res, ctx);
+        return;
+    }
+
+    /* each unreduced coefficient is a sum of at most len*d products */
+    nlimbs = _nmod_vec_dot_bound_limbs(len*d, mod);
+
+    nmod_poly_fit_length(res, m);
+    r = res->coeffs;
+
+    if (nlimbs <= 1)
+    {
+        _nmod_vec_zero(r, m);
+
+        for (k = 0; k < len; k++, A += d, B += d)
+        {
+            for (i = 0; i < d; i++)
+            {
+                if ((a = A[i]) == 0)
+                    continue;
+
+                for (j = 0; j < d; j++)
+                    r[i + j] += a*B[j];
+            }
+        }
+
+        for (i = 0; i < m; i++)
+            NMOD_RED(r[i], r[i], mod);
+    }
+    else
+    {
+        TMP_START;
+
+        s = TMP_ALLOC(nlimbs*m*sizeof(mp_limb_t));
+        flint_mpn_zero(s, nlimbs*m);
+
+        if (nlimbs == 2)
+        {
+            for (k = 0; k < len; k++, A += d, B += d)
+            {
+                for (i = 0; i < d; i++)
+                {
+                    if ((a = A[i]) == 0)
+                        continue;
+
+                    for (j = 0; j < d; j++)
+                    {
+                        mp_ptr u = s + 2*(i + j);
+
+                        umul_ppmm(t1, t0, a, B[j]);
+                        add_ssaaaa(u[1], u[0], u[1], u[0], t1, t0);
+                    }
+                }
+            }
+
+            for (i = 0; i < m; i++)
+                NMOD2_RED2(r[i], s[2*i + 1], s[2*i], mod);
+        }
+        else
+        {
+            for (k = 0; k < len; k++, A += d, B += d)
+            {
+                for (i = 0; i < d; i++)
+                {
+                    if ((a = A[i]) == 0)
+                        continue;
+
+                    for (j = 0; j < d; j++)
+                    {
+                        mp_ptr u = s + 3*(i + j);
+
+                        umul_ppmm(t1, t0, a, B[j]);
+                        add_sssaaaaaa(u[2], u[1], u[0], u[2], u[1], u[0],
+                                                        UWORD(0), t1, t0);
+                    }
+                }
+            }
+
+            for (i = 0; i < m; i++)
+            {
+                NMOD_RED(t1, s[3*i + 2], mod);
+                NMOD_RED3(r[i], t1, s[3*i + 1], s[3*i], mod);
+            }
+        }
+
+        TMP_END;
+    }
+
+    _fq_nmod_reduce(r, m, ctx);
+    res->length = d;
+    _nmod_poly_normalise(res);
+}
@@ -0,0 +1,28 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "fq_nmod_vec.h"
+
+void _fq_nmod_vec_pack(mp_ptr P, const fq_nmod_struct * vec, slong len,
+                                                     const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    slong i;
+
+    for (i = 0; i < len; i++, P += d)
+    {
+        _nmod_vec_set(P, vec[i].coeffs, vec[i].length);
+        _nmod_vec_zero(P + vec[i].length, d - vec[i].length);
+    }
+}
@@ -0,0 +1,88 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fq_nmod_vec.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("dot....");
+    fflush(stdout);
+
+    /* Compare with the unpacked product, for primes of any size */
+    for (i = 0; i < 2000 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        fq_nmod_struct * a, * b;
+        fq_nmod_t r1, r2, t;
+        fmpz_t p;
+        slong j, len, d;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randtest_prime(state, 0));
+        d = n_randint(state, 6) + 1;
+        fq_nmod_ctx_init(ctx, p, d, "a");
+
+        len = n_randint(state, 30);
+
+        a = _fq_nmod_vec_init(len, ctx);
+        b = _fq_nmod_vec_init(len, ctx);
+        fq_nmod_init(r1, ctx);
+        fq_nmod_init(r2, ctx);
+        fq_nmod_init(t, ctx);
+
+        _fq_nmod_vec_randtest(a, state, len, ctx);
+        _fq_nmod_vec_randtest(b, state, len, ctx);
+        fq_nmod_randtest(r1, state, ctx);
+
+        _fq_nmod_vec_dot(r1, a, b, len, ctx);
+
+        fq_nmod_zero(r2, ctx);
+        for (j = 0; j < len; j++)
+        {
+            fq_nmod_mul(t, a + j, b + j, ctx);
+            fq_nmod_add(r2, r2, t, ctx);
+        }
+
+        result = fq_nmod_equal(r1, r2, ctx);
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("p = "); fmpz_print(p); flint_printf("\n");
+            flint_printf("d = %wd, len = %wd\n", d, len);
+            flint_printf("r1 = "); fq_nmod_print_pretty(r1, ctx);
+            flint_printf("\nr2 = "); fq_nmod_print_pretty(r2, ctx);
+            flint_printf("\n");
+            abort();
+        }
+
+        _fq_nmod_vec_clear(a, len, ctx);
+        _fq_nmod_vec_clear(b, len, ctx);
+        fq_nmod_clear(r1, ctx);
+        fq_nmod_clear(r2, ctx);
+        fq_nmod_clear(t, ctx);
+        fq_nmod_ctx_clear(ctx);
+        fmpz_clear(p);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
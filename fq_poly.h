@@ -28,9 +28,9 @@
 #define FQ_POLY_DIVREM_DIVCONQUER_CUTOFF  16
 #define FQ_COMPOSE_MOD_LENH_CUTOFF 6
 #define FQ_COMPOSE_MOD_PREINV_LENH_CUTOFF 6
-#define FQ_MUL_CLASSICAL_CUTOFF 6
-#define FQ_MULLOW_CLASSICAL_CUTOFF 6
-#define FQ_SQR_CLASSICAL_CUTOFF 6
+#define FQ_MUL_CLASSICAL_CUTOFF(ctx) 6
+#define FQ_MULLOW_CLASSICAL_CUTOFF(ctx) 6
+#define FQ_SQR_CLASSICAL_CUTOFF(ctx) 6
 
 #define FQ_POLY_HGCD_CUTOFF 30
 #define FQ_POLY_SMALL_GCD_CUTOFF 80
@@ -21,7 +21,7 @@ _TEMPLATE(T, poly_mullow) (TEMPLATE(T, struct) * rop,
                            const TEMPLATE(T, struct) * op2, slong len2,
                            slong n, const TEMPLATE(T, ctx_t) ctx)
 {
-    if (n < TEMPLATE(CAP_T, MULLOW_CLASSICAL_CUTOFF)
+    if (n < TEMPLATE(CAP_T, MULLOW_CLASSICAL_CUTOFF)(ctx)
         || FLINT_MAX(len1, len2) < 6)
     {
         _TEMPLATE(T, poly_mullow_classical) (rop, op1, len1, op2, len2, n,
@@ -19,7 +19,7 @@ _TEMPLATE(T, poly_sqr) (TEMPLATE(T, struct) * rop,
                         const TEMPLATE(T, struct) * op, slong len,
                         const TEMPLATE(T, ctx_t) ctx)
 {
-    if (len < TEMPLATE(CAP_T, SQR_CLASSICAL_CUTOFF))
+    if (len < TEMPLATE(CAP_T, SQR_CLASSICAL_CUTOFF)(ctx))
     {
         _TEMPLATE(T, poly_sqr_classical) (rop, op, len, ctx);
     }
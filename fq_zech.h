@@ -49,6 +49,9 @@ typedef struct
     fq_nmod_ctx_struct *fq_nmod_ctx;
     int owns_fq_nmod_ctx;
 
+    void *table_map;            /* mapped table file, or NULL if malloc'd */
+    size_t table_map_size;
+
 } fq_zech_ctx_struct;
 
 typedef fq_zech_ctx_struct fq_zech_ctx_t[1];
@@ -65,6 +68,59 @@ FLINT_DLL void fq_zech_ctx_init_modulus(fq_zech_ctx_t ctx,
                               const nmod_poly_t modulus,
                               const char *var);
 
+FLINT_DLL void _fq_zech_ctx_init_params(fq_zech_ctx_t ctx,
+                                        fq_nmod_ctx_t fq_nmod_ctx);
+
+FLINT_DLL void _fq_zech_ctx_init_tables(fq_zech_ctx_t ctx);
+
+/*
+   Table files hold a header, the d + 1 coefficients of the modulus, then
+   zech_log_table (q limbs), prime_field_table (p limbs) and eval_table
+   (q limbs), all as native limbs. The header records the encoding of the
+   generator and a checksum of everything after the header.
+*/
+#define FQ_ZECH_TABLES_VERSION 2
+
+/* number of random table entries checked against fq_nmod when mapping */
+#define FQ_ZECH_TABLES_SPOT_CHECKS 8
+
+#if !defined(_MSC_VER) && !defined(__MINGW32__) && !defined(__MINGW64__)
+#define FQ_ZECH_TABLES_MMAP 1
+#else
+#define FQ_ZECH_TABLES_MMAP 0
+#endif
+
+typedef struct
+{
+    char magic[8];
+    mp_limb_t version;
+    mp_limb_t bits;
+    mp_limb_t endian;
+    mp_limb_t p;
+    mp_limb_t d;
+    mp_limb_t q;
+    mp_limb_t prime_root;
+    mp_limb_t generator;
+    mp_limb_t checksum;
+} fq_zech_tables_header_struct;
+
+FLINT_DLL char * _fq_zech_ctx_tables_filename(const char * dir,
+                                              const fq_nmod_ctx_t fq_nmod_ctx);
+
+FLINT_DLL mp_limb_t _fq_zech_ctx_tables_checksum(mp_limb_t h,
+                                                 mp_srcptr data, slong len);
+
+FLINT_DLL int fq_zech_ctx_write_tables(const char * filename,
+                                       const fq_zech_ctx_t ctx);
+
+FLINT_DLL int _fq_zech_ctx_map_tables(fq_zech_ctx_t ctx, const char * filename);
+
+FLINT_DLL int fq_zech_ctx_init_fq_nmod_ctx_cached(fq_zech_ctx_t ctx,
+                              fq_nmod_ctx_t fq_nmod_ctx, const char * dir);
+
+FLINT_DLL int fq_zech_ctx_init_cached(fq_zech_ctx_t ctx, const fmpz_t p,
+                              slong d, const char *var, const char * dir);
+
 FLINT_DLL void fq_zech_ctx_randtest(fq_zech_ctx_t ctx, flint_rand_t state);
 
 FLINT_DLL void fq_zech_ctx_randtest_reducible(fq_zech_ctx_t ctx, flint_rand_t state);
@@ -14,12 +14,25 @@
 
 #include "fq_zech.h"
 
+#if FQ_ZECH_TABLES_MMAP
+#include <sys/mman.h>
+#endif
+
 void
 fq_zech_ctx_clear(fq_zech_ctx_t ctx)
 {
-    flint_free(ctx->zech_log_table);
-    flint_free(ctx->prime_field_table);
-    flint_free(ctx->eval_table);
+    if (ctx->table_map != NULL)
+    {
+#if FQ_ZECH_TABLES_MMAP
+        munmap(ctx->table_map, ctx->table_map_size);
+#endif
+    }
+    else
+    {
+        flint_free(ctx->zech_log_table);
+        flint_free(ctx->prime_field_table);
+        flint_free(ctx->eval_table);
+    }
 
     if (ctx->owns_fq_nmod_ctx)
     {
@@ -78,18 +78,15 @@ fq_zech_ctx_init_modulus(fq_zech_ctx_t ctx,
 
 
 void
-fq_zech_ctx_init_fq_nmod_ctx(fq_zech_ctx_t ctx,
-                             fq_nmod_ctx_t fq_nmod_ctx)
+_fq_zech_ctx_init_params(fq_zech_ctx_t ctx, fq_nmod_ctx_t fq_nmod_ctx)
 {
-    ulong i, n;
-    fq_nmod_t r, gen;
-    slong up, q;
-    fmpz_t result, order;
-    mp_limb_t j, nz, result_ui;
-    mp_limb_t *n_reverse_table;
+    fmpz_t order;
+    mp_limb_t up;
 
     ctx->fq_nmod_ctx = fq_nmod_ctx;
     ctx->owns_fq_nmod_ctx = 0;
+    ctx->table_map = NULL;
+    ctx->table_map_size = 0;
 
     fmpz_init(order);
     fq_nmod_ctx_order(order, fq_nmod_ctx);
@@ -100,12 +97,11 @@ fq_zech_ctx_init_fq_nmod_ctx(fq_zech_ctx_t ctx,
         flint_abort();
     }
 
-    q = fmpz_get_ui(order);
     up = fmpz_get_ui(fq_nmod_ctx_prime(fq_nmod_ctx));
 
     ctx->p = up;
     ctx->ppre = n_precompute_inverse(ctx->p);
-    ctx->qm1 = q - 1;
+    ctx->qm1 = fmpz_get_ui(order) - 1;
 
     if (up == 2)
     {
@@ -120,6 +116,23 @@ fq_zech_ctx_init_fq_nmod_ctx(fq_zech_ctx_t ctx,
 
     ctx->prime_root = n_primitive_root_prime(ctx->p);
 
+    fmpz_clear(order);
+}
+
+void
+_fq_zech_ctx_init_tables(fq_zech_ctx_t ctx)
+{
+    ulong i, n;
+    fq_nmod_t r, gen;
+    slong up, q;
+    fmpz_t result;
+    mp_limb_t j, nz, result_ui;
+    mp_limb_t *n_reverse_table;
+    fq_nmod_ctx_struct * fq_nmod_ctx = ctx->fq_nmod_ctx;
+
+    q = ctx->qm1 + 1;
+    up = ctx->p;
+
     ctx->zech_log_table = (mp_limb_t *) flint_malloc(q * sizeof(mp_limb_t));
     ctx->prime_field_table = (mp_limb_t *) flint_malloc(up * sizeof(mp_limb_t));
     n_reverse_table = (mp_limb_t *) flint_malloc(q * sizeof(mp_limb_t));
@@ -170,5 +183,12 @@ fq_zech_ctx_init_fq_nmod_ctx(fq_zech_ctx_t ctx,
     fq_nmod_clear(gen, fq_nmod_ctx);
     flint_free(n_reverse_table);
     fmpz_clear(result);
-    fmpz_clear(order);
+}
+
+void
+fq_zech_ctx_init_fq_nmod_ctx(fq_zech_ctx_t ctx,
+                             fq_nmod_ctx_t fq_nmod_ctx)
+{
+    _fq_zech_ctx_init_params(ctx, fq_nmod_ctx);
+    _fq_zech_ctx_init_tables(ctx);
 }
@@ -0,0 +1,53 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "fq_zech.h"
+
+int
+fq_zech_ctx_init_fq_nmod_ctx_cached(fq_zech_ctx_t ctx,
+                                fq_nmod_ctx_t fq_nmod_ctx, const char * dir)
+{
+    char * filename;
+    int cached;
+
+    _fq_zech_ctx_init_params(ctx, fq_nmod_ctx);
+
+    filename = _fq_zech_ctx_tables_filename(dir, fq_nmod_ctx);
+
+    cached = _fq_zech_ctx_map_tables(ctx, filename);
+
+    if (!cached)
+    {
+        _fq_zech_ctx_init_tables(ctx);
+        fq_zech_ctx_write_tables(filename, ctx);
+    }
+
+    flint_free(filename);
+
+    return cached;
+}
+
+int
+fq_zech_ctx_init_cached(fq_zech_ctx_t ctx, const fmpz_t p, slong d,
+                        const char *var, const char * dir)
+{
+    fq_nmod_ctx_struct * fq_nmod_ctx;
+    int cached;
+
+    fq_nmod_ctx = flint_malloc(sizeof(fq_nmod_ctx_struct));
+
+    fq_nmod_ctx_init(fq_nmod_ctx, p, d, var);
+    cached = fq_zech_ctx_init_fq_nmod_ctx_cached(ctx, fq_nmod_ctx, dir);
+    ctx->owns_fq_nmod_ctx = 1;
+
+    return cached;
+}
@@ -0,0 +1,158 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include "flint.h"
+#include "fq_zech.h"
+
+#if FQ_ZECH_TABLES_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#if FQ_ZECH_TABLES_MMAP
+/* the integer sum_i a_i p^i encoding the element a of the field */
+static mp_limb_t
+_fq_zech_encode(const fq_nmod_t a, mp_limb_t p)
+{
+    mp_limb_t e = 0;
+    slong i;
+
+    for (i = a->length - 1; i >= 0; i--)
+        e = e*p + a->coeffs[i];
+
+    return e;
+}
+
+/*
+   The tables are used as indices into each other, so a damaged file must
+   not be trusted. The checksum, compared beforehand, detects damage with a
+   single sequential read. Checking every entry against the others would
+   mean random accesses all over the file, so instead the generator and a
+   few random entries are compared with powers computed by fq_nmod, which
+   rejects tables built for another generator or by faulty code.
+*/
+static int
+_fq_zech_tables_valid(const fq_zech_ctx_t ctx, mp_limb_t generator,
+                      const mp_limb_t * zech_log_table,
+                      const mp_limb_t * prime_field_table,
+                      const mp_limb_t * eval_table)
+{
+    const fq_nmod_ctx_struct * fq_nmod_ctx = ctx->fq_nmod_ctx;
+    const mp_limb_t p = ctx->p, q = ctx->qm1 + 1;
+    mp_limb_t i, e;
+    flint_rand_t state;
+    fq_nmod_t g, r;
+    int k, valid;
+
+    fq_nmod_init(g, fq_nmod_ctx);
+    fq_nmod_init(r, fq_nmod_ctx);
+    fq_nmod_gen(g, fq_nmod_ctx);
+    flint_randinit(state);
+
+    /* g^1 is the generator and only the representative q - 1 of zero
+       evaluates to 0 */
+    valid = (generator == _fq_zech_encode(g, p))
+         && (eval_table[1 % ctx->qm1] == generator)
+         && (eval_table[q - 1] == 0);
+
+    for (k = 0; k < FQ_ZECH_TABLES_SPOT_CHECKS && valid; k++)
+    {
+        i = n_randint(state, ctx->qm1);
+
+        fq_nmod_pow_ui(r, g, i, fq_nmod_ctx);
+        e = eval_table[i];
+
+        /* the element 1 + g^i has its constant coefficient incremented */
+        valid = (e == _fq_zech_encode(r, p)) && (zech_log_table[i] < q)
+             && (eval_table[zech_log_table[i]]
+                             == ((e % p == p - 1) ? e - p + 1 : e + 1));
+
+        i = n_randint(state, p);
+        valid = valid && (prime_field_table[i] < q)
+                      && (eval_table[prime_field_table[i]] == i);
+    }
+
+    flint_randclear(state);
+    fq_nmod_clear(g, fq_nmod_ctx);
+    fq_nmod_clear(r, fq_nmod_ctx);
+
+    return valid;
+}
+#endif
+
+int
+_fq_zech_ctx_map_tables(fq_zech_ctx_t ctx, const char * filename)
+{
+#if FQ_ZECH_TABLES_MMAP
+    const nmod_poly_struct * f = ctx->fq_nmod_ctx->modulus;
+    const mp_limb_t q = ctx->qm1 + 1;
+    const fq_zech_tables_header_struct * h;
+    struct stat st;
+    mp_ptr data;
+    size_t size;
+    void * map;
+    int fd;
+
+    size = sizeof(fq_zech_tables_header_struct)
+         + (f->length + 2*q + ctx->p)*sizeof(mp_limb_t);
+
+    fd = open(filename, O_RDONLY);
+
+    if (fd < 0)
+        return 0;
+
+    if (fstat(fd, &st) != 0 || (size_t) st.st_size != size)
+    {
+        close(fd);
+        return 0;
+    }
+
+    map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (map == MAP_FAILED)
+        return 0;
+
+    h = (const fq_zech_tables_header_struct *) map;
+    data = (mp_ptr) (h + 1);
+
+    if (memcmp(h->magic, "FQZECH\0\0", 8) != 0
+        || h->version != FQ_ZECH_TABLES_VERSION
+        || h->bits != FLINT_BITS || h->endian != 1
+        || h->p != ctx->p || h->d != f->length - 1 || h->q != q
+        || h->prime_root != ctx->prime_root
+        || memcmp(data, f->coeffs, f->length*sizeof(mp_limb_t)) != 0
+        || h->checksum != _fq_zech_ctx_tables_checksum(0, data,
+                                                 f->length + 2*q + ctx->p)
+        || !_fq_zech_tables_valid(ctx, h->generator, data + f->length,
+                  data + f->length + q, data + f->length + q + ctx->p))
+    {
+        munmap(map, size);
+        return 0;
+    }
+
+    /* the tables are only ever read, so they can point into the mapping */
+    ctx->zech_log_table = data + f->length;
+    ctx->prime_field_table = ctx->zech_log_table + q;
+    ctx->eval_table = ctx->prime_field_table + ctx->p;
+
+    ctx->table_map = map;
+    ctx->table_map_size = size;
+
+    return 1;
+#else
+    return 0;
+#endif
+}
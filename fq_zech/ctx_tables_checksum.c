@@ -0,0 +1,35 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "fq_zech.h"
+
+#if FLINT64
+#define CHECKSUM_PRIME UWORD(0x100000001b3)
+#else
+#define CHECKSUM_PRIME UWORD(0x01000193)
+#endif
+
+mp_limb_t
+_fq_zech_ctx_tables_checksum(mp_limb_t h, mp_srcptr data, slong len)
+{
+    slong i;
+
+    /* a multiplicative hash, so that swapped or shifted entries change it */
+    for (i = 0; i < len; i++)
+    {
+        h ^= data[i];
+        h *= CHECKSUM_PRIME;
+        h ^= h >> (FLINT_BITS/2 - 3);
+    }
+
+    return h;
+}
@@ -0,0 +1,45 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+
+#include "flint.h"
+#include "fq_zech.h"
+
+char *
+_fq_zech_ctx_tables_filename(const char * dir, const fq_nmod_ctx_t fq_nmod_ctx)
+{
+    const nmod_poly_struct * f = fq_nmod_ctx_modulus(fq_nmod_ctx);
+    char * s;
+    slong i;
+#if FLINT64
+    mp_limb_t h = UWORD(0xcbf29ce484222325);
+    const mp_limb_t m = UWORD(0x100000001b3);
+#else
+    mp_limb_t h = UWORD(0x811c9dc5);
+    const mp_limb_t m = UWORD(0x01000193);
+#endif
+
+    /* FNV-1a over the limbs of the modulus; the file header holds the
+       modulus itself, so a collision only costs a rebuild */
+    for (i = 0; i < f->length; i++)
+    {
+        h ^= f->coeffs[i];
+        h *= m;
+    }
+
+    s = flint_malloc(strlen(dir) + 3*FLINT_BITS/2 + 32);
+
+    flint_sprintf(s, "%s/fq_zech_%wu_%wd_%wx.tbl", dir, fq_nmod_ctx->mod.n,
+                                             fq_nmod_ctx_degree(fq_nmod_ctx), h);
+
+    return s;
+}
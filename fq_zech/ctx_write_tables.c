@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "flint.h"
+#include "fq_zech.h"
+
+#if FQ_ZECH_TABLES_MMAP
+#include <unistd.h>
+#endif
+
+int
+fq_zech_ctx_write_tables(const char * filename, const fq_zech_ctx_t ctx)
+{
+    const nmod_poly_struct * f = ctx->fq_nmod_ctx->modulus;
+    const mp_limb_t q = ctx->qm1 + 1;
+    fq_zech_tables_header_struct h;
+    FILE * file;
+    char * tmp;
+    int ok;
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, "FQZECH\0\0", 8);
+    h.version = FQ_ZECH_TABLES_VERSION;
+    h.bits = FLINT_BITS;
+    h.endian = 1;
+    h.p = ctx->p;
+    h.d = f->length - 1;
+    h.q = q;
+    h.prime_root = ctx->prime_root;
+    h.generator = ctx->eval_table[1 % ctx->qm1];
+
+    h.checksum = _fq_zech_ctx_tables_checksum(0, f->coeffs, f->length);
+    h.checksum = _fq_zech_ctx_tables_checksum(h.checksum,
+                                              ctx->zech_log_table, q);
+    h.checksum = _fq_zech_ctx_tables_checksum(h.checksum,
+                                              ctx->prime_field_table, ctx->p);
+    h.checksum = _fq_zech_ctx_tables_checksum(h.checksum,
+                                              ctx->eval_table, q);
+
+    /* write to a temporary file and rename it, so that concurrent readers
+       never see a partially written file */
+    tmp = flint_malloc(strlen(filename) + 32);
+#if FQ_ZECH_TABLES_MMAP
+    flint_sprintf(tmp, "%s.tmp.%wd", filename, (slong) getpid());
+#else
+    flint_sprintf(tmp, "%s.tmp", filename);
+#endif
+
+    file = fopen(tmp, "wb");
+
+    if (file == NULL)
+    {
+        flint_free(tmp);
+        return 0;
+    }
+
+    ok = fwrite(&h, sizeof(h), 1, file) == 1
+      && fwrite(f->coeffs, sizeof(mp_limb_t), f->length, file) == f->length
+      && fwrite(ctx->zech_log_table, sizeof(mp_limb_t), q, file) == q
+      && fwrite(ctx->prime_field_table, sizeof(mp_limb_t), ctx->p, file)
+                                                                    == ctx->p
+      && fwrite(ctx->eval_table, sizeof(mp_limb_t), q, file) == q;
+
+    ok = (fclose(file) == 0) && ok;
+
+    if (ok)
+        ok = (rename(tmp, filename) == 0);
+
+    if (!ok)
+        remove(tmp);
+
+    flint_free(tmp);
+
+    return ok;
+}
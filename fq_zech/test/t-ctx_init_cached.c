@@ -0,0 +1,187 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fq_zech.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong primes[6] = { 2, 3, 5, 7, 11, 13 };
+    slong degrees[6] = { 12, 7, 5, 4, 3, 3 };
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("ctx_init_cached....");
+    fflush(stdout);
+
+    for (i = 0; i < 6; i++)
+    {
+        fq_zech_ctx_t ctx1, ctx2;
+        fmpz_t p;
+        char * filename;
+        FILE * file;
+        mp_limb_t q;
+        int c1, c2, c3;
+
+        fmpz_init_set_ui(p, primes[i]);
+
+        fq_zech_ctx_init(ctx1, p, degrees[i], "a");
+        q = ctx1->qm1 + 1;
+
+        filename = _fq_zech_ctx_tables_filename(".", ctx1->fq_nmod_ctx);
+        remove(filename);
+
+        /* the first init builds and writes the tables, the second maps
+           them where mmap is available */
+        c1 = fq_zech_ctx_init_cached(ctx2, p, degrees[i], "a", ".");
+        fq_zech_ctx_clear(ctx2);
+        c2 = fq_zech_ctx_init_cached(ctx2, p, degrees[i], "a", ".");
+
+        result = !c1 && (c2 == FQ_ZECH_TABLES_MMAP)
+            && ctx1->qm1 == ctx2->qm1 && ctx1->prime_root == ctx2->prime_root
+            && memcmp(ctx1->zech_log_table, ctx2->zech_log_table,
+                                             q*sizeof(mp_limb_t)) == 0
+            && memcmp(ctx1->prime_field_table, ctx2->prime_field_table,
+                                          ctx1->p*sizeof(mp_limb_t)) == 0
+            && memcmp(ctx1->eval_table, ctx2->eval_table,
+                                             q*sizeof(mp_limb_t)) == 0;
+
+        fq_zech_ctx_clear(ctx2);
+
+        /* a truncated file must be rejected */
+        if (result && FQ_ZECH_TABLES_MMAP)
+        {
+            file = fopen(filename, "wb");
+            fwrite("FQZECH", 1, 6, file);
+            fclose(file);
+
+            c3 = fq_zech_ctx_init_cached(ctx2, p, degrees[i], "a", ".");
+
+            result = !c3 && memcmp(ctx1->zech_log_table,
+                          ctx2->zech_log_table, q*sizeof(mp_limb_t)) == 0;
+
+            fq_zech_ctx_clear(ctx2);
+        }
+
+        /* files whose tables are out of range or inconsistent must be
+           rejected; the rejected init above rewrote a valid file */
+        if (result && FQ_ZECH_TABLES_MMAP)
+        {
+            mp_limb_t w;
+            long off;
+            int j;
+
+            for (j = 0; j < 2 && result; j++)
+            {
+                off = sizeof(fq_zech_tables_header_struct)
+                    + (degrees[i] + 1 + n_randint(state, 2*q + ctx1->p))
+                                                        *sizeof(mp_limb_t);
+
+                file = fopen(filename, "r+b");
+                fseek(file, off, SEEK_SET);
+                if (fread(&w, sizeof(mp_limb_t), 1, file) != 1)
+                    w = 0;
+
+                /* an out of range entry, or a different one in range */
+                w = (j == 0) ? q + n_randint(state, 1000) : (w == 0);
+
+                fseek(file, off, SEEK_SET);
+                fwrite(&w, sizeof(mp_limb_t), 1, file);
+                fclose(file);
+
+                c3 = fq_zech_ctx_init_cached(ctx2, p, degrees[i], "a", ".");
+
+                result = !c3 && memcmp(ctx1->eval_table,
+                              ctx2->eval_table, q*sizeof(mp_limb_t)) == 0;
+
+                fq_zech_ctx_clear(ctx2);
+            }
+        }
+
+        /* a wrong generator in the header, and tables with a correct
+           checksum but entries which are not the powers of the generator,
+           must be rejected */
+        if (result && FQ_ZECH_TABLES_MMAP)
+        {
+            fq_zech_tables_header_struct * h;
+            mp_ptr data, eval;
+            slong len, j, k;
+            size_t size;
+
+            len = degrees[i] + 1 + 2*q + ctx1->p;
+            size = sizeof(fq_zech_tables_header_struct)
+                 + len*sizeof(mp_limb_t);
+            h = flint_malloc(size);
+            data = (mp_ptr) (h + 1);
+            eval = data + degrees[i] + 1 + q + ctx1->p;
+
+            for (k = 0; k < 2 && result; k++)
+            {
+                c3 = fq_zech_ctx_init_cached(ctx2, p, degrees[i], "a", ".");
+                fq_zech_ctx_clear(ctx2);
+
+                file = fopen(filename, "rb");
+                result = (fread(h, size, 1, file) == 1);
+                fclose(file);
+
+                if (k == 0)
+                    h->generator++;
+                else
+                {
+                    for (j = 2; j + 1 < q - 1; j += 2)
+                    {
+                        mp_limb_t t = eval[j];
+                        eval[j] = eval[j + 1];
+                        eval[j + 1] = t;
+                    }
+
+                    h->checksum = _fq_zech_ctx_tables_checksum(0, data, len);
+                }
+
+                file = fopen(filename, "wb");
+                result = result && (fwrite(h, size, 1, file) == 1);
+                fclose(file);
+
+                c3 = fq_zech_ctx_init_cached(ctx2, p, degrees[i], "a", ".");
+
+                result = result && !c3 && memcmp(ctx1->eval_table,
+                              ctx2->eval_table, q*sizeof(mp_limb_t)) == 0;
+
+                fq_zech_ctx_clear(ctx2);
+            }
+
+            flint_free(h);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("p = %wd, d = %wd, c1 = %d, c2 = %d\n",
+                                             primes[i], degrees[i], c1, c2);
+            abort();
+        }
+
+        remove(filename);
+        flint_free(filename);
+        fq_zech_ctx_clear(ctx1);
+        fmpz_clear(p);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
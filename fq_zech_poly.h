@@ -28,9 +28,9 @@
 #define FQ_ZECH_POLY_DIVREM_DIVCONQUER_CUTOFF  16
 #define FQ_ZECH_COMPOSE_MOD_LENH_CUTOFF 6
 #define FQ_ZECH_COMPOSE_MOD_PREINV_LENH_CUTOFF 6
-#define FQ_ZECH_SQR_CLASSICAL_CUTOFF 100
-#define FQ_ZECH_MUL_CLASSICAL_CUTOFF 90
-#define FQ_ZECH_MULLOW_CLASSICAL_CUTOFF 90
+#define FQ_ZECH_SQR_CLASSICAL_CUTOFF(ctx) 100
+#define FQ_ZECH_MUL_CLASSICAL_CUTOFF(ctx) 90
+#define FQ_ZECH_MULLOW_CLASSICAL_CUTOFF(ctx) 90
 
 #define FQ_ZECH_POLY_HGCD_CUTOFF 35
 #define FQ_ZECH_POLY_GCD_CUTOFF 96
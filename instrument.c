@@ -0,0 +1,148 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include "flint.h"
+#include "profiler.h"
+#include "instrument.h"
+
+static const char * flint_instr_names[FLINT_INSTR_NUM] =
+{
+    "fmpz_poly_mul_tiny1",
+    "fmpz_poly_mul_tiny2",
+    "fmpz_poly_mul_classical",
+    "fmpz_poly_mul_karatsuba",
+    "fmpz_poly_mul_KS",
+    "fmpz_poly_mul_SS",
+    "fmpz_mat_mul_classical",
+    "fmpz_mat_mul_classical_inline",
+    "fmpz_mat_mul_strassen",
+    "fmpz_mat_mul_multi_mod",
+    "fmpz_mat_mul_multi_mod_primes",
+    "fmpz_mpoly_gcd_brown",
+    "fmpz_mpoly_gcd_brown_primes"
+};
+
+/* counters are per thread where thread local storage is available */
+FLINT_TLS_PREFIX flint_instr_counter_struct flint_instr_counters[FLINT_INSTR_NUM];
+
+/* the trace hook is shared by all threads */
+static flint_instr_trace_t flint_instr_trace_func = NULL;
+static void * flint_instr_trace_data = NULL;
+
+int flint_instr_enabled(void)
+{
+#if WANT_INSTRUMENT
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+const char * flint_instr_name(flint_instr_event_t ev)
+{
+    return flint_instr_names[ev];
+}
+
+void flint_instr_get(flint_instr_counter_t c, flint_instr_event_t ev)
+{
+    *c = flint_instr_counters[ev];
+}
+
+double flint_instr_get_clock(flint_instr_event_t ev)
+{
+    return flint_instr_counters[ev].cycles * FLINT_CLOCK_SCALE_FACTOR;
+}
+
+void flint_instr_reset(void)
+{
+    slong i;
+
+    for (i = 0; i < FLINT_INSTR_NUM; i++)
+    {
+        flint_instr_counters[i].count = 0;
+        flint_instr_counters[i].size1 = 0;
+        flint_instr_counters[i].size2 = 0;
+        flint_instr_counters[i].cycles = 0.0;
+    }
+}
+
+void flint_instr_set_trace(flint_instr_trace_t func, void * data)
+{
+    flint_instr_trace_func = func;
+    flint_instr_trace_data = data;
+}
+
+void flint_instr_fprint(FILE * file)
+{
+    slong i;
+    flint_instr_counter_struct * c;
+
+    fprintf(file, "%-30s %10s %12s %12s %14s %14s\n", "event", "count",
+        "size1", "size2", "time(us)", "cycles/call");
+
+    for (i = 0; i < FLINT_INSTR_NUM; i++)
+    {
+        c = flint_instr_counters + i;
+
+        if (c->count == 0)
+            continue;
+
+        /* flint_fprintf does not support field widths for words */
+        fprintf(file, "%-30s " WORD_WIDTH_FMT "u %12.1f %12.1f %14.3f %14.0f\n",
+            flint_instr_names[i], 10, c->count,
+            (double) c->size1 / c->count, (double) c->size2 / c->count,
+            c->cycles * FLINT_CLOCK_SCALE_FACTOR, c->cycles / c->count);
+    }
+}
+
+void flint_instr_print(void)
+{
+    flint_instr_fprint(stdout);
+}
+
+double _flint_instr_begin(flint_instr_event_t ev, slong size1, slong size2)
+{
+    flint_instr_trace_t func = flint_instr_trace_func;
+
+    if (func != NULL)
+        func(ev, 0, size1, size2, 0.0, flint_instr_trace_data);
+
+    return get_cycle_counter();
+}
+
+void _flint_instr_end(flint_instr_event_t ev,
+                                         slong size1, slong size2, double start)
+{
+    flint_instr_trace_t func;
+    double cycles = get_cycle_counter() - start;
+    flint_instr_counter_struct * c = flint_instr_counters + ev;
+
+    c->count++;
+    c->size1 += size1;
+    c->size2 += size2;
+    c->cycles += cycles;
+
+    func = flint_instr_trace_func;
+
+    if (func != NULL)
+        func(ev, 1, size1, size2, cycles, flint_instr_trace_data);
+}
+
+void _flint_instr_count(flint_instr_event_t ev, slong n,
+                                                    slong size1, slong size2)
+{
+    flint_instr_counter_struct * c = flint_instr_counters + ev;
+
+    c->count += n;
+    c->size1 += size1;
+    c->size2 += size2;
+}
@@ -0,0 +1,131 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef FLINT_INSTRUMENT_H
+#define FLINT_INSTRUMENT_H
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdio.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+   Dispatch points which are instrumented when FLINT is configured with
+   --enable-instrument. Each algorithm chosen by a top level function has
+   its own event. The _PRIMES events count the primes used by the
+   multimodular algorithms, adding the number of bits of each prime to
+   size1 and nothing to size2.
+*/
+typedef enum
+{
+    FLINT_INSTR_FMPZ_POLY_MUL_TINY1 = 0,
+    FLINT_INSTR_FMPZ_POLY_MUL_TINY2,
+    FLINT_INSTR_FMPZ_POLY_MUL_CLASSICAL,
+    FLINT_INSTR_FMPZ_POLY_MUL_KARATSUBA,
+    FLINT_INSTR_FMPZ_POLY_MUL_KS,
+    FLINT_INSTR_FMPZ_POLY_MUL_SS,
+    FLINT_INSTR_FMPZ_MAT_MUL_CLASSICAL,
+    FLINT_INSTR_FMPZ_MAT_MUL_CLASSICAL_INLINE,
+    FLINT_INSTR_FMPZ_MAT_MUL_STRASSEN,
+    FLINT_INSTR_FMPZ_MAT_MUL_MULTI_MOD,
+    FLINT_INSTR_FMPZ_MAT_MUL_MULTI_MOD_PRIMES,
+    FLINT_INSTR_FMPZ_MPOLY_GCD_BROWN,
+    FLINT_INSTR_FMPZ_MPOLY_GCD_BROWN_PRIMES,
+    FLINT_INSTR_NUM
+} flint_instr_event_t;
+
+typedef struct
+{
+    ulong count;    /* number of calls */
+    ulong size1;    /* sums of the operand sizes over all calls */
+    ulong size2;
+    double cycles;  /* total cycles spent in the calls */
+} flint_instr_counter_struct;
+
+typedef flint_instr_counter_struct flint_instr_counter_t[1];
+
+/*
+   A trace hook is called with end = 0 before and end = 1 after each
+   instrumented call, with the number of cycles taken in the latter case.
+*/
+typedef void (*flint_instr_trace_t)(flint_instr_event_t ev, int end,
+                           slong size1, slong size2, double cycles, void * data);
+
+FLINT_DLL int flint_instr_enabled(void);
+
+FLINT_DLL const char * flint_instr_name(flint_instr_event_t ev);
+
+FLINT_DLL void flint_instr_get(flint_instr_counter_t c,
+                                                      flint_instr_event_t ev);
+
+FLINT_DLL double flint_instr_get_clock(flint_instr_event_t ev);
+
+FLINT_DLL void flint_instr_reset(void);
+
+FLINT_DLL void flint_instr_set_trace(flint_instr_trace_t func, void * data);
+
+FLINT_DLL void flint_instr_fprint(FILE * file);
+
+FLINT_DLL void flint_instr_print(void);
+
+FLINT_DLL double _flint_instr_begin(flint_instr_event_t ev,
+                                                    slong size1, slong size2);
+
+FLINT_DLL void _flint_instr_end(flint_instr_event_t ev,
+                                    slong size1, slong size2, double start);
+
+FLINT_DLL void _flint_instr_count(flint_instr_event_t ev, slong n,
+                                                    slong size1, slong size2);
+
+/*
+   FLINT_INSTR(ev, size1, size2, call) executes the given call, recording
+   it against the event ev. FLINT_INSTR_COUNT(ev, n, size1, size2) counts
+   n occurrences of ev without timing them, adding size1 and size2 to the
+   sums of sizes. When instrumentation is disabled FLINT_INSTR reduces to
+   the bare call and FLINT_INSTR_COUNT to nothing.
+*/
+#if WANT_INSTRUMENT
+
+#define FLINT_INSTR(ev, size1, size2, call)                      \
+    do {                                                         \
+        double __instr_start = _flint_instr_begin(ev, size1, size2); \
+        call;                                                    \
+        _flint_instr_end(ev, size1, size2, __instr_start);       \
+    } while (0)
+
+#define FLINT_INSTR_COUNT(ev, n, size1, size2) \
+    _flint_instr_count(ev, n, size1, size2)
+
+#else
+
+#define FLINT_INSTR(ev, size1, size2, call) \
+    do {                                    \
+        call;                               \
+    } while (0)
+
+#define FLINT_INSTR_COUNT(ev, n, size1, size2) \
+    do { } while (0)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
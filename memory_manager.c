@@ -159,6 +159,32 @@ void flint_free(void * ptr)
    (*__flint_free_func)(ptr);
 }
 
+/*
+   The block is over-allocated with the current allocation function and
+   the pointer it returned is stored in the word preceding the aligned
+   address, so that custom memory functions are respected.
+*/
+void * flint_aligned_alloc(size_t alignment, size_t size)
+{
+   void * ptr;
+   size_t addr;
+
+   ptr = flint_malloc(size + alignment + sizeof(void *));
+
+   addr = (size_t) ptr + sizeof(void *);
+   addr = (addr + alignment - 1) & ~(alignment - 1);
+
+   ((void **) addr)[-1] = ptr;
+
+   return (void *) addr;
+}
+
+void flint_aligned_free(void * ptr)
+{
+   if (ptr != NULL)
+      flint_free(((void **) ptr)[-1]);
+}
+
 
 FLINT_TLS_PREFIX size_t flint_num_cleanup_functions = 0;
 
@@ -36,6 +36,7 @@
  extern "C" {
 #endif
 
+/* the entries block is aligned to NMOD_MAT_ALIGN bytes */
 typedef struct
 {
     mp_limb_t * entries;
@@ -84,6 +85,9 @@ void _nmod_mat_set_mod(nmod_mat_t mat, mp_limb_t n)
 }
 
 /* Memory management */
+
+#define NMOD_MAT_ALIGN 64
+
 FLINT_DLL void nmod_mat_init(nmod_mat_t mat, slong rows, slong cols, mp_limb_t n);
 FLINT_DLL void nmod_mat_init_set(nmod_mat_t mat, const nmod_mat_t src);
 FLINT_DLL void nmod_mat_clear(nmod_mat_t mat);
@@ -113,6 +117,15 @@ FLINT_DLL void nmod_mat_randtriu(nmod_mat_t mat, flint_rand_t state, int unit);
 
 FLINT_DLL void nmod_mat_print_pretty(const nmod_mat_t mat);
 
+FLINT_DLL int nmod_mat_fwrite_bin(FILE * file, const nmod_mat_t mat);
+
+FLINT_DLL int nmod_mat_fread_bin(FILE * file, nmod_mat_t mat);
+
+FLINT_DLL size_t nmod_mat_bin_view_init(nmod_mat_t mat,
+                                              const void * buf, size_t size);
+
+FLINT_DLL void nmod_mat_bin_view_clear(nmod_mat_t mat);
+
 FLINT_DLL int nmod_mat_equal(const nmod_mat_t mat1, const nmod_mat_t mat2);
 
 FLINT_DLL void nmod_mat_zero(nmod_mat_t mat);
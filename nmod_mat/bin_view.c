@@ -0,0 +1,62 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "bin_io.h"
+
+size_t nmod_mat_bin_view_init(nmod_mat_t mat, const void * buf, size_t size)
+{
+    ulong dims[4];
+    slong i, len;
+    size_t h;
+    mp_srcptr e;
+
+    mat->entries = NULL;
+    mat->rows = NULL;
+    mat->r = 0;
+    mat->c = 0;
+
+    h = flint_bin_view_header(dims, buf, size, FLINT_BIN_NMOD_MAT);
+    if (h == 0 || dims[2] == 0 || dims[0] > WORD_MAX || dims[1] > WORD_MAX
+           || (dims[0] != 0 && dims[1] > WORD_MAX / dims[0]))
+        return 0;
+
+    len = dims[0] * dims[1];
+    if ((ulong) len > (size - h) / sizeof(mp_limb_t))
+        return 0;
+
+    e = (mp_srcptr) ((const char *) buf + h);
+
+    for (i = 0; i < len; i++)
+        if (e[i] >= dims[2])
+            return 0;
+
+    /* as for a window, entries is NULL and only the rows are allocated */
+    if (dims[0] != 0)
+        mat->rows = flint_malloc(dims[0] * sizeof(mp_limb_t *));
+
+    for (i = 0; i < (slong) dims[0]; i++)
+        mat->rows[i] = (mp_ptr) e + i * dims[1];
+
+    mat->r = dims[0];
+    mat->c = dims[1];
+    _nmod_mat_set_mod(mat, dims[2]);
+
+    return h + len * sizeof(mp_limb_t);
+}
+
+void nmod_mat_bin_view_clear(nmod_mat_t mat)
+{
+    flint_free(mat->rows);
+}
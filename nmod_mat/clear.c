@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2010 William Hart
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -19,8 +20,7 @@ void
 nmod_mat_clear(nmod_mat_t mat)
 {
     if (mat->entries)
-    {
-        flint_free(mat->entries);
-        flint_free(mat->rows);
-    }
+        flint_aligned_free(mat->entries);
+
+    flint_free(mat->rows);
 }
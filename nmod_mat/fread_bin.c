@@ -0,0 +1,52 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "bin_io.h"
+
+int nmod_mat_fread_bin(FILE * file, nmod_mat_t mat)
+{
+    ulong dims[4];
+    slong i, len;
+
+    if (!flint_bin_fread_header(file, FLINT_BIN_NMOD_MAT, dims)
+           || dims[2] == 0 || dims[0] > WORD_MAX || dims[1] > WORD_MAX
+           || (dims[0] != 0 && dims[1] > WORD_MAX / dims[0]))
+        return 0;
+
+    nmod_mat_clear(mat);
+    nmod_mat_init(mat, dims[0], dims[1], dims[2]);
+
+    len = dims[0] * dims[1];
+
+    if (len == 0)
+        return 1;
+
+    if (!flint_bin_fread_words(mat->entries, len, file))
+    {
+        flint_mpn_zero(mat->entries, len);
+        return 0;
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        if (mat->entries[i] >= mat->mod.n)
+        {
+            flint_mpn_zero(mat->entries, len);
+            return 0;
+        }
+    }
+
+    return 1;
+}
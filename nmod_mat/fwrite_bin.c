@@ -0,0 +1,45 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "bin_io.h"
+
+int nmod_mat_fwrite_bin(FILE * file, const nmod_mat_t mat)
+{
+    ulong dims[4] = {0, 0, 0, 0};
+    slong i, r = mat->r, c = mat->c;
+
+    dims[0] = r;
+    dims[1] = c;
+    dims[2] = mat->mod.n;
+
+    if (!flint_bin_fwrite_header(file, FLINT_BIN_NMOD_MAT, dims))
+        return 0;
+
+    if (r == 0 || c == 0)
+        return 1;
+
+    for (i = 1; i < r; i++)
+        if (mat->rows[i] != mat->rows[0] + i * c)
+            break;
+
+    if (i == r)
+        return flint_bin_fwrite_words(file, mat->rows[0], r * c);
+
+    for (i = 0; i < r; i++)
+        if (!flint_bin_fwrite_words(file, mat->rows[i], c))
+            return 0;
+
+    return 1;
+}
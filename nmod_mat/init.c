@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2010 William Hart
     Copyright (C) 2010,2011 Fredrik Johansson
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -19,18 +20,31 @@
 void
 nmod_mat_init(nmod_mat_t mat, slong rows, slong cols, mp_limb_t n)
 {
+    slong i;
+
+    if (rows != 0)
+        mat->rows = (mp_limb_t **) flint_malloc(rows * sizeof(mp_limb_t *));
+    else
+        mat->rows = NULL;
+
     if (rows != 0 && cols != 0)
     {
-        slong i;
-        mat->entries = (mp_limb_t *) flint_calloc(rows * cols, sizeof(mp_limb_t));
-        mat->rows = (mp_limb_t **) flint_malloc(rows * sizeof(mp_limb_t *));
+        mat->entries = (mp_limb_t *) flint_aligned_alloc(NMOD_MAT_ALIGN,
+                                                 rows * cols * sizeof(mp_limb_t));
+        flint_mpn_zero(mat->entries, rows * cols);
 
         for (i = 0; i < rows; i++)
             mat->rows[i] = mat->entries + i * cols;
     }
     else
+    {
+        /* rows without columns still have (empty) row pointers */
         mat->entries = NULL;
 
+        for (i = 0; i < rows; i++)
+            mat->rows[i] = NULL;
+    }
+
     mat->r = rows;
     mat->c = cols;
 
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2010 William Hart
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -20,12 +21,17 @@ nmod_mat_init_set(nmod_mat_t mat, const nmod_mat_t src)
 {
     slong rows = src->r;
     slong cols = src->c;
+    slong i;
+
+    if (rows != 0)
+        mat->rows = flint_malloc(rows * sizeof(mp_limb_t *));
+    else
+        mat->rows = NULL;
 
     if ((rows) && (cols))
     {
-        slong i;
-        mat->entries = flint_malloc(rows * cols * sizeof(mp_limb_t));
-        mat->rows = flint_malloc(rows * sizeof(mp_limb_t *));
+        mat->entries = flint_aligned_alloc(NMOD_MAT_ALIGN,
+                                           rows * cols * sizeof(mp_limb_t));
 
         for (i = 0; i < rows; i++)
         {
@@ -34,8 +40,13 @@ nmod_mat_init_set(nmod_mat_t mat, const nmod_mat_t src)
         }
     }
     else
+    {
         mat->entries = NULL;
 
+        for (i = 0; i < rows; i++)
+            mat->rows[i] = NULL;
+    }
+
     mat->r = rows;
     mat->c = cols;
 
@@ -50,19 +50,23 @@ _nmod_mat_addmul_transpose(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
 {
     mp_ptr tmp;
     mp_limb_t c;
-    slong i, j;
+    slong i, j, stride;
+
+    /* rows of the transpose start at aligned addresses */
+    stride = NMOD_MAT_ALIGN / sizeof(mp_limb_t);
+    stride = ((k + stride - 1) / stride) * stride;
 
-    tmp = flint_malloc(sizeof(mp_limb_t) * k * n);
+    tmp = flint_aligned_alloc(NMOD_MAT_ALIGN, sizeof(mp_limb_t) * stride * n);
 
     for (i = 0; i < k; i++)
         for (j = 0; j < n; j++)
-            tmp[j*k + i] = B[i][j];
+            tmp[j*stride + i] = B[i][j];
 
     for (i = 0; i < m; i++)
     {
         for (j = 0; j < n; j++)
         {
-            c = _nmod_vec_dot(A[i], tmp + j*k, k, mod, nlimbs);
+            c = _nmod_vec_dot(A[i], tmp + j*stride, k, mod, nlimbs);
 
             if (op == 1)
                 c = nmod_add(C[i][j], c, mod);
@@ -73,7 +77,7 @@ _nmod_mat_addmul_transpose(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
         }
     }
 
-    flint_free(tmp);
+    flint_aligned_free(tmp);
 }
 
 /* requires nlimbs = 1 */
@@ -82,7 +86,7 @@ _nmod_mat_addmul_packed(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
     const mp_ptr * B, slong M, slong N, slong K, int op, nmod_t mod, int nlimbs)
 {
     slong i, j, k;
-    slong Kpack;
+    slong Kpack, stride;
     int pack, pack_bits;
     mp_limb_t c, d, mask;
     mp_ptr tmp;
@@ -99,7 +103,11 @@ _nmod_mat_addmul_packed(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
     else
         mask = (UWORD(1) << pack_bits) - 1;
 
-    tmp = _nmod_vec_init(Kpack * N);
+    /* rows of the packed transpose start at aligned addresses */
+    stride = NMOD_MAT_ALIGN / sizeof(mp_limb_t);
+    stride = ((N + stride - 1) / stride) * stride;
+
+    tmp = flint_aligned_alloc(NMOD_MAT_ALIGN, sizeof(mp_limb_t) * Kpack * stride);
 
     /* pack and transpose B */
     for (i = 0; i < Kpack; i++)
@@ -111,7 +119,7 @@ _nmod_mat_addmul_packed(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
             for (j = 1; j < pack && i * pack + j < K; j++)
                 c |= B[k][i * pack + j] << (pack_bits * j);
 
-            tmp[i * N + k] = c;
+            tmp[i * stride + k] = c;
         }
     }
 
@@ -121,7 +129,7 @@ _nmod_mat_addmul_packed(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
         for (j = 0; j < Kpack; j++)
         {
             Aptr = A[i];
-            Tptr = tmp + j * N;
+            Tptr = tmp + j * stride;
 
             c = 0;
 
@@ -153,7 +161,7 @@ _nmod_mat_addmul_packed(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
         }
     }
 
-    _nmod_vec_clear(tmp);
+    flint_aligned_free(tmp);
 }
 
 
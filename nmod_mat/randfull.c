@@ -17,10 +17,11 @@
 void
 nmod_mat_randfull(nmod_mat_t mat, flint_rand_t state)
 {
-    slong i;
+    slong i, j;
 
-    for (i = 0; i < mat->r * mat->c; i++)
+    for (i = 0; i < mat->r; i++)
     {
-        mat->entries[i] = FLINT_MAX(1, n_randint(state, mat->mod.n));
+        for (j = 0; j < mat->c; j++)
+            mat->rows[i][j] = FLINT_MAX(1, n_randint(state, mat->mod.n));
     }
 }
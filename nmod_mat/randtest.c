@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -17,5 +18,16 @@
 void
 nmod_mat_randtest(nmod_mat_t mat, flint_rand_t state)
 {
-    _nmod_vec_randtest(mat->entries, state, mat->r * mat->c, mat->mod);
+    slong i;
+
+    /* windows have no entries of their own, even if they span every column */
+    if (mat->entries != NULL)
+    {
+        _nmod_vec_randtest(mat->entries, state, mat->r * mat->c, mat->mod);
+    }
+    else
+    {
+        for (i = 0; i < mat->r; i++)
+            _nmod_vec_randtest(mat->rows[i], state, mat->c, mat->mod);
+    }
 }
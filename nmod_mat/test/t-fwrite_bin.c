@@ -0,0 +1,104 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "bin_io.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("fwrite_bin....");
+#if !defined( _MSC_VER )
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, W, B, C;
+        slong r, c, r1, c1, r2, c2;
+        flint_bin_map_t map;
+        size_t s = 0;
+        FILE * f = fopen("nmod_mat_bin_test", "wb");
+
+        if (!f)
+        {
+            flint_printf("Error: unable to open file for writing.\n");
+            abort();
+        }
+
+        r = n_randint(state, 20);
+        c = n_randint(state, 20);
+        nmod_mat_init(A, r, c, n_randtest_not_zero(state));
+        nmod_mat_randtest(A, state);
+
+        /* write a window, whose rows are not contiguous */
+        r1 = n_randint(state, r + 1);
+        r2 = r1 + n_randint(state, r - r1 + 1);
+        c1 = n_randint(state, c + 1);
+        c2 = c1 + n_randint(state, c - c1 + 1);
+        nmod_mat_window_init(W, A, r1, c1, r2, c2);
+
+        result = nmod_mat_fwrite_bin(f, W);
+        fclose(f);
+
+        nmod_mat_init(B, 0, 0, 1);
+        f = fopen("nmod_mat_bin_test", "rb");
+        result = result && nmod_mat_fread_bin(f, B) && nmod_mat_equal(W, B)
+                        && B->mod.n == A->mod.n;
+        fclose(f);
+
+        if (result && flint_bin_map(map, "nmod_mat_bin_test"))
+        {
+            s = nmod_mat_bin_view_init(C, map->data, map->size);
+            result = (s == map->size && nmod_mat_equal(W, C)
+                                 && C->mod.n == A->mod.n);
+            nmod_mat_bin_view_clear(C);
+
+            flint_bin_unmap(map);
+        } else
+            result = 0;
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("s = %wu\n", (ulong) s);
+            nmod_mat_print_pretty(W), flint_printf("\n");
+            nmod_mat_print_pretty(B), flint_printf("\n");
+            remove("nmod_mat_bin_test");
+            abort();
+        }
+
+        if (remove("nmod_mat_bin_test"))
+        {
+            flint_printf("Error, unable to delete file nmod_mat_bin_test\n");
+            abort();
+        }
+
+        nmod_mat_window_clear(W);
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+#else
+    flint_printf("SKIPPED\n");
+#endif
+    return 0;
+}
@@ -2,6 +2,7 @@
     Copyright (C) 2010 William Hart
     Copyright (C) 2014 Abhinav Baid
     Copyright (C) 2015 Sergeicheva Elena
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -58,6 +59,52 @@ main(void)
         nmod_mat_clear(a);
     }
 
+    /* windows spanning all columns of their parent */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t a, b, w;
+        slong r1, r2, j, k;
+        slong rows = n_randint(state, 100) + 1;
+        slong cols = n_randint(state, 100) + 1;
+        mp_limb_t n = n_randtest_not_zero(state);
+
+        nmod_mat_init(a, rows, cols, n);
+        nmod_mat_randtest(a, state);
+        nmod_mat_init_set(b, a);
+
+        r2 = n_randint(state, rows + 1);
+        r1 = n_randint(state, r2 + 1);
+
+        nmod_mat_window_init(w, a, r1, 0, r2, cols);
+        nmod_mat_randtest(w, state);
+
+        for (j = 0; j < rows; j++)
+        {
+            for (k = 0; k < cols; k++)
+            {
+                if ((j < r1 || j >= r2) && nmod_mat_entry(a, j, k)
+                                        != nmod_mat_entry(b, j, k))
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("entry (%wd, %wd) outside the window "
+                                 "changed\n", j, k);
+                    abort();
+                }
+
+                if (nmod_mat_entry(a, j, k) >= n)
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("entry (%wd, %wd) not reduced\n", j, k);
+                    abort();
+                }
+            }
+        }
+
+        nmod_mat_window_clear(w);
+        nmod_mat_clear(a);
+        nmod_mat_clear(b);
+    }
+
 
     FLINT_TEST_CLEANUP(state);
     flint_printf("PASS\n");
@@ -361,6 +361,15 @@ FLINT_DLL int nmod_poly_set_str(nmod_poly_t poly, const char * s);
 
 FLINT_DLL int nmod_poly_fread(FILE * f, nmod_poly_t poly);
 
+FLINT_DLL int nmod_poly_fwrite_bin(FILE * file, const nmod_poly_t poly);
+
+FLINT_DLL int nmod_poly_fread_bin(FILE * file, nmod_poly_t poly);
+
+FLINT_DLL size_t nmod_poly_bin_view_init(nmod_poly_t poly,
+                                              const void * buf, size_t size);
+
+FLINT_DLL void nmod_poly_bin_view_clear(nmod_poly_t poly);
+
 NMOD_POLY_INLINE
 int nmod_poly_fprint(FILE * f, const nmod_poly_t poly)
 {
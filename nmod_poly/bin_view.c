@@ -0,0 +1,56 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "bin_io.h"
+
+size_t nmod_poly_bin_view_init(nmod_poly_t poly,
+                                                const void * buf, size_t size)
+{
+    ulong dims[4];
+    slong i, len;
+    size_t h;
+    mp_srcptr c;
+
+    poly->coeffs = NULL;
+    poly->alloc = 0;
+    poly->length = 0;
+
+    h = flint_bin_view_header(dims, buf, size, FLINT_BIN_NMOD_POLY);
+    if (h == 0 || dims[1] == 0 || dims[0] > (size - h) / sizeof(mp_limb_t))
+        return 0;
+
+    len = dims[0];
+    c = (mp_srcptr) ((const char *) buf + h);
+
+    for (i = 0; i < len; i++)
+        if (c[i] >= dims[1])
+            return 0;
+
+    if (len != 0 && c[len - 1] == 0)
+        return 0;
+
+    /* alloc stays zero, the coefficients are used in place */
+    nmod_init(&poly->mod, dims[1]);
+    poly->coeffs = (mp_ptr) c;
+    poly->length = len;
+
+    return h + len * sizeof(mp_limb_t);
+}
+
+void nmod_poly_bin_view_clear(nmod_poly_t poly)
+{
+    poly->coeffs = NULL;
+    poly->length = 0;
+}
@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "bin_io.h"
+
+int nmod_poly_fread_bin(FILE * file, nmod_poly_t poly)
+{
+    ulong dims[4];
+    slong i, len;
+
+    if (!flint_bin_fread_header(file, FLINT_BIN_NMOD_POLY, dims)
+           || dims[0] > WORD_MAX || dims[1] == 0)
+        return 0;
+
+    len = dims[0];
+
+    nmod_poly_clear(poly);
+    nmod_poly_init(poly, dims[1]);
+    nmod_poly_fit_length(poly, len);
+
+    if (!flint_bin_fread_words(poly->coeffs, len, file))
+        return 0;
+
+    for (i = 0; i < len; i++)
+        if (poly->coeffs[i] >= poly->mod.n)
+            return 0;
+
+    poly->length = len;
+    _nmod_poly_normalise(poly);
+
+    return 1;
+}
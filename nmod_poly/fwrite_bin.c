@@ -0,0 +1,27 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "bin_io.h"
+
+int nmod_poly_fwrite_bin(FILE * file, const nmod_poly_t poly)
+{
+    ulong dims[4] = {0, 0, 0, 0};
+
+    dims[0] = poly->length;
+    dims[1] = poly->mod.n;
+
+    return flint_bin_fwrite_header(file, FLINT_BIN_NMOD_POLY, dims)
+        && flint_bin_fwrite_words(file, poly->coeffs, poly->length);
+}
@@ -80,6 +80,8 @@ FLINT_DLL void nmod_poly_factor_print(const nmod_poly_factor_t fac);
 FLINT_DLL void nmod_poly_factor_concat(nmod_poly_factor_t res,
                         const nmod_poly_factor_t fac);
 
+FLINT_DLL void _nmod_poly_factor_sort(nmod_poly_factor_t fac, slong start);
+
 FLINT_DLL void nmod_poly_factor_pow(nmod_poly_factor_t fac, slong exp);
 
 FLINT_DLL void nmod_poly_factor_equal_deg(nmod_poly_factor_t factors,
@@ -88,6 +90,12 @@ FLINT_DLL void nmod_poly_factor_equal_deg(nmod_poly_factor_t factors,
 FLINT_DLL int nmod_poly_factor_equal_deg_prob(nmod_poly_t factor,
     flint_rand_t state, const nmod_poly_t pol, slong d);
 
+/* length below which equal degree splitting is not threaded */
+#define NMOD_POLY_FACTOR_EQUAL_DEG_THREADED_CUTOFF 64
+
+FLINT_DLL void nmod_poly_factor_equal_deg_threaded(nmod_poly_factor_t factors,
+                                const nmod_poly_t pol, slong d);
+
 FLINT_DLL void nmod_poly_factor_distinct_deg(nmod_poly_factor_t res,
                                    const nmod_poly_t poly, slong * const *degs);
 
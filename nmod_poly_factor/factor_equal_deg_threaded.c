@@ -0,0 +1,267 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#undef ulong
+#define ulong ulongxx/* interferes with system includes */
+
+#include <pthread.h>
+
+#undef ulong
+
+#include <gmp.h>
+
+#define ulong mp_limb_t
+
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    nmod_poly_struct * f;
+    flint_rand_s * state;
+    const nmod_poly_struct * pol;
+    slong d;
+    int found;
+}
+_split_arg_t;
+
+typedef struct
+{
+    nmod_poly_factor_struct * factors;
+    const nmod_poly_struct * pieces;
+    slong num;
+    slong start;
+    slong step;
+    slong d;
+    flint_rand_s * state;
+    slong num_threads;
+}
+_pieces_arg_t;
+
+static void
+_equal_deg_recursive(nmod_poly_factor_t factors, const nmod_poly_t pol,
+                     slong d, flint_rand_t state, slong num_threads);
+
+static void *
+_split_worker(void * arg_ptr)
+{
+    _split_arg_t * arg = (_split_arg_t *) arg_ptr;
+
+    arg->found = nmod_poly_factor_equal_deg_prob(arg->f, arg->state,
+                                                 arg->pol, arg->d);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+_factor_pieces(_pieces_arg_t * arg)
+{
+    slong i;
+
+    for (i = arg->start; i < arg->num; i += arg->step)
+        _equal_deg_recursive(arg->factors + i, arg->pieces + i, arg->d,
+                             arg->state, arg->num_threads);
+}
+
+static void *
+_pieces_worker(void * arg_ptr)
+{
+    _factor_pieces((_pieces_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+_randinit_from(flint_rand_t res, flint_rand_t state)
+{
+    flint_randinit(res);
+    res->__randval = n_randlimb(state);
+    res->__randval2 = n_randlimb(state);
+}
+
+static void
+_equal_deg_recursive(nmod_poly_factor_t factors, const nmod_poly_t pol,
+                     slong d, flint_rand_t state, slong num_threads)
+{
+    nmod_poly_struct * split, * pieces;
+    nmod_poly_factor_struct * piece_factors;
+    flint_rand_s * states;
+    _split_arg_t * args1;
+    _pieces_arg_t * args2;
+    pthread_t * threads;
+    nmod_poly_t g;
+    slong i, j, num, max, workers;
+    int found;
+
+    if (pol->length == d + 1)
+    {
+        nmod_poly_factor_insert(factors, pol, 1);
+        return;
+    }
+
+    if (num_threads <= 1 ||
+        pol->length < NMOD_POLY_FACTOR_EQUAL_DEG_THREADED_CUTOFF)
+    {
+        nmod_poly_t f;
+
+        nmod_poly_init_preinv(f, pol->mod.n, pol->mod.ninv);
+        nmod_poly_init_preinv(g, pol->mod.n, pol->mod.ninv);
+
+        while (!nmod_poly_factor_equal_deg_prob(f, state, pol, d)) {};
+
+        nmod_poly_div(g, pol, f);
+
+        _equal_deg_recursive(factors, f, d, state, num_threads);
+        _equal_deg_recursive(factors, g, d, state, num_threads);
+
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+        return;
+    }
+
+    split   = flint_malloc(num_threads*sizeof(nmod_poly_struct));
+    states  = flint_malloc(num_threads*sizeof(flint_rand_s));
+    args1   = flint_malloc(num_threads*sizeof(_split_arg_t));
+    threads = flint_malloc(num_threads*sizeof(pthread_t));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        nmod_poly_init_preinv(split + i, pol->mod.n, pol->mod.ninv);
+        _randinit_from(states + i, state);
+
+        args1[i].f = split + i;
+        args1[i].state = states + i;
+        args1[i].pol = pol;
+        args1[i].d = d;
+        args1[i].found = 0;
+    }
+
+    /* make independent random splitting attempts, one per thread */
+    do
+    {
+        for (i = 1; i < num_threads; i++)
+            pthread_create(&threads[i], NULL, _split_worker, &args1[i]);
+
+        args1[0].found = nmod_poly_factor_equal_deg_prob(split + 0,
+                                                    states + 0, pol, d);
+
+        for (i = 1; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        for (i = 0, found = 0; i < num_threads; i++)
+            found |= args1[i].found;
+    } while (!found);
+
+    /* refine pol into coprime pieces using every factor found */
+    max = (pol->length - 1)/d;
+    pieces = flint_malloc(max*sizeof(nmod_poly_struct));
+
+    nmod_poly_init_preinv(g, pol->mod.n, pol->mod.ninv);
+    nmod_poly_init_preinv(pieces + 0, pol->mod.n, pol->mod.ninv);
+    nmod_poly_set(pieces + 0, pol);
+    num = 1;
+
+    for (i = 0; i < num_threads; i++)
+    {
+        slong n = num;
+
+        if (!args1[i].found)
+            continue;
+
+        for (j = 0; j < n; j++)
+        {
+            if (pieces[j].length == d + 1)
+                continue;
+
+            nmod_poly_gcd(g, pieces + j, split + i);
+
+            if (g->length > 1 && g->length < pieces[j].length)
+            {
+                nmod_poly_init_preinv(pieces + num, pol->mod.n, pol->mod.ninv);
+                nmod_poly_div(pieces + num, pieces + j, g);
+                nmod_poly_swap(pieces + j, g);
+                num++;
+            }
+        }
+    }
+
+    /* factor the pieces concurrently, then merge them in order */
+    workers = FLINT_MIN(num, num_threads);
+
+    piece_factors = flint_malloc(num*sizeof(nmod_poly_factor_struct));
+    args2 = flint_malloc(workers*sizeof(_pieces_arg_t));
+
+    for (i = 0; i < num; i++)
+        nmod_poly_factor_init(piece_factors + i);
+
+    for (i = 0; i < workers; i++)
+    {
+        args2[i].factors = piece_factors;
+        args2[i].pieces = pieces;
+        args2[i].num = num;
+        args2[i].start = i;
+        args2[i].step = workers;
+        args2[i].d = d;
+        args2[i].state = states + i;
+        args2[i].num_threads = num_threads/workers
+                             + (i < num_threads % workers);
+    }
+
+    for (i = 1; i < workers; i++)
+        pthread_create(&threads[i], NULL, _pieces_worker, &args2[i]);
+
+    _factor_pieces(&args2[0]);
+
+    for (i = 1; i < workers; i++)
+        pthread_join(threads[i], NULL);
+
+    for (i = 0; i < num; i++)
+    {
+        nmod_poly_factor_concat(factors, piece_factors + i);
+        nmod_poly_factor_clear(piece_factors + i);
+        nmod_poly_clear(pieces + i);
+    }
+
+    for (i = 0; i < num_threads; i++)
+    {
+        nmod_poly_clear(split + i);
+        flint_randclear(states + i);
+    }
+
+    nmod_poly_clear(g);
+
+    flint_free(piece_factors);
+    flint_free(pieces);
+    flint_free(args2);
+    flint_free(args1);
+    flint_free(states);
+    flint_free(split);
+    flint_free(threads);
+}
+
+void
+nmod_poly_factor_equal_deg_threaded(nmod_poly_factor_t factors,
+                                    const nmod_poly_t pol, slong d)
+{
+    flint_rand_t state;
+    slong num = factors->num;
+
+    flint_randinit(state);
+
+    _equal_deg_recursive(factors, pol, d, state, flint_get_num_threads());
+
+    /* the order in which factors are found depends on the threads */
+    _nmod_poly_factor_sort(factors, num);
+
+    flint_randclear(state);
+}
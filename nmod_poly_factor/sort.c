@@ -0,0 +1,72 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+
+typedef struct
+{
+    nmod_poly_struct poly;
+    slong exp;
+} _nmod_poly_factor_entry;
+
+static int
+_nmod_poly_factor_entry_cmp(const void * x, const void * y)
+{
+    const nmod_poly_struct * a, * b;
+    slong i;
+
+    a = &((const _nmod_poly_factor_entry *) x)->poly;
+    b = &((const _nmod_poly_factor_entry *) y)->poly;
+
+    if (a->length != b->length)
+        return a->length < b->length ? -1 : 1;
+
+    for (i = a->length - 1; i >= 0; i--)
+    {
+        if (a->coeffs[i] != b->coeffs[i])
+            return a->coeffs[i] < b->coeffs[i] ? -1 : 1;
+    }
+
+    return 0;
+}
+
+void
+_nmod_poly_factor_sort(nmod_poly_factor_t fac, slong start)
+{
+    slong i, n = fac->num - start;
+    _nmod_poly_factor_entry * t;
+
+    if (n < 2)
+        return;
+
+    /* the polynomial structs are moved, not copied */
+    t = flint_malloc(n*sizeof(_nmod_poly_factor_entry));
+
+    for (i = 0; i < n; i++)
+    {
+        t[i].poly = fac->p[start + i];
+        t[i].exp = fac->exp[start + i];
+    }
+
+    qsort(t, n, sizeof(_nmod_poly_factor_entry),
+                                          _nmod_poly_factor_entry_cmp);
+
+    for (i = 0; i < n; i++)
+    {
+        fac->p[start + i] = t[i].poly;
+        fac->exp[start + i] = t[i].exp;
+    }
+
+    flint_free(t);
+}
@@ -0,0 +1,116 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+#include "flint.h"
+
+int
+main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("factor_equal_deg_threaded....");
+    fflush(stdout);
+
+#if HAVE_PTHREAD && (HAVE_TLS || FLINT_REENTRANT)
+
+    for (iter = 0; iter < 10 * flint_test_multiplier(); iter++)
+    {
+        nmod_poly_t poly1, poly, q, r, product;
+        nmod_poly_factor_t res;
+        mp_limb_t modulus;
+        slong i, d, num;
+
+        modulus = n_randprime(state, 10 + n_randint(state, 40), 1);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        nmod_poly_init(poly1, modulus);
+        nmod_poly_init(poly, modulus);
+        nmod_poly_init(q, modulus);
+        nmod_poly_init(r, modulus);
+        nmod_poly_init(product, modulus);
+
+        d = n_randint(state, 4) + 1;
+        num = n_randint(state, 20)
+            + NMOD_POLY_FACTOR_EQUAL_DEG_THREADED_CUTOFF/d;
+
+        nmod_poly_set_coeff_ui(poly1, 0, 1);
+
+        for (i = 0; i < num; i++)
+        {
+            do
+            {
+                nmod_poly_randtest_monic_irreducible(poly, state, d + 1);
+                nmod_poly_divrem(q, r, poly1, poly);
+            }
+            while (r->length == 0);
+
+            nmod_poly_mul(poly1, poly1, poly);
+        }
+
+        nmod_poly_factor_init(res);
+        nmod_poly_factor_equal_deg_threaded(res, poly1, d);
+
+        if (res->num != num)
+        {
+            flint_printf("Error: number of factors incorrect\n");
+            flint_printf("%wd != %wd\n", res->num, num);
+            abort();
+        }
+
+        nmod_poly_set_coeff_ui(product, 0, 1);
+        for (i = 0; i < res->num; i++)
+        {
+            if (nmod_poly_degree(res->p + i) != d || res->exp[i] != 1)
+            {
+                flint_printf("Error: factor of incorrect degree\n");
+                flint_printf("factor:\n"); nmod_poly_print(res->p + i); flint_printf("\n");
+                abort();
+            }
+
+            nmod_poly_mul(product, product, res->p + i);
+        }
+
+        if (!nmod_poly_equal(poly1, product))
+        {
+            flint_printf("Error: product of factors does not equal to the original polynomial\n");
+            flint_printf("poly:\n"); nmod_poly_print(poly1); flint_printf("\n");
+            flint_printf("product:\n"); nmod_poly_print(product); flint_printf("\n");
+            abort();
+        }
+
+        nmod_poly_clear(product);
+        nmod_poly_clear(q);
+        nmod_poly_clear(r);
+        nmod_poly_clear(poly1);
+        nmod_poly_clear(poly);
+        nmod_poly_factor_clear(res);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+
+#else
+
+   FLINT_TEST_CLEANUP(state);
+
+   flint_printf("SKIPPED\n");
+   return 0;
+
+#endif
+
+}
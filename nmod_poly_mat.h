@@ -166,6 +166,9 @@ FLINT_DLL void nmod_poly_mat_mul_classical(nmod_poly_mat_t C, const nmod_poly_ma
 FLINT_DLL void nmod_poly_mat_mul_KS(nmod_poly_mat_t C, const nmod_poly_mat_t A,
     const nmod_poly_mat_t B);
 
+FLINT_DLL void _nmod_poly_mat_mul_pointwise(nmod_mat_struct * C,
+       const nmod_mat_struct * A, const nmod_mat_struct * B, slong len);
+
 FLINT_DLL void nmod_poly_mat_sqr(nmod_poly_mat_t B, const nmod_poly_mat_t A);
 
 FLINT_DLL void nmod_poly_mat_sqr_classical(nmod_poly_mat_t B, const nmod_poly_mat_t A);
@@ -180,6 +183,49 @@ FLINT_DLL void nmod_poly_mat_pow(nmod_poly_mat_t B, const nmod_poly_mat_t A, ulo
 
 FLINT_DLL void nmod_poly_mat_evaluate_nmod(nmod_mat_t B, const nmod_poly_mat_t A, mp_limb_t x);
 
+/* Evaluation at geometric progressions *************************************/
+
+/*
+   Precomputed data for evaluating polynomials at the points
+   q^0, q^1, ..., q^(len - 1) and interpolating from values at those points.
+   Each evaluation and interpolation costs one or two polynomial
+   multiplications.
+*/
+typedef struct
+{
+    mp_limb_t q;
+    mp_limb_t qinv;
+    mp_ptr chirp;       /* q^(k(k-1)/2) for 0 <= k < chirp_len */
+    mp_ptr chirp_inv;   /* q^(-k(k-1)/2) for 0 <= k < chirp_len */
+    mp_ptr prod;        /* (x - q^0)...(x - q^(len - 1)) */
+    mp_ptr weights;     /* 1 / prod'(q^i) for 0 <= i < len */
+    slong len;
+    slong chirp_len;
+    nmod_t mod;
+}
+_nmod_poly_mat_geometric_struct;
+
+typedef _nmod_poly_mat_geometric_struct _nmod_poly_mat_geometric_t[1];
+
+FLINT_DLL int _nmod_poly_mat_geometric_init(_nmod_poly_mat_geometric_t G,
+                                        slong len, slong plen, nmod_t mod);
+
+FLINT_DLL void _nmod_poly_mat_geometric_clear(_nmod_poly_mat_geometric_t G);
+
+FLINT_DLL void _nmod_poly_mat_geometric_evaluate_poly(mp_ptr vs,
+                 mp_srcptr poly, slong plen, slong start, slong n,
+                 const _nmod_poly_mat_geometric_t G);
+
+FLINT_DLL void _nmod_poly_mat_geometric_interpolate_poly(mp_ptr poly,
+                 mp_srcptr vs, const _nmod_poly_mat_geometric_t G);
+
+FLINT_DLL void _nmod_poly_mat_evaluate_geometric(nmod_mat_struct * B,
+                 const nmod_poly_mat_t A, slong start, slong n,
+                 const _nmod_poly_mat_geometric_t G);
+
+FLINT_DLL void _nmod_poly_mat_interpolate_geometric(nmod_poly_mat_t A,
+                 const nmod_mat_struct * B, const _nmod_poly_mat_geometric_t G);
+
 /* Row reduction *************************************************************/
 
 FLINT_DLL slong nmod_poly_mat_find_pivot_any(const nmod_poly_mat_t mat,
@@ -9,19 +9,83 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "nmod_vec.h"
 #include "nmod_poly.h"
 #include "nmod_poly_mat.h"
 
+/* number of limbs of point values to hold at once */
+#define DET_INTERPOLATE_MAX_LIMBS (WORD(1) << 22)
+
+typedef struct
+{
+    mp_ptr d;
+    const nmod_mat_struct * X;
+    slong k0;
+    slong k1;
+}
+det_arg_t;
+
+static void *
+_det_worker(void * arg_ptr)
+{
+    det_arg_t arg = *((det_arg_t *) arg_ptr);
+    slong k;
+
+    for (k = arg.k0; k < arg.k1; k++)
+        arg.d[k] = nmod_mat_det(arg.X + k);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+_det_pointwise(mp_ptr d, const nmod_mat_struct * X, slong len)
+{
+    slong i, num_threads;
+    pthread_t * threads;
+    det_arg_t * args;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), len);
+
+    if (num_threads <= 1)
+    {
+        for (i = 0; i < len; i++)
+            d[i] = nmod_mat_det(X + i);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(det_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].d = d;
+        args[i].X = X;
+        args[i].k0 = (len * i) / num_threads;
+        args[i].k1 = (len * (i + 1)) / num_threads;
+
+        pthread_create(&threads[i], NULL, _det_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
 void
 nmod_poly_mat_det_interpolate(nmod_poly_t det, const nmod_poly_mat_t A)
 {
-    slong i, l, n, len;
+    slong i, k, l, n, len, chunk;
 
-    nmod_mat_t X;
-    mp_ptr x, d;
+    nmod_mat_struct * X;
+    mp_ptr d;
+    _nmod_poly_mat_geometric_t G;
+    nmod_t mod;
 
     n = A->r;
 
@@ -42,27 +106,42 @@ nmod_poly_mat_det_interpolate(nmod_poly_t det, const nmod_poly_mat_t A)
     /* Bound degree based on Laplace expansion */
     len = n*(l - 1) + 1;
 
+    nmod_init(&mod, nmod_poly_mat_modulus(A));
+
     /* Not enough points to interpolate */
-    if (len > nmod_poly_mat_modulus(A))
+    if (len > mod.n || !_nmod_poly_mat_geometric_init(G, len, l, mod))
     {
         nmod_poly_mat_det_fflu(det, A);
         return;
     }
 
-    x = _nmod_vec_init(len);
+    /* evaluate in blocks of points to bound the memory used */
+    chunk = FLINT_MAX(1, DET_INTERPOLATE_MAX_LIMBS / (n * n));
+    chunk = FLINT_MIN(chunk, len);
+
     d = _nmod_vec_init(len);
-    nmod_mat_init(X, n, n, nmod_poly_mat_modulus(A));
+    X = flint_malloc(sizeof(nmod_mat_struct) * chunk);
 
-    for (i = 0; i < len; i++)
+    for (i = 0; i < chunk; i++)
+        nmod_mat_init(X + i, n, n, mod.n);
+
+    for (k = 0; k < len; k += chunk)
     {
-        x[i] = i;
-        nmod_poly_mat_evaluate_nmod(X, A, x[i]);
-        d[i] = nmod_mat_det(X);
+        slong clen = FLINT_MIN(chunk, len - k);
+
+        _nmod_poly_mat_evaluate_geometric(X, A, k, clen, G);
+        _det_pointwise(d + k, X, clen);
     }
 
-    nmod_poly_interpolate_nmod_vec(det, x, d, len);
+    nmod_poly_fit_length(det, len);
+    _nmod_poly_mat_geometric_interpolate_poly(det->coeffs, d, G);
+    det->length = len;
+    _nmod_poly_normalise(det);
+
+    for (i = 0; i < chunk; i++)
+        nmod_mat_clear(X + i);
 
-    _nmod_vec_clear(x);
+    flint_free(X);
     _nmod_vec_clear(d);
-    nmod_mat_clear(X);
+    _nmod_poly_mat_geometric_clear(G);
 }
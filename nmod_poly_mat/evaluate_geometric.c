@@ -0,0 +1,106 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+typedef struct
+{
+    nmod_mat_struct * B;
+    const nmod_poly_mat_struct * A;
+    slong start;
+    slong n;
+    const _nmod_poly_mat_geometric_struct * G;
+    slong e0;
+    slong e1;
+}
+evaluate_arg_t;
+
+static void
+_evaluate_entries(nmod_mat_struct * B, const nmod_poly_mat_t A, slong start,
+        slong n, const _nmod_poly_mat_geometric_t G, slong e0, slong e1)
+{
+    slong e, i, j, k;
+    mp_ptr tt;
+
+    tt = _nmod_vec_init(n);
+
+    for (e = e0; e < e1; e++)
+    {
+        i = e / A->c;
+        j = e % A->c;
+
+        _nmod_poly_mat_geometric_evaluate_poly(tt,
+            nmod_poly_mat_entry(A, i, j)->coeffs,
+            nmod_poly_mat_entry(A, i, j)->length, start, n, G);
+
+        for (k = 0; k < n; k++)
+            nmod_mat_entry(B + k, i, j) = tt[k];
+    }
+
+    _nmod_vec_clear(tt);
+}
+
+static void *
+_evaluate_worker(void * arg_ptr)
+{
+    evaluate_arg_t arg = *((evaluate_arg_t *) arg_ptr);
+
+    _evaluate_entries(arg.B, arg.A, arg.start, arg.n, arg.G, arg.e0, arg.e1);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_nmod_poly_mat_evaluate_geometric(nmod_mat_struct * B,
+                 const nmod_poly_mat_t A, slong start, slong n,
+                 const _nmod_poly_mat_geometric_t G)
+{
+    slong i, num_entries, num_threads;
+    pthread_t * threads;
+    evaluate_arg_t * args;
+
+    num_entries = A->r * A->c;
+    num_threads = FLINT_MIN(flint_get_num_threads(), num_entries);
+
+    if (num_threads <= 1 || n < 16)
+    {
+        _evaluate_entries(B, A, start, n, G, 0, num_entries);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(evaluate_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].B = B;
+        args[i].A = A;
+        args[i].start = start;
+        args[i].n = n;
+        args[i].G = G;
+        args[i].e0 = (num_entries * i) / num_threads;
+        args[i].e1 = (num_entries * (i + 1)) / num_threads;
+
+        pthread_create(&threads[i], NULL, _evaluate_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
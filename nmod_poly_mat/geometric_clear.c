@@ -0,0 +1,27 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly_mat.h"
+
+void
+_nmod_poly_mat_geometric_clear(_nmod_poly_mat_geometric_t G)
+{
+    if (G->chirp != NULL)
+    {
+        _nmod_vec_clear(G->chirp);
+        _nmod_vec_clear(G->chirp_inv);
+        _nmod_vec_clear(G->prod);
+        _nmod_vec_clear(G->weights);
+    }
+}
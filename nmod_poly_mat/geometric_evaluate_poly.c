@@ -0,0 +1,64 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+/*
+   Uses ij = (i + j)(i + j - 1)/2 - i(i - 1)/2 - j(j - 1)/2, so that the
+   values are a slice of the product of the reversed, scaled input with
+   the chirp sequence.
+*/
+void
+_nmod_poly_mat_geometric_evaluate_poly(mp_ptr vs, mp_srcptr poly,
+               slong plen, slong start, slong n,
+               const _nmod_poly_mat_geometric_t G)
+{
+    slong j, k;
+    mp_limb_t z, zj;
+    mp_ptr a, t;
+    const nmod_t mod = G->mod;
+
+    if (n == 0)
+        return;
+
+    if (plen == 0)
+    {
+        _nmod_vec_zero(vs, n);
+        return;
+    }
+
+    a = _nmod_vec_init(plen);
+    t = _nmod_vec_init(n + 2 * plen - 2);
+
+    /* a[plen - 1 - j] = poly[j] q^(start j) q^(-j(j-1)/2) */
+    z = n_powmod2_preinv(G->q, start, mod.n, mod.ninv);
+    zj = UWORD(1);
+    for (j = 0; j < plen; j++)
+    {
+        a[plen - 1 - j] = n_mulmod2_preinv(n_mulmod2_preinv(poly[j],
+                zj, mod.n, mod.ninv), G->chirp_inv[j], mod.n, mod.ninv);
+        zj = n_mulmod2_preinv(zj, z, mod.n, mod.ninv);
+    }
+
+    /* the full product is faster than _nmod_poly_mullow here */
+    _nmod_poly_mul(t, G->chirp, n + plen - 1, a, plen, mod);
+
+    for (k = 0; k < n; k++)
+        vs[k] = n_mulmod2_preinv(t[plen - 1 + k], G->chirp_inv[k],
+                                 mod.n, mod.ninv);
+
+    _nmod_vec_clear(a);
+    _nmod_vec_clear(t);
+}
@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+/* number of candidates for q tried before giving up */
+#define GEOMETRIC_MAX_TRIES 100
+
+int
+_nmod_poly_mat_geometric_init(_nmod_poly_mat_geometric_t G,
+                                         slong len, slong plen, nmod_t mod)
+{
+    slong i, k;
+    mp_limb_t q, t, g;
+    mp_ptr xs, deriv;
+
+    G->len = len;
+    G->chirp_len = FLINT_MAX(2 * len - 1, len + plen - 1);
+    G->mod = mod;
+    G->chirp = NULL;
+    G->chirp_inv = NULL;
+    G->prod = NULL;
+    G->weights = NULL;
+
+    /* find q such that q^0, ..., q^(len - 1) are distinct */
+    for (q = 2; q < FLINT_MIN(mod.n, GEOMETRIC_MAX_TRIES + 2); q++)
+    {
+        t = q;
+        for (k = 1; k < len && t != UWORD(1); k++)
+            t = n_mulmod2_preinv(t, q, mod.n, mod.ninv);
+
+        if (k == len)
+            break;
+    }
+
+    if (q >= FLINT_MIN(mod.n, GEOMETRIC_MAX_TRIES + 2)
+        || n_gcdinv(&G->qinv, q, mod.n) != UWORD(1))
+        return 0;
+
+    G->q = q;
+
+    G->chirp = _nmod_vec_init(G->chirp_len);
+    G->chirp_inv = _nmod_vec_init(G->chirp_len);
+    G->prod = _nmod_vec_init(len + 1);
+    G->weights = _nmod_vec_init(len);
+
+    /* q^(k(k-1)/2) = q^(0 + 1 + ... + (k - 1)) */
+    G->chirp[0] = G->chirp_inv[0] = UWORD(1);
+    t = g = UWORD(1);
+    for (k = 1; k < G->chirp_len; k++)
+    {
+        G->chirp[k] = n_mulmod2_preinv(G->chirp[k - 1], t,
+                                       mod.n, mod.ninv);
+        G->chirp_inv[k] = n_mulmod2_preinv(G->chirp_inv[k - 1], g,
+                                           mod.n, mod.ninv);
+        t = n_mulmod2_preinv(t, q, mod.n, mod.ninv);
+        g = n_mulmod2_preinv(g, G->qinv, mod.n, mod.ninv);
+    }
+
+    xs = _nmod_vec_init(len);
+    xs[0] = UWORD(1);
+    for (i = 1; i < len; i++)
+        xs[i] = n_mulmod2_preinv(xs[i - 1], q, mod.n, mod.ninv);
+    _nmod_poly_product_roots_nmod_vec(G->prod, xs, len, mod);
+    _nmod_vec_clear(xs);
+
+    /* barycentric weights 1 / prod'(q^i) */
+    deriv = _nmod_vec_init(len);
+    _nmod_poly_derivative(deriv, G->prod, len + 1, mod);
+    _nmod_poly_mat_geometric_evaluate_poly(G->weights, deriv, len, 0, len, G);
+    _nmod_vec_clear(deriv);
+
+    for (i = 0; i < len; i++)
+    {
+        if (n_gcdinv(G->weights + i, G->weights[i], mod.n) != UWORD(1))
+        {
+            _nmod_poly_mat_geometric_clear(G);
+            return 0;
+        }
+    }
+
+    return 1;
+}
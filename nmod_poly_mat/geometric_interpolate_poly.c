@@ -0,0 +1,61 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+/*
+   The Lagrange interpolant is P(x) S(x) where P = prod (x - q^i) and
+   S(x) = sum_i c_i / (x - q^i) with c_i = v_i / P'(q^i). The power series
+   coefficients of S are s_k = -sum_i c_i q^(-i) q^(-ik), which is an
+   evaluation at the geometric progression with ratio 1/q.
+*/
+void
+_nmod_poly_mat_geometric_interpolate_poly(mp_ptr poly, mp_srcptr vs,
+                                       const _nmod_poly_mat_geometric_t G)
+{
+    slong i, k, n = G->len;
+    mp_limb_t z;
+    mp_ptr a, t;
+    const nmod_t mod = G->mod;
+
+    if (n == 0)
+        return;
+
+    a = _nmod_vec_init(n);
+    t = _nmod_vec_init(3 * n);
+
+    /* a[n - 1 - i] = c_i q^(-i) q^(i(i-1)/2) */
+    z = UWORD(1);
+    for (i = 0; i < n; i++)
+    {
+        a[n - 1 - i] = n_mulmod2_preinv(n_mulmod2_preinv(vs[i],
+                G->weights[i], mod.n, mod.ninv), n_mulmod2_preinv(z,
+                G->chirp[i], mod.n, mod.ninv), mod.n, mod.ninv);
+        z = n_mulmod2_preinv(z, G->qinv, mod.n, mod.ninv);
+    }
+
+    /* the full products are faster than _nmod_poly_mullow here */
+    _nmod_poly_mul(t, G->chirp_inv, 2 * n - 1, a, n, mod);
+
+    for (k = 0; k < n; k++)
+        a[k] = nmod_neg(n_mulmod2_preinv(t[n - 1 + k], G->chirp[k],
+                                         mod.n, mod.ninv), mod);
+
+    _nmod_poly_mul(t, G->prod, n + 1, a, n, mod);
+    _nmod_vec_set(poly, t, n);
+
+    _nmod_vec_clear(a);
+    _nmod_vec_clear(t);
+}
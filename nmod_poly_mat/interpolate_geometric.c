@@ -0,0 +1,104 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+typedef struct
+{
+    nmod_poly_mat_struct * A;
+    const nmod_mat_struct * B;
+    const _nmod_poly_mat_geometric_struct * G;
+    slong e0;
+    slong e1;
+}
+interpolate_arg_t;
+
+static void
+_interpolate_entries(nmod_poly_mat_t A, const nmod_mat_struct * B,
+                   const _nmod_poly_mat_geometric_t G, slong e0, slong e1)
+{
+    slong e, i, j, k, len = G->len;
+    mp_ptr tt;
+    nmod_poly_struct * poly;
+
+    tt = _nmod_vec_init(len);
+
+    for (e = e0; e < e1; e++)
+    {
+        i = e / A->c;
+        j = e % A->c;
+
+        for (k = 0; k < len; k++)
+            tt[k] = nmod_mat_entry(B + k, i, j);
+
+        poly = nmod_poly_mat_entry(A, i, j);
+        nmod_poly_fit_length(poly, len);
+        _nmod_poly_mat_geometric_interpolate_poly(poly->coeffs, tt, G);
+        poly->length = len;
+        _nmod_poly_normalise(poly);
+    }
+
+    _nmod_vec_clear(tt);
+}
+
+static void *
+_interpolate_worker(void * arg_ptr)
+{
+    interpolate_arg_t arg = *((interpolate_arg_t *) arg_ptr);
+
+    _interpolate_entries(arg.A, arg.B, arg.G, arg.e0, arg.e1);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_nmod_poly_mat_interpolate_geometric(nmod_poly_mat_t A,
+                const nmod_mat_struct * B, const _nmod_poly_mat_geometric_t G)
+{
+    slong i, num_entries, num_threads;
+    pthread_t * threads;
+    interpolate_arg_t * args;
+
+    num_entries = A->r * A->c;
+    num_threads = FLINT_MIN(flint_get_num_threads(), num_entries);
+
+    if (num_threads <= 1 || G->len < 16)
+    {
+        _interpolate_entries(A, B, G, 0, num_entries);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(interpolate_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].A = A;
+        args[i].B = B;
+        args[i].G = G;
+        args[i].e0 = (num_entries * i) / num_threads;
+        args[i].e1 = (num_entries * (i + 1)) / num_threads;
+
+        pthread_create(&threads[i], NULL, _interpolate_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
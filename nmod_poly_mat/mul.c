@@ -14,7 +14,7 @@
 #include "nmod_poly_mat.h"
 
 #define KS_MIN_DIM 10
-#define INTERPOLATE_MIN_DIM 60
+#define INTERPOLATE_MIN_DIM 20
 #define KS_MAX_LENGTH 128
 
 void
@@ -42,8 +42,8 @@ nmod_poly_mat_mul(nmod_poly_mat_t C, const nmod_poly_mat_t A,
         Blen = nmod_poly_mat_max_length(B);
 
         if ((FLINT_BIT_COUNT(mod) > FLINT_BITS / 4)
-            && (dim > INTERPOLATE_MIN_DIM + n_sqrt(FLINT_MIN(Alen, Blen)))
-            && (mod >= Alen + Blen - 1) && n_is_prime(mod))
+            && (dim > INTERPOLATE_MIN_DIM)
+            && (mod > Alen + Blen - 1) && n_is_prime(mod))
             nmod_poly_mat_mul_interpolate(C, A, B);
 
         else if (Alen > KS_MAX_LENGTH || Blen > KS_MAX_LENGTH)
@@ -0,0 +1,77 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_poly_mat.h"
+
+typedef struct
+{
+    nmod_mat_struct * C;
+    const nmod_mat_struct * A;
+    const nmod_mat_struct * B;
+    slong k0;
+    slong k1;
+}
+mul_pointwise_arg_t;
+
+static void *
+_mul_pointwise_worker(void * arg_ptr)
+{
+    mul_pointwise_arg_t arg = *((mul_pointwise_arg_t *) arg_ptr);
+    slong k;
+
+    for (k = arg.k0; k < arg.k1; k++)
+        nmod_mat_mul(arg.C + k, arg.A + k, arg.B + k);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_nmod_poly_mat_mul_pointwise(nmod_mat_struct * C, const nmod_mat_struct * A,
+                                       const nmod_mat_struct * B, slong len)
+{
+    slong i, num_threads;
+    pthread_t * threads;
+    mul_pointwise_arg_t * args;
+
+    num_threads = FLINT_MIN(flint_get_num_threads(), len);
+
+    if (num_threads <= 1)
+    {
+        for (i = 0; i < len; i++)
+            nmod_mat_mul(C + i, A + i, B + i);
+        return;
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(mul_pointwise_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].C = C;
+        args[i].A = A;
+        args[i].B = B;
+        args[i].k0 = (len * i) / num_threads;
+        args[i].k1 = (len * (i + 1)) / num_threads;
+
+        pthread_create(&threads[i], NULL, _mul_pointwise_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
@@ -15,7 +15,7 @@
 #include "nmod_poly_mat.h"
 
 #define KS_MIN_DIM 10
-#define INTERPOLATE_MIN_DIM 80
+#define INTERPOLATE_MIN_DIM 20
 #define KS_MAX_LENGTH 128
 
 void
@@ -35,11 +35,10 @@ nmod_poly_mat_sqr(nmod_poly_mat_t C, const nmod_poly_mat_t A)
         Alen = nmod_poly_mat_max_length(A);
 
         if ((FLINT_BIT_COUNT(mod) > FLINT_BITS / 4)
-            && (dim > INTERPOLATE_MIN_DIM + n_sqrt(Alen))
-            && (mod >= 2 * Alen - 1) && n_is_prime(mod))
+            && (dim > INTERPOLATE_MIN_DIM)
+            && (mod > 2 * Alen - 1) && n_is_prime(mod))
             nmod_poly_mat_sqr_interpolate(C, A);
-
-        if (Alen > KS_MAX_LENGTH)
+        else if (Alen > KS_MAX_LENGTH)
             nmod_poly_mat_sqr_classical(C, A);
         else
             nmod_poly_mat_sqr_KS(C, A);
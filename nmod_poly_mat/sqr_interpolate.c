@@ -16,15 +16,12 @@
 void
 nmod_poly_mat_sqr_interpolate(nmod_poly_mat_t C, const nmod_poly_mat_t A)
 {
-    slong i, j, k;
+    slong i;
     slong A_len, len;
 
-    nmod_mat_t *C_mod, *A_mod;
+    nmod_mat_struct *C_mod, *A_mod;
 
-    mp_ptr xs;
-    mp_ptr tt, uu;
-    mp_ptr * tree;
-    mp_ptr weights;
+    _nmod_poly_mat_geometric_t G;
     nmod_t mod;
 
     if (A->c == 0)
@@ -51,74 +48,37 @@ nmod_poly_mat_sqr_interpolate(nmod_poly_mat_t C, const nmod_poly_mat_t A)
         flint_abort();
     }
 
-    xs = _nmod_vec_init(len);
-    tt = _nmod_vec_init(len);
-    uu = _nmod_vec_init(len);
-    weights = _nmod_vec_init(len);
-
-    A_mod = flint_malloc(sizeof(nmod_mat_t) * len);
-    C_mod = flint_malloc(sizeof(nmod_mat_t) * len);
-
-    for (i = 0; i < len; i++)
+    /* no suitable geometric progression, e.g. if mod.n == len */
+    if (!_nmod_poly_mat_geometric_init(G, len, A_len, mod))
     {
-        xs[i] = i;
-        nmod_mat_init(A_mod[i], A->r, A->c, mod.n);
-        nmod_mat_init(C_mod[i], C->r, C->c, mod.n);
+        nmod_poly_mat_sqr_classical(C, A);
+        return;
     }
 
-    tree = _nmod_poly_tree_alloc(len);
-    _nmod_poly_tree_build(tree, xs, len, mod);
-    _nmod_poly_interpolation_weights(weights, tree, len, mod);
+    A_mod = flint_malloc(sizeof(nmod_mat_struct) * len);
+    C_mod = flint_malloc(sizeof(nmod_mat_struct) * len);
 
-    for (i = 0; i < A->r; i++)
+    for (i = 0; i < len; i++)
     {
-        for (j = 0; j < A->c; j++)
-        {
-            _nmod_poly_evaluate_nmod_vec_fast_precomp(tt,
-                nmod_poly_mat_entry(A, i, j)->coeffs, 
-                nmod_poly_mat_entry(A, i, j)->length,
-                tree, len, mod);
-
-            for (k = 0; k < len; k++)
-                A_mod[k]->rows[i][j] = tt[k];
-        }
+        nmod_mat_init(A_mod + i, A->r, A->c, mod.n);
+        nmod_mat_init(C_mod + i, C->r, C->c, mod.n);
     }
 
-    /* should be nmod_mat_sqr */
-    for (i = 0; i < len; i++)
-        nmod_mat_mul(C_mod[i], A_mod[i], A_mod[i]);
+    _nmod_poly_mat_evaluate_geometric(A_mod, A, 0, len, G);
 
-    for (i = 0; i < C->r; i++)
-    {
-        for (j = 0; j < C->c; j++)
-        {
-            nmod_poly_struct * poly;
-
-            for (k = 0; k < len; k++)
-                tt[k] = C_mod[k]->rows[i][j];
-
-            poly = nmod_poly_mat_entry(C, i, j);
-            nmod_poly_fit_length(poly, len);
-            _nmod_poly_interpolate_nmod_vec_fast_precomp(poly->coeffs,
-                tt, tree, weights, len, mod);
-            poly->length = len;
-            _nmod_poly_normalise(poly);
-        }
-    }
+    /* should be nmod_mat_sqr */
+    _nmod_poly_mat_mul_pointwise(C_mod, A_mod, A_mod, len);
 
-    _nmod_poly_tree_free(tree, len);
+    _nmod_poly_mat_interpolate_geometric(C, C_mod, G);
 
     for (i = 0; i < len; i++)
     {
-        nmod_mat_clear(A_mod[i]);
-        nmod_mat_clear(C_mod[i]);
+        nmod_mat_clear(A_mod + i);
+        nmod_mat_clear(C_mod + i);
     }
 
     flint_free(A_mod);
     flint_free(C_mod);
 
-    _nmod_vec_clear(xs);
-    _nmod_vec_clear(tt);
-    _nmod_vec_clear(uu);
-    _nmod_vec_clear(weights);
+    _nmod_poly_mat_geometric_clear(G);
 }
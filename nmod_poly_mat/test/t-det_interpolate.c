@@ -33,6 +33,7 @@ main(void)
         slong n, deg;
         mp_limb_t mod;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
         mod = n_randtest_prime(state, 0);
         n = n_randint(state, 10);
         deg = 1 + n_randint(state, 5);
@@ -0,0 +1,85 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+int
+main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("geometric_evaluate_poly....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        _nmod_poly_mat_geometric_t G;
+        nmod_poly_t f;
+        nmod_t mod;
+        mp_ptr vs;
+        mp_limb_t x;
+        slong j, len, plen, start, n;
+
+        nmod_init(&mod, n_randtest_prime(state, 0));
+        len = 1 + n_randint(state, 100);
+        plen = n_randint(state, 100);
+
+        if (!_nmod_poly_mat_geometric_init(G, len, plen, mod))
+        {
+            if (mod.n > len + 100)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("init failed, len = %wd, p = %wu\n", len, mod.n);
+                abort();
+            }
+
+            continue;
+        }
+
+        start = n_randint(state, 1000);
+        n = n_randint(state, len + 1);
+
+        nmod_poly_init(f, mod.n);
+        nmod_poly_randtest(f, state, plen);
+        vs = _nmod_vec_init(n);
+
+        _nmod_poly_mat_geometric_evaluate_poly(vs, f->coeffs, f->length,
+                                               start, n, G);
+
+        for (j = 0; j < n; j++)
+        {
+            x = n_powmod2_preinv(G->q, start + j, mod.n, mod.ninv);
+
+            if (vs[j] != nmod_poly_evaluate_nmod(f, x))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("len = %wd, start = %wd, j = %wd\n", len, start, j);
+                abort();
+            }
+        }
+
+        nmod_poly_clear(f);
+        _nmod_vec_clear(vs);
+        _nmod_poly_mat_geometric_clear(G);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
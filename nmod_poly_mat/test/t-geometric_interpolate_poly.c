@@ -0,0 +1,75 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+
+int
+main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("geometric_interpolate_poly....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        _nmod_poly_mat_geometric_t G;
+        nmod_poly_t f, g;
+        nmod_t mod;
+        mp_ptr vs;
+        slong len;
+
+        nmod_init(&mod, n_randtest_prime(state, 0));
+        len = 1 + n_randint(state, 100);
+
+        if (!_nmod_poly_mat_geometric_init(G, len, len, mod))
+            continue;
+
+        nmod_poly_init(f, mod.n);
+        nmod_poly_init(g, mod.n);
+        nmod_poly_randtest(f, state, len);
+        vs = _nmod_vec_init(len);
+
+        _nmod_poly_mat_geometric_evaluate_poly(vs, f->coeffs, f->length,
+                                               0, len, G);
+
+        nmod_poly_fit_length(g, len);
+        _nmod_poly_mat_geometric_interpolate_poly(g->coeffs, vs, G);
+        g->length = len;
+        _nmod_poly_normalise(g);
+
+        if (!nmod_poly_equal(f, g))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("len = %wd, p = %wu\n", len, mod.n);
+            nmod_poly_print(f); flint_printf("\n\n");
+            nmod_poly_print(g); flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+        _nmod_vec_clear(vs);
+        _nmod_poly_mat_geometric_clear(G);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -35,6 +35,7 @@ main(void)
         mp_limb_t mod, x;
         slong m, n, k, deg;
 
+        flint_set_num_threads(1 + n_randint(state, 3));
         mod = n_randtest_prime(state, 0);
         m = n_randint(state, 20);
         n = n_randint(state, 20);
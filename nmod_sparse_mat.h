@@ -0,0 +1,214 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NMOD_SPARSE_MAT_H
+#define NMOD_SPARSE_MAT_H
+
+#ifdef NMOD_SPARSE_MAT_INLINES_C
+#define NMOD_SPARSE_MAT_INLINE FLINT_DLL
+#else
+#define NMOD_SPARSE_MAT_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "longlong.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_poly_mat.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+   Block Wiedemann rank is only used when p is at least this multiple of
+   the largest dimension, below which it underestimates the rank too often
+*/
+#define NMOD_SPARSE_MAT_RANK_DENSE_CUTOFF 16
+
+/*
+   Compressed sparse row storage. The nonzero entries of row i are
+   entries[rowptr[i]], ..., entries[rowptr[i + 1] - 1], with column indices
+   stored in the same positions of colidx, sorted in increasing order.
+*/
+typedef struct
+{
+    mp_limb_t * entries;
+    slong * colidx;
+    slong * rowptr;
+    slong r;
+    slong c;
+    slong nnz;
+    slong alloc;
+    nmod_t mod;
+}
+nmod_sparse_mat_struct;
+
+/* nmod_sparse_mat_t allows reference-like semantics for nmod_sparse_mat_struct */
+typedef nmod_sparse_mat_struct nmod_sparse_mat_t[1];
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nrows(const nmod_sparse_mat_t mat)
+{
+   return mat->r;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_ncols(const nmod_sparse_mat_t mat)
+{
+   return mat->c;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nnz(const nmod_sparse_mat_t mat)
+{
+   return mat->nnz;
+}
+
+NMOD_SPARSE_MAT_INLINE
+void nmod_sparse_mat_swap(nmod_sparse_mat_t mat1, nmod_sparse_mat_t mat2)
+{
+    if (mat1 != mat2)
+    {
+        nmod_sparse_mat_struct tmp;
+
+        tmp = *mat1;
+        *mat1 = *mat2;
+        *mat2 = tmp;
+    }
+}
+
+/* Memory management */
+
+FLINT_DLL void nmod_sparse_mat_init(nmod_sparse_mat_t mat,
+                                    slong rows, slong cols, mp_limb_t n);
+
+FLINT_DLL void nmod_sparse_mat_clear(nmod_sparse_mat_t mat);
+
+FLINT_DLL void nmod_sparse_mat_fit_nnz(nmod_sparse_mat_t mat, slong nnz);
+
+FLINT_DLL void nmod_sparse_mat_zero(nmod_sparse_mat_t mat);
+
+FLINT_DLL void nmod_sparse_mat_set(nmod_sparse_mat_t B,
+                                   const nmod_sparse_mat_t A);
+
+/* Conversion */
+
+FLINT_DLL void nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t A,
+                                            const nmod_mat_t B);
+
+FLINT_DLL void nmod_sparse_mat_get_nmod_mat(nmod_mat_t B,
+                                            const nmod_sparse_mat_t A);
+
+FLINT_DLL void nmod_sparse_mat_set_entries(nmod_sparse_mat_t A,
+       const slong * rows, const slong * cols, mp_srcptr vals, slong len);
+
+/* Random generation */
+
+FLINT_DLL void nmod_sparse_mat_randtest(nmod_sparse_mat_t mat,
+                                        flint_rand_t state, slong row_nnz);
+
+/* Comparison */
+
+FLINT_DLL int nmod_sparse_mat_equal(const nmod_sparse_mat_t A,
+                                    const nmod_sparse_mat_t B);
+
+/* Transpose */
+
+FLINT_DLL void nmod_sparse_mat_transpose(nmod_sparse_mat_t B,
+                                         const nmod_sparse_mat_t A);
+
+/* Matrix-vector and matrix-block products */
+
+FLINT_DLL void nmod_sparse_mat_mul_vec(mp_ptr y,
+                               const nmod_sparse_mat_t A, mp_srcptr x);
+
+FLINT_DLL void nmod_sparse_mat_mul_vec_transpose(mp_ptr y,
+                               const nmod_sparse_mat_t A, mp_srcptr x);
+
+FLINT_DLL void nmod_sparse_mat_mul_mat(nmod_mat_t Y,
+                               const nmod_sparse_mat_t A, const nmod_mat_t X);
+
+/* Block Wiedemann */
+
+/*
+   A black box operator on vectors of length n. If At is NULL it applies
+   x -> A D1 x, otherwise x -> D1 A^T D2 A D1 x. A NULL diagonal is treated
+   as the identity.
+*/
+typedef struct
+{
+    const nmod_sparse_mat_struct * A;
+    const nmod_sparse_mat_struct * At;
+    mp_srcptr d1;
+    mp_srcptr d2;
+    slong n;
+}
+_nmod_sparse_mat_bbox_struct;
+
+typedef _nmod_sparse_mat_bbox_struct _nmod_sparse_mat_bbox_t[1];
+
+FLINT_DLL void _nmod_sparse_mat_bbox_mul_mat(nmod_mat_t Y,
+                const _nmod_sparse_mat_bbox_t B, const nmod_mat_t X,
+                nmod_mat_t T);
+
+FLINT_DLL void _nmod_sparse_mat_bbox_mul_vec(mp_ptr y,
+                const _nmod_sparse_mat_bbox_t B, mp_srcptr x);
+
+FLINT_DLL slong _nmod_sparse_mat_block_wiedemann_length(slong n, slong b);
+
+FLINT_DLL void _nmod_sparse_mat_block_wiedemann_sequence(nmod_mat_struct * S,
+                const _nmod_sparse_mat_bbox_t B, const nmod_mat_t U,
+                const nmod_mat_t V, slong len);
+
+FLINT_DLL void _nmod_sparse_mat_block_wiedemann_generator(nmod_poly_mat_t P,
+                slong * deg, const nmod_mat_struct * S, slong len);
+
+FLINT_DLL void _nmod_sparse_mat_block_wiedemann_eval(mp_ptr y,
+                const _nmod_sparse_mat_bbox_t B, const nmod_mat_t V,
+                const nmod_poly_struct * p);
+
+FLINT_DLL void _nmod_sparse_mat_block_wiedemann(nmod_poly_mat_t P,
+                slong * deg, const _nmod_sparse_mat_bbox_t B,
+                const nmod_mat_t V, flint_rand_t state);
+
+FLINT_DLL slong _nmod_sparse_mat_block_wiedemann_rank(
+                const nmod_poly_mat_t P);
+
+FLINT_DLL slong nmod_sparse_mat_rank_block_wiedemann(
+                const nmod_sparse_mat_t A, slong block_size,
+                flint_rand_t state);
+
+FLINT_DLL mp_limb_t nmod_sparse_mat_det_block_wiedemann(
+                const nmod_sparse_mat_t A, slong block_size,
+                flint_rand_t state);
+
+FLINT_DLL slong nmod_sparse_mat_nullspace_block_wiedemann(nmod_mat_t X,
+                const nmod_sparse_mat_t A, slong block_size,
+                flint_rand_t state);
+
+FLINT_DLL int nmod_sparse_mat_solve_block_wiedemann(mp_ptr x,
+                const nmod_sparse_mat_t A, mp_srcptr b, slong block_size,
+                flint_rand_t state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+static void
+_nmod_mat_scale_rows(nmod_mat_t Y, mp_srcptr d, const nmod_mat_t X)
+{
+    slong i;
+
+    for (i = 0; i < X->r; i++)
+        _nmod_vec_scalar_mul_nmod(Y->rows[i], X->rows[i], X->c, d[i], X->mod);
+}
+
+/* T is temporary space with A->r rows and as many columns as X */
+void
+_nmod_sparse_mat_bbox_mul_mat(nmod_mat_t Y, const _nmod_sparse_mat_bbox_t B,
+                                        const nmod_mat_t X, nmod_mat_t T)
+{
+    if (B->At == NULL)
+    {
+        if (B->d1 == NULL)
+            nmod_sparse_mat_mul_mat(Y, B->A, X);
+        else
+        {
+            _nmod_mat_scale_rows(T, B->d1, X);
+            nmod_sparse_mat_mul_mat(Y, B->A, T);
+        }
+    }
+    else
+    {
+        if (B->d1 == NULL)
+            nmod_sparse_mat_mul_mat(T, B->A, X);
+        else
+        {
+            _nmod_mat_scale_rows(Y, B->d1, X);
+            nmod_sparse_mat_mul_mat(T, B->A, Y);
+        }
+
+        if (B->d2 != NULL)
+            _nmod_mat_scale_rows(T, B->d2, T);
+
+        nmod_sparse_mat_mul_mat(Y, B->At, T);
+
+        if (B->d1 != NULL)
+            _nmod_mat_scale_rows(Y, B->d1, Y);
+    }
+}
+
+void
+_nmod_sparse_mat_bbox_mul_vec(mp_ptr y, const _nmod_sparse_mat_bbox_t B,
+                                                               mp_srcptr x)
+{
+    slong i, n = B->n, m = B->A->r;
+    nmod_t mod = B->A->mod;
+    mp_ptr s, t;
+
+    s = _nmod_vec_init(FLINT_MAX(n, 1));
+    t = _nmod_vec_init(FLINT_MAX(m, 1));
+
+    if (B->d1 == NULL)
+        _nmod_vec_set(s, x, n);
+    else
+        for (i = 0; i < n; i++)
+            s[i] = n_mulmod2_preinv(x[i], B->d1[i], mod.n, mod.ninv);
+
+    if (B->At == NULL)
+        nmod_sparse_mat_mul_vec(y, B->A, s);
+    else
+    {
+        nmod_sparse_mat_mul_vec(t, B->A, s);
+
+        if (B->d2 != NULL)
+            for (i = 0; i < m; i++)
+                t[i] = n_mulmod2_preinv(t[i], B->d2[i], mod.n, mod.ninv);
+
+        nmod_sparse_mat_mul_vec(y, B->At, t);
+
+        if (B->d1 != NULL)
+            for (i = 0; i < n; i++)
+                y[i] = n_mulmod2_preinv(y[i], B->d1[i], mod.n, mod.ninv);
+    }
+
+    _nmod_vec_clear(s);
+    _nmod_vec_clear(t);
+}
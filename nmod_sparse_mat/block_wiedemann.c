@@ -0,0 +1,51 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly_mat.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   Computes a minimal right generator P of the sequence U B^i V for a
+   random projection U, where V is n x b. Column k of P has degree deg[k].
+*/
+void
+_nmod_sparse_mat_block_wiedemann(nmod_poly_mat_t P, slong * deg,
+           const _nmod_sparse_mat_bbox_t B, const nmod_mat_t V,
+           flint_rand_t state)
+{
+    slong i, b, len;
+    mp_limb_t p = V->mod.n;
+    nmod_mat_t U;
+    nmod_mat_struct * S;
+
+    b = V->c;
+    len = _nmod_sparse_mat_block_wiedemann_length(B->n, b);
+
+    nmod_mat_init(U, b, B->n, p);
+    nmod_mat_randfull(U, state);
+
+    S = flint_malloc(sizeof(nmod_mat_struct) * len);
+    for (i = 0; i < len; i++)
+        nmod_mat_init(S + i, b, b, p);
+
+    _nmod_sparse_mat_block_wiedemann_sequence(S, B, U, V, len);
+    _nmod_sparse_mat_block_wiedemann_generator(P, deg, S, len);
+
+    for (i = 0; i < len; i++)
+        nmod_mat_clear(S + i);
+    flint_free(S);
+
+    nmod_mat_clear(U);
+}
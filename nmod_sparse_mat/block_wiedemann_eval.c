@@ -0,0 +1,60 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_sparse_mat.h"
+
+/* y = sum_j B^j V p_j, where p is a vector of V->c polynomials */
+void
+_nmod_sparse_mat_block_wiedemann_eval(mp_ptr y,
+                const _nmod_sparse_mat_bbox_t B, const nmod_mat_t V,
+                const nmod_poly_struct * p)
+{
+    slong i, j, l, len, n = B->n;
+    int nlimbs;
+    mp_ptr t, c;
+
+    len = 0;
+    for (i = 0; i < V->c; i++)
+        len = FLINT_MAX(len, p[i].length);
+
+    _nmod_vec_zero(y, n);
+
+    if (len == 0)
+        return;
+
+    t = _nmod_vec_init(n);
+    c = _nmod_vec_init(V->c);
+    nlimbs = _nmod_vec_dot_bound_limbs(V->c, V->mod);
+
+    for (j = len - 1; j >= 0; j--)
+    {
+        if (j != len - 1)
+        {
+            _nmod_sparse_mat_bbox_mul_vec(t, B, y);
+            _nmod_vec_set(y, t, n);
+        }
+
+        for (i = 0; i < V->c; i++)
+            c[i] = nmod_poly_get_coeff_ui(p + i, j);
+
+        for (l = 0; l < n; l++)
+            y[l] = nmod_add(y[l],
+                   _nmod_vec_dot(V->rows[l], c, V->c, V->mod, nlimbs), V->mod);
+    }
+
+    _nmod_vec_clear(t);
+    _nmod_vec_clear(c);
+}
@@ -0,0 +1,265 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+#include "nmod_sparse_mat.h"
+
+#define NMOD_SPARSE_MAT_MBASIS_CUTOFF 32
+
+/*
+   The generator is read off from an order basis of F = [S(x) | -I]: the
+   columns [Q; R] of M satisfy S Q = R mod x^sigma. The shifted degree d[j]
+   of a column bounds max(deg Q, deg R + 1) and is tracked throughout.
+*/
+
+/* col_j -= a * col_c */
+static void
+_poly_mat_col_submul(nmod_poly_mat_t A, slong j, slong c, mp_limb_t a,
+                                                            nmod_poly_t t)
+{
+    slong i;
+
+    for (i = 0; i < A->r; i++)
+    {
+        if (!nmod_poly_is_zero(nmod_poly_mat_entry(A, i, c)))
+        {
+            nmod_poly_scalar_mul_nmod(t, nmod_poly_mat_entry(A, i, c), a);
+            nmod_poly_sub(nmod_poly_mat_entry(A, i, j),
+                          nmod_poly_mat_entry(A, i, j), t);
+        }
+    }
+}
+
+/* Iterative order basis (M-Basis); one constant elimination per order */
+static void
+_mbasis(nmod_poly_mat_t M, slong * d, const nmod_poly_mat_t F, slong sigma)
+{
+    slong b = F->r, m = F->c;
+    slong i, j, k, q, idx, npiv;
+    slong * perm, * piv_col, * piv_row;
+    mp_ptr piv_inv;
+    mp_limb_t a, p = F->modulus;
+    nmod_t mod;
+    nmod_mat_t D;
+    nmod_poly_mat_t G;
+    nmod_poly_t t;
+
+    nmod_init(&mod, p);
+
+    perm = flint_malloc(sizeof(slong) * m);
+    piv_col = flint_malloc(sizeof(slong) * b);
+    piv_row = flint_malloc(sizeof(slong) * b);
+    piv_inv = _nmod_vec_init(b);
+
+    nmod_mat_init(D, b, m, p);
+    nmod_poly_mat_init_set(G, F);
+    nmod_poly_init(t, p);
+
+    nmod_poly_mat_one(M);
+
+    for (k = 0; k < sigma; k++)
+    {
+        for (i = 0; i < b; i++)
+            for (j = 0; j < m; j++)
+                nmod_mat_entry(D, i, j) =
+                    nmod_poly_get_coeff_ui(nmod_poly_mat_entry(G, i, j), k);
+
+        /* stable sort of the columns by shifted degree */
+        for (j = 0; j < m; j++)
+        {
+            for (idx = j; idx > 0 && d[perm[idx - 1]] > d[j]; idx--)
+                perm[idx] = perm[idx - 1];
+            perm[idx] = j;
+        }
+
+        npiv = 0;
+        for (idx = 0; idx < m; idx++)
+        {
+            j = perm[idx];
+
+            for (q = 0; q < npiv; q++)
+            {
+                mp_limb_t c = nmod_mat_entry(D, piv_row[q], j);
+
+                if (c == 0)
+                    continue;
+
+                a = nmod_mul(c, piv_inv[q], mod);
+
+                for (i = 0; i < b; i++)
+                    nmod_mat_entry(D, i, j) = nmod_sub(nmod_mat_entry(D, i, j),
+                        nmod_mul(a, nmod_mat_entry(D, i, piv_col[q]), mod), mod);
+
+                _poly_mat_col_submul(G, j, piv_col[q], a, t);
+                _poly_mat_col_submul(M, j, piv_col[q], a, t);
+            }
+
+            if (npiv < b)
+            {
+                for (i = 0; i < b && nmod_mat_entry(D, i, j) == 0; i++) ;
+
+                if (i < b)
+                {
+                    piv_col[npiv] = j;
+                    piv_row[npiv] = i;
+                    piv_inv[npiv] = n_invmod(nmod_mat_entry(D, i, j), p);
+                    npiv++;
+                }
+            }
+        }
+
+        /* pivot columns are multiplied by x */
+        for (q = 0; q < npiv; q++)
+        {
+            j = piv_col[q];
+
+            for (i = 0; i < b; i++)
+            {
+                nmod_poly_struct * e = nmod_poly_mat_entry(G, i, j);
+
+                nmod_poly_shift_left(e, e, 1);
+                nmod_poly_truncate(e, sigma);
+            }
+
+            for (i = 0; i < m; i++)
+                nmod_poly_shift_left(nmod_poly_mat_entry(M, i, j),
+                                     nmod_poly_mat_entry(M, i, j), 1);
+
+            d[j]++;
+        }
+    }
+
+    flint_free(perm);
+    flint_free(piv_col);
+    flint_free(piv_row);
+    _nmod_vec_clear(piv_inv);
+
+    nmod_mat_clear(D);
+    nmod_poly_mat_clear(G);
+    nmod_poly_clear(t);
+}
+
+/* Divide and conquer order basis (PM-Basis) */
+static void
+_pmbasis(nmod_poly_mat_t M, slong * d, const nmod_poly_mat_t F, slong sigma)
+{
+    slong i, j, s1;
+    mp_limb_t p = F->modulus;
+    nmod_poly_mat_t F1, M1, M2;
+
+    if (sigma <= NMOD_SPARSE_MAT_MBASIS_CUTOFF)
+    {
+        _mbasis(M, d, F, sigma);
+        return;
+    }
+
+    s1 = sigma / 2;
+
+    nmod_poly_mat_init_set(F1, F);
+    nmod_poly_mat_init(M1, F->c, F->c, p);
+    nmod_poly_mat_init(M2, F->c, F->c, p);
+
+    for (i = 0; i < F->r; i++)
+        for (j = 0; j < F->c; j++)
+            nmod_poly_truncate(nmod_poly_mat_entry(F1, i, j), s1);
+
+    _pmbasis(M1, d, F1, s1);
+
+    /* residual (F M1) div x^s1 mod x^(sigma - s1) */
+    nmod_poly_mat_mul(F1, F, M1);
+
+    for (i = 0; i < F->r; i++)
+    {
+        for (j = 0; j < F->c; j++)
+        {
+            nmod_poly_struct * e = nmod_poly_mat_entry(F1, i, j);
+
+            nmod_poly_truncate(e, sigma);
+            nmod_poly_shift_right(e, e, s1);
+        }
+    }
+
+    _pmbasis(M2, d, F1, sigma - s1);
+
+    nmod_poly_mat_mul(M, M1, M2);
+
+    nmod_poly_mat_clear(F1);
+    nmod_poly_mat_clear(M1);
+    nmod_poly_mat_clear(M2);
+}
+
+void
+_nmod_sparse_mat_block_wiedemann_generator(nmod_poly_mat_t P, slong * deg,
+                                   const nmod_mat_struct * S, slong len)
+{
+    slong b = S->r, m = 2 * S->r;
+    slong i, j, k, idx;
+    slong * d, * perm;
+    mp_limb_t p = S->mod.n;
+    nmod_poly_mat_t F, M;
+
+    d = flint_malloc(sizeof(slong) * m);
+    perm = flint_malloc(sizeof(slong) * m);
+
+    nmod_poly_mat_init(F, b, m, p);
+    nmod_poly_mat_init(M, m, m, p);
+
+    for (i = 0; i < b; i++)
+    {
+        for (j = 0; j < b; j++)
+        {
+            nmod_poly_struct * e = nmod_poly_mat_entry(F, i, j);
+
+            nmod_poly_fit_length(e, len);
+            for (k = 0; k < len; k++)
+                e->coeffs[k] = nmod_mat_entry(S + k, i, j);
+            _nmod_poly_set_length(e, len);
+            _nmod_poly_normalise(e);
+        }
+
+        nmod_poly_set_coeff_ui(nmod_poly_mat_entry(F, i, b + i), 0,
+                               nmod_neg(1, S->mod));
+    }
+
+    for (j = 0; j < m; j++)
+        d[j] = (j >= b);
+
+    _pmbasis(M, d, F, len);
+
+    /* the b columns of smallest shifted degree, reversed, give P */
+    for (j = 0; j < m; j++)
+    {
+        for (idx = j; idx > 0 && d[perm[idx - 1]] > d[j]; idx--)
+            perm[idx] = perm[idx - 1];
+        perm[idx] = j;
+    }
+
+    for (k = 0; k < b; k++)
+    {
+        j = perm[k];
+        deg[k] = d[j];
+
+        for (i = 0; i < b; i++)
+            nmod_poly_reverse(nmod_poly_mat_entry(P, i, k),
+                              nmod_poly_mat_entry(M, i, j), d[j] + 1);
+    }
+
+    flint_free(d);
+    flint_free(perm);
+
+    nmod_poly_mat_clear(F);
+    nmod_poly_mat_clear(M);
+}
@@ -0,0 +1,141 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+slong
+_nmod_sparse_mat_block_wiedemann_length(slong n, slong b)
+{
+    /* The generator has degree about n/b and each of its columns needs
+       about n/b further terms of the sequence to be certified. */
+    return 2 * ((n + b - 1) / b) + 5;
+}
+
+typedef struct
+{
+    nmod_mat_struct * S;
+    const _nmod_sparse_mat_bbox_struct * B;
+    const nmod_mat_struct * U;
+    const nmod_mat_struct * V;
+    slong len;
+    slong j0;
+    slong j1;
+}
+bw_seq_arg_t;
+
+static void
+_bw_sequence_columns(bw_seq_arg_t * arg)
+{
+    nmod_mat_t X, Y, T, W;
+    slong i, j, k, l, n, b;
+    mp_limb_t p;
+
+    n = arg->B->n;
+    b = arg->U->r;
+    k = arg->j1 - arg->j0;
+    p = arg->U->mod.n;
+
+    nmod_mat_init(X, n, k, p);
+    nmod_mat_init(Y, n, k, p);
+    nmod_mat_init(T, arg->B->A->r, k, p);
+    nmod_mat_init(W, b, k, p);
+
+    for (l = 0; l < n; l++)
+        for (j = 0; j < k; j++)
+            nmod_mat_entry(X, l, j) = nmod_mat_entry(arg->V, l, arg->j0 + j);
+
+    for (i = 0; i < arg->len; i++)
+    {
+        /* S_i[:, j0:j1] = U A^i V[:, j0:j1] */
+        nmod_mat_mul(W, arg->U, X);
+
+        for (l = 0; l < b; l++)
+            for (j = 0; j < k; j++)
+                nmod_mat_entry(arg->S + i, l, arg->j0 + j)
+                    = nmod_mat_entry(W, l, j);
+
+        if (i + 1 < arg->len)
+        {
+            _nmod_sparse_mat_bbox_mul_mat(Y, arg->B, X, T);
+            nmod_mat_swap(X, Y);
+        }
+    }
+
+    nmod_mat_clear(X);
+    nmod_mat_clear(Y);
+    nmod_mat_clear(T);
+    nmod_mat_clear(W);
+}
+
+static void *
+_bw_sequence_worker(void * arg_ptr)
+{
+    _bw_sequence_columns((bw_seq_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+   Sets S[i] = U B^i V for 0 <= i < len, where U is b x n and V is n x b.
+   The columns of V are split between threads, each of which runs its own
+   blocked Krylov iteration.
+*/
+void
+_nmod_sparse_mat_block_wiedemann_sequence(nmod_mat_struct * S,
+               const _nmod_sparse_mat_bbox_t B, const nmod_mat_t U,
+               const nmod_mat_t V, slong len)
+{
+    slong i, b, num_threads;
+    bw_seq_arg_t * args;
+
+    b = V->c;
+    num_threads = FLINT_MAX(1, FLINT_MIN(flint_get_num_threads(), b));
+
+    args = flint_malloc(sizeof(bw_seq_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].S = S;
+        args[i].B = B;
+        args[i].U = U;
+        args[i].V = V;
+        args[i].len = len;
+        args[i].j0 = (b * i) / num_threads;
+        args[i].j1 = (b * (i + 1)) / num_threads;
+    }
+
+    if (num_threads == 1)
+    {
+        _bw_sequence_columns(args);
+    }
+    else
+    {
+        pthread_t * threads;
+
+        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_create(&threads[i], NULL, _bw_sequence_worker, &args[i]);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(threads);
+    }
+
+    flint_free(args);
+}
@@ -0,0 +1,130 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_mat.h"
+#include "nmod_poly_mat.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   With a random diagonal D, the matrix A D is cyclic with high probability
+   when A is nonsingular, so the determinant of a minimal generator is a
+   multiple of its characteristic polynomial. Whenever the generator does
+   not give the whole characteristic polynomial we retry with twice the
+   block size. Over a small field, e.g. for p = 2 where D is the identity,
+   this may still fail once the block size has reached n, at which point
+   the dense determinant is no more expensive and is computed instead.
+*/
+mp_limb_t
+nmod_sparse_mat_det_block_wiedemann(const nmod_sparse_mat_t A,
+                                    slong block_size, flint_rand_t state)
+{
+    slong i, b, n;
+    mp_limb_t p = A->mod.n, det;
+    mp_ptr d;
+    nmod_mat_t V;
+    nmod_poly_mat_t P;
+    nmod_poly_t charpoly;
+    slong * deg;
+    _nmod_sparse_mat_bbox_t B;
+
+    n = A->r;
+
+    if (A->r != A->c)
+    {
+        flint_printf("Exception (nmod_sparse_mat_det_block_wiedemann). "
+                     "Non-square matrix.\n");
+        flint_abort();
+    }
+
+    if (n == 0)
+        return UWORD(1) % p;
+
+    if (A->nnz == 0)
+        return 0;
+
+    b = FLINT_MAX(1, FLINT_MIN(block_size, n));
+
+    d = _nmod_vec_init(n);
+    nmod_poly_init(charpoly, p);
+
+    B->A = A;
+    B->At = NULL;
+    B->d1 = d;
+    B->d2 = NULL;
+    B->n = n;
+
+    while (1)
+    {
+        for (i = 0; i < n; i++)
+            d[i] = n_randint(state, p - 1) + 1;
+
+        nmod_mat_init(V, n, b, p);
+        nmod_mat_randfull(V, state);
+
+        nmod_poly_mat_init(P, b, b, p);
+        deg = flint_malloc(sizeof(slong) * b);
+
+        _nmod_sparse_mat_block_wiedemann(P, deg, B, V, state);
+        nmod_poly_mat_det(charpoly, P);
+
+        flint_free(deg);
+        nmod_poly_mat_clear(P);
+        nmod_mat_clear(V);
+
+        if (!nmod_poly_is_zero(charpoly) && charpoly->coeffs[0] == 0)
+        {
+            det = 0;
+            break;
+        }
+
+        if (nmod_poly_degree(charpoly) == n)
+        {
+            /* det(A D) = (-1)^n charpoly(0) / lc */
+            det = n_invmod(nmod_poly_lead(charpoly)[0], p);
+            det = nmod_mul(det, charpoly->coeffs[0], A->mod);
+            if (n % 2)
+                det = nmod_neg(det, A->mod);
+
+            /* divide out det(D) */
+            for (i = 1; i < n; i++)
+                d[0] = nmod_mul(d[0], d[i], A->mod);
+
+            det = nmod_mul(det, n_invmod(d[0], p), A->mod);
+
+            break;
+        }
+
+        /* a zero or short generator determinant, try a larger block */
+        if (b == n)
+        {
+            nmod_mat_t M;
+
+            nmod_mat_init(M, n, n, p);
+            nmod_sparse_mat_get_nmod_mat(M, A);
+            det = nmod_mat_det(M);
+            nmod_mat_clear(M);
+
+            break;
+        }
+
+        b = FLINT_MIN(2 * b, n);
+    }
+
+    nmod_poly_clear(charpoly);
+    _nmod_vec_clear(d);
+
+    return det;
+}
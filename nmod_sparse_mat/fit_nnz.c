@@ -0,0 +1,31 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_fit_nnz(nmod_sparse_mat_t mat, slong nnz)
+{
+    if (nnz > mat->alloc)
+    {
+        if (nnz < 2 * mat->alloc)
+            nnz = 2 * mat->alloc;
+
+        mat->entries = (mp_limb_t *) flint_realloc(mat->entries,
+                                                   nnz * sizeof(mp_limb_t));
+        mat->colidx = (slong *) flint_realloc(mat->colidx,
+                                                   nnz * sizeof(slong));
+        mat->alloc = nnz;
+    }
+}
@@ -0,0 +1,42 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_mul_mat(nmod_mat_t Y, const nmod_sparse_mat_t A,
+                                                         const nmod_mat_t X)
+{
+    slong i, j, l, len;
+    int nlimbs;
+    const slong * colidx;
+    mp_srcptr entries;
+
+    nlimbs = _nmod_vec_dot_bound_limbs(A->c, A->mod);
+
+    /* each row of A is read once and applied to every column of X */
+    for (i = 0; i < A->r; i++)
+    {
+        entries = A->entries + A->rowptr[i];
+        colidx = A->colidx + A->rowptr[i];
+        len = A->rowptr[i + 1] - A->rowptr[i];
+
+        for (j = 0; j < X->c; j++)
+        {
+            NMOD_VEC_DOT(nmod_mat_entry(Y, i, j), l, len, entries[l],
+                         nmod_mat_entry(X, colidx[l], j), A->mod, nlimbs);
+        }
+    }
+}
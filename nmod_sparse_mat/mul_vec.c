@@ -0,0 +1,36 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A, mp_srcptr x)
+{
+    slong i, j, len;
+    int nlimbs;
+    const slong * colidx;
+    mp_srcptr entries;
+
+    nlimbs = _nmod_vec_dot_bound_limbs(A->c, A->mod);
+
+    for (i = 0; i < A->r; i++)
+    {
+        entries = A->entries + A->rowptr[i];
+        colidx = A->colidx + A->rowptr[i];
+        len = A->rowptr[i + 1] - A->rowptr[i];
+
+        NMOD_VEC_DOT(y[i], j, len, entries[j], x[colidx[j]], A->mod, nlimbs);
+    }
+}
@@ -0,0 +1,38 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_mul_vec_transpose(mp_ptr y, const nmod_sparse_mat_t A,
+                                                               mp_srcptr x)
+{
+    slong i, k;
+
+    _nmod_vec_zero(y, A->c);
+
+    for (i = 0; i < A->r; i++)
+    {
+        if (x[i] == 0)
+            continue;
+
+        for (k = A->rowptr[i]; k < A->rowptr[i + 1]; k++)
+        {
+            mp_limb_t t = n_mulmod2_preinv(A->entries[k], x[i],
+                                                   A->mod.n, A->mod.ninv);
+            y[A->colidx[k]] = nmod_add(y[A->colidx[k]], t, A->mod);
+        }
+    }
+}
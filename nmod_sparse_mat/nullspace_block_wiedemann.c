@@ -0,0 +1,224 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   Works with B = D1 A^T D2 A D1. For alpha in the kernel of P(0), the
+   vector polynomial P alpha = x^t q with t > 0, and w = sum_j B^j V q_j
+   satisfies B^t w = 0, so the last nonzero vector among w, B w, ...,
+   B^t w lies in the kernel of B. Candidates are scaled by D1 and checked
+   against A; each run contributes up to b of them, and runs are repeated
+   until the candidates span a space of dimension n - rank.
+*/
+static slong
+_collect_kernel_vectors(nmod_mat_t C, slong count,
+           const nmod_poly_mat_t P, const _nmod_sparse_mat_bbox_t B,
+           const nmod_mat_t V, const nmod_sparse_mat_t A)
+{
+    slong i, j, k, l, t, v, nullity, bs = P->r, n = B->n;
+    mp_limb_t p = P->modulus;
+    nmod_mat_t P0, K;
+    nmod_poly_struct * q;
+    nmod_poly_t s;
+    mp_ptr w, z, y;
+
+    nmod_mat_init(P0, bs, bs, p);
+    nmod_mat_init(K, bs, bs, p);
+
+    nmod_poly_mat_evaluate_nmod(P0, P, 0);
+    nullity = nmod_mat_nullspace(K, P0);
+
+    q = flint_malloc(sizeof(nmod_poly_struct) * bs);
+    for (i = 0; i < bs; i++)
+        nmod_poly_init(q + i, p);
+    nmod_poly_init(s, p);
+
+    w = _nmod_vec_init(n);
+    z = _nmod_vec_init(n);
+    y = _nmod_vec_init(FLINT_MAX(A->r, 1));
+
+    for (k = 0; k < nullity; k++)
+    {
+        /* q = P alpha, with valuation t */
+        t = WORD_MAX;
+        for (i = 0; i < bs; i++)
+        {
+            nmod_poly_zero(q + i);
+
+            for (j = 0; j < bs; j++)
+            {
+                nmod_poly_scalar_mul_nmod(s, nmod_poly_mat_entry(P, i, j),
+                                          nmod_mat_entry(K, j, k));
+                nmod_poly_add(q + i, q + i, s);
+            }
+
+            if (!nmod_poly_is_zero(q + i))
+            {
+                for (v = 0; q[i].coeffs[v] == 0; v++) ;
+                t = FLINT_MIN(t, v);
+            }
+        }
+
+        if (t == WORD_MAX)
+            continue;
+
+        for (i = 0; i < bs; i++)
+            nmod_poly_shift_right(q + i, q + i, t);
+
+        _nmod_sparse_mat_block_wiedemann_eval(w, B, V, q);
+
+        if (_nmod_vec_is_zero(w, n))
+            continue;
+
+        for (l = 0; l <= t; l++)
+        {
+            _nmod_sparse_mat_bbox_mul_vec(z, B, w);
+
+            if (_nmod_vec_is_zero(z, n))
+                break;
+
+            _nmod_vec_set(w, z, n);
+        }
+
+        if (l > t)
+            continue;
+
+        /* w is in the kernel of B, so D1 w should be in the kernel of A */
+        for (i = 0; i < n; i++)
+            w[i] = n_mulmod2_preinv(w[i], B->d1[i], A->mod.n, A->mod.ninv);
+
+        nmod_sparse_mat_mul_vec(y, A, w);
+
+        if (_nmod_vec_is_zero(y, A->r))
+        {
+            _nmod_vec_set(C->rows[count], w, n);
+            count++;
+        }
+    }
+
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(z);
+    _nmod_vec_clear(y);
+
+    for (i = 0; i < bs; i++)
+        nmod_poly_clear(q + i);
+    flint_free(q);
+    nmod_poly_clear(s);
+
+    nmod_mat_clear(P0);
+    nmod_mat_clear(K);
+
+    return count;
+}
+
+slong
+nmod_sparse_mat_nullspace_block_wiedemann(nmod_mat_t X,
+         const nmod_sparse_mat_t A, slong block_size, flint_rand_t state)
+{
+    slong i, j, b, m, n, rank, found, iter;
+    mp_limb_t p = A->mod.n;
+    mp_ptr d1, d2;
+    nmod_sparse_mat_t At;
+    nmod_mat_t V, C, T;
+    nmod_poly_mat_t P;
+    slong * deg;
+    _nmod_sparse_mat_bbox_t B;
+
+    m = A->r;
+    n = A->c;
+
+    if (n == 0 || A->nnz == 0)
+    {
+        nmod_mat_clear(X);
+        nmod_mat_init(X, n, n, p);
+        nmod_mat_one(X);
+        return n;
+    }
+
+    b = FLINT_MAX(1, FLINT_MIN(block_size, n));
+
+    nmod_sparse_mat_init(At, n, m, p);
+    nmod_sparse_mat_transpose(At, A);
+
+    d1 = _nmod_vec_init(n);
+    d2 = _nmod_vec_init(m);
+
+    B->A = A;
+    B->At = At;
+    B->d1 = d1;
+    B->d2 = d2;
+    B->n = n;
+
+    nmod_mat_init(V, n, b, p);
+    nmod_poly_mat_init(P, b, b, p);
+    deg = flint_malloc(sizeof(slong) * b);
+
+    /* rows 0 .. found - 1 of C hold a basis in reduced row echelon form */
+    nmod_mat_init(C, n + b, n, p);
+
+    rank = found = 0;
+
+    for (iter = 0; ; iter++)
+    {
+        for (i = 0; i < n; i++)
+            d1[i] = n_randint(state, p - 1) + 1;
+        for (i = 0; i < m; i++)
+            d2[i] = n_randint(state, p - 1) + 1;
+
+        nmod_mat_randfull(V, state);
+
+        _nmod_sparse_mat_block_wiedemann(P, deg, B, V, state);
+
+        rank = FLINT_MAX(rank, _nmod_sparse_mat_block_wiedemann_rank(P));
+
+        j = _collect_kernel_vectors(C, found, P, B, V, A);
+
+        if (j > found)
+        {
+            nmod_mat_init(T, j, n, p);
+            for (i = 0; i < j; i++)
+                _nmod_vec_set(T->rows[i], C->rows[i], n);
+
+            found = nmod_mat_rref(T);
+
+            for (i = 0; i < found; i++)
+                _nmod_vec_set(C->rows[i], T->rows[i], n);
+            nmod_mat_clear(T);
+        }
+
+        if (found >= n - rank || iter >= 4 + 2 * ((n - rank) / b))
+            break;
+    }
+
+    nmod_mat_clear(X);
+    nmod_mat_init(X, n, found, p);
+
+    for (i = 0; i < found; i++)
+        for (j = 0; j < n; j++)
+            nmod_mat_entry(X, j, i) = nmod_mat_entry(C, i, j);
+
+    flint_free(deg);
+    nmod_poly_mat_clear(P);
+    nmod_mat_clear(V);
+    nmod_mat_clear(C);
+    _nmod_vec_clear(d1);
+    _nmod_vec_clear(d2);
+    nmod_sparse_mat_clear(At);
+
+    return found;
+}
@@ -0,0 +1,52 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_randtest(nmod_sparse_mat_t mat, flint_rand_t state,
+                                                              slong row_nnz)
+{
+    slong i, k, len;
+    slong * rows, * cols;
+    mp_ptr vals;
+
+    if (mat->c == 0)
+        row_nnz = 0;
+
+    len = mat->r * row_nnz;
+
+    rows = (slong *) flint_malloc(FLINT_MAX(len, 1) * sizeof(slong));
+    cols = (slong *) flint_malloc(FLINT_MAX(len, 1) * sizeof(slong));
+    vals = _nmod_vec_init(FLINT_MAX(len, 1));
+
+    for (i = 0; i < mat->r; i++)
+    {
+        for (k = 0; k < row_nnz; k++)
+        {
+            rows[i * row_nnz + k] = i;
+            cols[i * row_nnz + k] = n_randint(state, mat->c);
+        }
+    }
+
+    _nmod_vec_randtest(vals, state, len, mat->mod);
+
+    /* repeated positions are summed, zero entries are dropped */
+    nmod_sparse_mat_set_entries(mat, rows, cols, vals, len);
+
+    flint_free(rows);
+    flint_free(cols);
+    _nmod_vec_clear(vals);
+}
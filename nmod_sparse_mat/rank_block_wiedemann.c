@@ -0,0 +1,117 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_mat.h"
+#include "nmod_poly_mat.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   For B = D1 A^T D2 A D1 with random diagonal D1, D2 the eigenvalue zero is
+   semisimple and the nonzero eigenvalues are distinct (with high
+   probability over a large field), so the x-free part of det P has degree
+   equal to the rank of A.
+*/
+slong
+_nmod_sparse_mat_block_wiedemann_rank(const nmod_poly_mat_t P)
+{
+    slong v, rank;
+    nmod_poly_t det;
+
+    nmod_poly_init(det, P->modulus);
+    nmod_poly_mat_det(det, P);
+
+    if (nmod_poly_is_zero(det))
+        rank = 0;
+    else
+    {
+        for (v = 0; det->coeffs[v] == 0; v++) ;
+
+        rank = nmod_poly_degree(det) - v;
+    }
+
+    nmod_poly_clear(det);
+
+    return rank;
+}
+
+slong
+nmod_sparse_mat_rank_block_wiedemann(const nmod_sparse_mat_t A,
+                                     slong block_size, flint_rand_t state)
+{
+    slong i, b, m, n, rank;
+    mp_limb_t p = A->mod.n;
+    mp_ptr d1, d2;
+    nmod_sparse_mat_t At;
+    nmod_mat_t V;
+    nmod_poly_mat_t P;
+    slong * deg;
+    _nmod_sparse_mat_bbox_t B;
+
+    m = A->r;
+    n = A->c;
+
+    if (m == 0 || n == 0 || A->nnz == 0)
+        return 0;
+
+    /* over a small field the preconditioners fail too often, go dense */
+    if (p < NMOD_SPARSE_MAT_RANK_DENSE_CUTOFF * FLINT_MAX(m, n))
+    {
+        nmod_mat_t M;
+
+        nmod_mat_init(M, m, n, p);
+        nmod_sparse_mat_get_nmod_mat(M, A);
+        rank = nmod_mat_rank(M);
+        nmod_mat_clear(M);
+
+        return rank;
+    }
+
+    b = FLINT_MAX(1, FLINT_MIN(block_size, n));
+
+    nmod_sparse_mat_init(At, n, m, p);
+    nmod_sparse_mat_transpose(At, A);
+
+    d1 = _nmod_vec_init(n);
+    d2 = _nmod_vec_init(m);
+    for (i = 0; i < n; i++)
+        d1[i] = n_randint(state, p - 1) + 1;
+    for (i = 0; i < m; i++)
+        d2[i] = n_randint(state, p - 1) + 1;
+
+    B->A = A;
+    B->At = At;
+    B->d1 = d1;
+    B->d2 = d2;
+    B->n = n;
+
+    nmod_mat_init(V, n, b, p);
+    nmod_mat_randfull(V, state);
+
+    nmod_poly_mat_init(P, b, b, p);
+    deg = flint_malloc(sizeof(slong) * b);
+
+    _nmod_sparse_mat_block_wiedemann(P, deg, B, V, state);
+    rank = _nmod_sparse_mat_block_wiedemann_rank(P);
+
+    flint_free(deg);
+    nmod_poly_mat_clear(P);
+    nmod_mat_clear(V);
+    _nmod_vec_clear(d1);
+    _nmod_vec_clear(d2);
+    nmod_sparse_mat_clear(At);
+
+    return rank;
+}
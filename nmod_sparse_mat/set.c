@@ -0,0 +1,36 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_set(nmod_sparse_mat_t B, const nmod_sparse_mat_t A)
+{
+    slong i;
+
+    if (A == B)
+        return;
+
+    nmod_sparse_mat_fit_nnz(B, A->nnz);
+
+    for (i = 0; i <= A->r; i++)
+        B->rowptr[i] = A->rowptr[i];
+
+    flint_mpn_copyi(B->entries, A->entries, A->nnz);
+
+    for (i = 0; i < A->nnz; i++)
+        B->colidx[i] = A->colidx[i];
+
+    B->nnz = A->nnz;
+}
@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+typedef struct
+{
+    slong col;
+    mp_limb_t val;
+}
+col_val_t;
+
+static int
+col_val_cmp(const void * a, const void * b)
+{
+    slong x = ((const col_val_t *) a)->col;
+    slong y = ((const col_val_t *) b)->col;
+
+    return (x > y) - (x < y);
+}
+
+void
+nmod_sparse_mat_set_entries(nmod_sparse_mat_t A, const slong * rows,
+                       const slong * cols, mp_srcptr vals, slong len)
+{
+    slong i, j, k, nnz;
+    slong * count;
+    col_val_t * tmp;
+
+    count = (slong *) flint_calloc(A->r + 1, sizeof(slong));
+    tmp = (col_val_t *) flint_malloc(FLINT_MAX(len, 1) * sizeof(col_val_t));
+
+    /* bucket the triples by row */
+    for (k = 0; k < len; k++)
+        count[rows[k] + 1]++;
+
+    for (i = 0; i < A->r; i++)
+        count[i + 1] += count[i];
+
+    for (k = 0; k < len; k++)
+    {
+        j = count[rows[k]]++;
+        tmp[j].col = cols[k];
+        tmp[j].val = vals[k];
+    }
+
+    nmod_sparse_mat_fit_nnz(A, len);
+
+    /* count[i] is now the end of row i */
+    nnz = 0;
+    for (i = 0, j = 0; i < A->r; i++)
+    {
+        slong end = count[i];
+
+        A->rowptr[i] = nnz;
+
+        qsort(tmp + j, end - j, sizeof(col_val_t), col_val_cmp);
+
+        while (j < end)
+        {
+            mp_limb_t c = 0;
+
+            k = j;
+            while (j < end && tmp[j].col == tmp[k].col)
+            {
+                c = nmod_add(c, tmp[j].val, A->mod);
+                j++;
+            }
+
+            if (c != 0)
+            {
+                A->entries[nnz] = c;
+                A->colidx[nnz] = tmp[k].col;
+                nnz++;
+            }
+        }
+    }
+
+    A->rowptr[A->r] = nnz;
+    A->nnz = nnz;
+
+    flint_free(tmp);
+    flint_free(count);
+}
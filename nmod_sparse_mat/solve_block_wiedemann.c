@@ -0,0 +1,133 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_poly_mat.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   The first column of V is b. If P is a generator, sum_j A^j V P_j = 0,
+   and for alpha with P_0 alpha = e_0 we get b = -A sum_{j>0} A^(j-1) V P_j
+   alpha. P_0 is invertible whenever A is.
+*/
+int
+nmod_sparse_mat_solve_block_wiedemann(mp_ptr x, const nmod_sparse_mat_t A,
+                   mp_srcptr b, slong block_size, flint_rand_t state)
+{
+    slong i, j, k, n, bs, attempt;
+    mp_limb_t p = A->mod.n;
+    mp_ptr alpha, e, t;
+    nmod_mat_t V, P0;
+    nmod_poly_mat_t P;
+    nmod_poly_struct * q;
+    nmod_poly_t s;
+    slong * deg;
+    _nmod_sparse_mat_bbox_t B;
+    int result = 0;
+
+    n = A->r;
+
+    if (A->r != A->c)
+    {
+        flint_printf("Exception (nmod_sparse_mat_solve_block_wiedemann). "
+                     "Non-square matrix.\n");
+        flint_abort();
+    }
+
+    if (_nmod_vec_is_zero(b, n))
+    {
+        _nmod_vec_zero(x, n);
+        return 1;
+    }
+
+    if (A->nnz == 0)
+        return 0;
+
+    bs = FLINT_MAX(1, FLINT_MIN(block_size, n));
+
+    B->A = A;
+    B->At = NULL;
+    B->d1 = NULL;
+    B->d2 = NULL;
+    B->n = n;
+
+    alpha = _nmod_vec_init(bs);
+    e = _nmod_vec_init(bs);
+    t = _nmod_vec_init(n);
+    q = flint_malloc(sizeof(nmod_poly_struct) * bs);
+    for (i = 0; i < bs; i++)
+        nmod_poly_init(q + i, p);
+    nmod_poly_init(s, p);
+    deg = flint_malloc(sizeof(slong) * bs);
+
+    nmod_mat_init(V, n, bs, p);
+    nmod_mat_init(P0, bs, bs, p);
+    nmod_poly_mat_init(P, bs, bs, p);
+
+    for (attempt = 0; attempt < 3 && !result; attempt++)
+    {
+        nmod_mat_randfull(V, state);
+        for (i = 0; i < n; i++)
+            nmod_mat_entry(V, i, 0) = b[i];
+
+        _nmod_sparse_mat_block_wiedemann(P, deg, B, V, state);
+
+        nmod_poly_mat_evaluate_nmod(P0, P, 0);
+
+        _nmod_vec_zero(e, bs);
+        e[0] = 1;
+
+        /* P_0 singular means A is singular with high probability */
+        if (!nmod_mat_solve_vec(alpha, P0, e))
+            break;
+
+        /* q = (P alpha - e_0) / x */
+        for (i = 0; i < bs; i++)
+        {
+            nmod_poly_zero(q + i);
+
+            for (j = 0; j < bs; j++)
+            {
+                nmod_poly_scalar_mul_nmod(s, nmod_poly_mat_entry(P, i, j),
+                                                                  alpha[j]);
+                nmod_poly_add(q + i, q + i, s);
+            }
+
+            nmod_poly_shift_right(q + i, q + i, 1);
+        }
+
+        _nmod_sparse_mat_block_wiedemann_eval(x, B, V, q);
+        _nmod_vec_neg(x, x, n, A->mod);
+
+        nmod_sparse_mat_mul_vec(t, A, x);
+
+        result = _nmod_vec_equal(t, b, n);
+    }
+
+    for (k = 0; k < bs; k++)
+        nmod_poly_clear(q + k);
+    flint_free(q);
+    flint_free(deg);
+    nmod_poly_clear(s);
+    _nmod_vec_clear(alpha);
+    _nmod_vec_clear(e);
+    _nmod_vec_clear(t);
+
+    nmod_mat_clear(V);
+    nmod_mat_clear(P0);
+    nmod_poly_mat_clear(P);
+
+    return result;
+}
@@ -0,0 +1,89 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("det_block_wiedemann....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A;
+        nmod_sparse_mat_t S;
+        slong n, b;
+        mp_limb_t mod, d1, d2;
+        int sparse;
+
+        n = n_randint(state, 30);
+        b = n_randint(state, 8) + 1;
+
+        sparse = n_randint(state, 2);
+
+        /* small moduli are allowed, the block size then grows as needed */
+        if (sparse && n_randint(state, 2) == 0)
+            mod = n_randtest_prime(state, 0);
+        else
+            mod = n_randprime(state, FLINT_BITS - n_randint(state, 8), 0);
+
+        flint_set_num_threads(n_randint(state, 3) + 1);
+
+        nmod_mat_init(A, n, n, mod);
+        nmod_sparse_mat_init(S, n, n, mod);
+
+        if (sparse)
+        {
+            nmod_sparse_mat_randtest(S, state, n_randint(state, 5));
+            nmod_sparse_mat_get_nmod_mat(A, S);
+        }
+        else
+        {
+            nmod_mat_randrank(A, state, n - (n > 0 && n_randint(state, 2)));
+            nmod_mat_randops(A, n_randint(state, 2 * n + 1), state);
+            nmod_sparse_mat_set_nmod_mat(S, A);
+        }
+
+        d1 = nmod_mat_det(A);
+        d2 = nmod_sparse_mat_det_block_wiedemann(S, b, state);
+
+        if (d1 != d2)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wd, b = %wd, mod = %wu, det = %wu, "
+                         "expected %wu\n", n, b, mod, d2, d1);
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_sparse_mat_clear(S);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,114 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i, j;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_vec/mul_vec_transpose....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, X, Y, Z, At;
+        nmod_sparse_mat_t S;
+        slong m, n;
+        mp_limb_t mod;
+        mp_ptr x, y;
+
+        m = n_randint(state, 30) + 1;
+        n = n_randint(state, 30) + 1;
+        mod = n_randtest_not_zero(state);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(At, n, m, mod);
+        nmod_mat_init(X, n, 1, mod);
+        nmod_mat_init(Y, m, 1, mod);
+        nmod_mat_init(Z, m, 1, mod);
+        nmod_sparse_mat_init(S, m, n, mod);
+
+        x = _nmod_vec_init(FLINT_MAX(m, n));
+        y = _nmod_vec_init(FLINT_MAX(m, n));
+
+        nmod_sparse_mat_randtest(S, state, n_randint(state, 10));
+        nmod_sparse_mat_get_nmod_mat(A, S);
+        nmod_mat_randtest(X, state);
+
+        for (j = 0; j < n; j++)
+            x[j] = nmod_mat_entry(X, j, 0);
+
+        nmod_sparse_mat_mul_vec(y, S, x);
+        nmod_mat_mul(Y, A, X);
+
+        for (j = 0; j < m; j++)
+            nmod_mat_entry(Z, j, 0) = y[j];
+
+        if (!nmod_mat_equal(Y, Z))
+        {
+            flint_printf("FAIL (mul_vec):\n");
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        /* transpose product of a vector of length m */
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        nmod_mat_clear(Z);
+        nmod_mat_init(X, m, 1, mod);
+        nmod_mat_init(Y, n, 1, mod);
+        nmod_mat_init(Z, n, 1, mod);
+
+        nmod_mat_randtest(X, state);
+        for (j = 0; j < m; j++)
+            x[j] = nmod_mat_entry(X, j, 0);
+
+        nmod_sparse_mat_mul_vec_transpose(y, S, x);
+        nmod_mat_transpose(At, A);
+        nmod_mat_mul(Y, At, X);
+
+        for (j = 0; j < n; j++)
+            nmod_mat_entry(Z, j, 0) = y[j];
+
+        if (!nmod_mat_equal(Y, Z))
+        {
+            flint_printf("FAIL (mul_vec_transpose):\n");
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(At);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        nmod_mat_clear(Z);
+        nmod_sparse_mat_clear(S);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
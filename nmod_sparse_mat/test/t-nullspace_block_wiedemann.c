@@ -0,0 +1,104 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullspace_block_wiedemann....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, X, Y;
+        nmod_sparse_mat_t S;
+        slong m, n, b, nullity;
+        mp_limb_t mod;
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+        b = n_randint(state, 8) + 1;
+        mod = n_randprime(state, FLINT_BITS - n_randint(state, 8), 0);
+
+        flint_set_num_threads(n_randint(state, 3) + 1);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(X, 0, 0, mod);
+        nmod_sparse_mat_init(S, m, n, mod);
+
+        if (n_randint(state, 2))
+        {
+            nmod_sparse_mat_randtest(S, state, n_randint(state, 4));
+            nmod_sparse_mat_get_nmod_mat(A, S);
+        }
+        else
+        {
+            nmod_mat_randrank(A, state,
+                              n_randint(state, FLINT_MIN(m, n) + 1));
+            nmod_mat_randops(A, n_randint(state, 2 * m + 1), state);
+            nmod_sparse_mat_set_nmod_mat(S, A);
+        }
+
+        nullity = nmod_sparse_mat_nullspace_block_wiedemann(X, S, b, state);
+
+        if (nullity != n - nmod_mat_rank(A) || X->r != n || X->c != nullity)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("wrong nullity %wd, expected %wd\n",
+                         nullity, n - nmod_mat_rank(A));
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        if (nmod_mat_rank(X) != nullity)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("kernel basis is not independent\n");
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_mat_init(Y, m, nullity, mod);
+        nmod_mat_mul(Y, A, X);
+
+        if (!nmod_mat_is_zero(Y))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("A * X != 0\n");
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        nmod_sparse_mat_clear(S);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
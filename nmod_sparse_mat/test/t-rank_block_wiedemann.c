@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rank_block_wiedemann....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A;
+        nmod_sparse_mat_t S;
+        slong m, n, r, rank, b;
+        mp_limb_t mod;
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+        b = n_randint(state, 8) + 1;
+        if (n_randint(state, 4) == 0)
+            mod = n_randprime(state, 2 + n_randint(state, 4), 0);
+        else
+            mod = n_randprime(state, FLINT_BITS - n_randint(state, 8), 0);
+
+        flint_set_num_threads(n_randint(state, 3) + 1);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_sparse_mat_init(S, m, n, mod);
+
+        if (n_randint(state, 2))
+        {
+            nmod_sparse_mat_randtest(S, state, n_randint(state, 4));
+            nmod_sparse_mat_get_nmod_mat(A, S);
+        }
+        else
+        {
+            nmod_mat_randrank(A, state,
+                              n_randint(state, FLINT_MIN(m, n) + 1));
+            nmod_mat_randops(A, n_randint(state, 2 * m + 1), state);
+            nmod_sparse_mat_set_nmod_mat(S, A);
+        }
+
+        r = nmod_mat_rank(A);
+        rank = nmod_sparse_mat_rank_block_wiedemann(S, b, state);
+
+        if (r != rank)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m = %wd, n = %wd, b = %wd, rank = %wd, "
+                         "expected %wd\n", m, n, b, rank, r);
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_sparse_mat_clear(S);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
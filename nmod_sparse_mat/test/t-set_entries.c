@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_entries....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, B;
+        nmod_sparse_mat_t S;
+        slong m, n, k, len;
+        slong * rows, * cols;
+        mp_ptr vals;
+        mp_limb_t mod;
+
+        m = n_randint(state, 20) + 1;
+        n = n_randint(state, 20) + 1;
+        len = n_randint(state, 3 * m * n);
+        mod = n_randtest_not_zero(state);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(B, m, n, mod);
+        nmod_sparse_mat_init(S, m, n, mod);
+
+        rows = flint_malloc(sizeof(slong) * (len + 1));
+        cols = flint_malloc(sizeof(slong) * (len + 1));
+        vals = _nmod_vec_init(len + 1);
+
+        /* repeated positions are summed */
+        for (k = 0; k < len; k++)
+        {
+            rows[k] = n_randint(state, m);
+            cols[k] = n_randint(state, n);
+            vals[k] = n_randint(state, mod);
+
+            nmod_mat_entry(A, rows[k], cols[k]) = nmod_add(
+                nmod_mat_entry(A, rows[k], cols[k]), vals[k], A->mod);
+        }
+
+        nmod_sparse_mat_set_entries(S, rows, cols, vals, len);
+        nmod_sparse_mat_get_nmod_mat(B, S);
+
+        for (k = 0; k < S->nnz; k++)
+        {
+            if (S->entries[k] == 0)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("explicit zero entry\n");
+                abort();
+            }
+        }
+
+        if (!nmod_mat_equal(A, B))
+        {
+            flint_printf("FAIL:\n");
+            nmod_mat_print_pretty(A);
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        flint_free(rows);
+        flint_free(cols);
+        _nmod_vec_clear(vals);
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_sparse_mat_clear(S);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,85 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_nmod_mat/get_nmod_mat....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, B;
+        nmod_sparse_mat_t S, T;
+        slong m, n;
+        mp_limb_t mod;
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+        mod = n_randtest_not_zero(state);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(B, m, n, mod);
+        nmod_sparse_mat_init(S, m, n, mod);
+        nmod_sparse_mat_init(T, m, n, mod);
+
+        nmod_mat_randtest(A, state);
+        if (n_randint(state, 2))
+            nmod_mat_randrank(A, state, n_randint(state, FLINT_MIN(m, n) + 1));
+
+        nmod_sparse_mat_set_nmod_mat(S, A);
+        nmod_sparse_mat_get_nmod_mat(B, S);
+
+        if (!nmod_mat_equal(A, B))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("dense -> sparse -> dense\n");
+            nmod_mat_print_pretty(A);
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        nmod_sparse_mat_randtest(T, state, n_randint(state, 6));
+        nmod_sparse_mat_get_nmod_mat(B, T);
+        nmod_sparse_mat_set_nmod_mat(S, B);
+
+        if (!nmod_sparse_mat_equal(S, T))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("sparse -> dense -> sparse\n");
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_sparse_mat_clear(S);
+        nmod_sparse_mat_clear(T);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i, j;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve_block_wiedemann....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A;
+        nmod_sparse_mat_t S;
+        slong n, b;
+        mp_limb_t mod;
+        mp_ptr x, y, rhs;
+        int result;
+
+        n = n_randint(state, 30);
+        b = n_randint(state, 8) + 1;
+        mod = n_randprime(state, FLINT_BITS - n_randint(state, 8), 0);
+
+        flint_set_num_threads(n_randint(state, 3) + 1);
+
+        nmod_mat_init(A, n, n, mod);
+        nmod_sparse_mat_init(S, n, n, mod);
+
+        x = _nmod_vec_init(n + 1);
+        y = _nmod_vec_init(n + 1);
+        rhs = _nmod_vec_init(n + 1);
+
+        if (n_randint(state, 2))
+        {
+            nmod_sparse_mat_randtest(S, state, n_randint(state, 5) + 1);
+            nmod_sparse_mat_get_nmod_mat(A, S);
+        }
+        else
+        {
+            nmod_mat_randrank(A, state, n);
+            nmod_mat_randops(A, n_randint(state, 2 * n + 1), state);
+            nmod_sparse_mat_set_nmod_mat(S, A);
+        }
+
+        for (j = 0; j < n; j++)
+            rhs[j] = n_randint(state, mod);
+
+        result = nmod_sparse_mat_solve_block_wiedemann(x, S, rhs, b, state);
+
+        if (result)
+        {
+            nmod_sparse_mat_mul_vec(y, S, x);
+
+            if (!_nmod_vec_equal(y, rhs, n))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("A x != b\n");
+                nmod_mat_print_pretty(A);
+                abort();
+            }
+        }
+        else if (nmod_mat_rank(A) == n && !_nmod_vec_is_zero(rhs, n))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("nonsingular system was not solved\n");
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+        _nmod_vec_clear(rhs);
+
+        nmod_mat_clear(A);
+        nmod_sparse_mat_clear(S);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("transpose....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, B, C;
+        nmod_sparse_mat_t S, T;
+        slong m, n;
+        mp_limb_t mod;
+
+        m = n_randint(state, 30);
+        n = n_randint(state, 30);
+        mod = n_randtest_not_zero(state);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(B, n, m, mod);
+        nmod_mat_init(C, n, m, mod);
+        nmod_sparse_mat_init(S, m, n, mod);
+        nmod_sparse_mat_init(T, n, m, mod);
+
+        nmod_sparse_mat_randtest(S, state, n_randint(state, 8));
+        nmod_sparse_mat_transpose(T, S);
+
+        nmod_sparse_mat_get_nmod_mat(A, S);
+        nmod_sparse_mat_get_nmod_mat(B, T);
+        nmod_mat_transpose(C, A);
+
+        if (!nmod_mat_equal(B, C))
+        {
+            flint_printf("FAIL:\n");
+            nmod_mat_print_pretty(A);
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        /* the transpose of the transpose is the original matrix */
+        nmod_sparse_mat_zero(S);
+        nmod_sparse_mat_transpose(S, T);
+        nmod_sparse_mat_get_nmod_mat(A, S);
+        nmod_mat_transpose(B, A);
+
+        if (!nmod_mat_equal(B, C))
+        {
+            flint_printf("FAIL (involution):\n");
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_sparse_mat_clear(S);
+        nmod_sparse_mat_clear(T);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
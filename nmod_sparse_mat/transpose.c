@@ -0,0 +1,63 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_transpose(nmod_sparse_mat_t B, const nmod_sparse_mat_t A)
+{
+    slong i, j, k;
+
+    if (A == B)
+    {
+        nmod_sparse_mat_t t;
+
+        nmod_sparse_mat_init(t, A->c, A->r, A->mod.n);
+        nmod_sparse_mat_transpose(t, A);
+        nmod_sparse_mat_swap(B, t);
+        nmod_sparse_mat_clear(t);
+
+        return;
+    }
+
+    nmod_sparse_mat_fit_nnz(B, A->nnz);
+
+    /* count the entries in each column of A */
+    for (j = 0; j <= A->c; j++)
+        B->rowptr[j] = 0;
+
+    for (k = 0; k < A->nnz; k++)
+        B->rowptr[A->colidx[k] + 1]++;
+
+    for (j = 0; j < A->c; j++)
+        B->rowptr[j + 1] += B->rowptr[j];
+
+    /* scatter, using rowptr[j] as the insertion point of row j of B;
+       rows of A are visited in order so columns of B remain sorted */
+    for (i = 0; i < A->r; i++)
+    {
+        for (k = A->rowptr[i]; k < A->rowptr[i + 1]; k++)
+        {
+            j = B->rowptr[A->colidx[k]]++;
+            B->entries[j] = A->entries[k];
+            B->colidx[j] = i;
+        }
+    }
+
+    for (j = A->c; j > 0; j--)
+        B->rowptr[j] = B->rowptr[j - 1];
+    B->rowptr[0] = 0;
+
+    B->nnz = A->nnz;
+}
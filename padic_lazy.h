@@ -0,0 +1,179 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PADIC_LAZY_H
+#define PADIC_LAZY_H
+
+#ifdef PADIC_LAZY_INLINES_C
+#define PADIC_LAZY_INLINE FLINT_DLL
+#else
+#define PADIC_LAZY_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpq.h"
+#include "padic.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Precision beyond the requested one to which an operand is checked
+    for being nonzero before inverting it
+ */
+#define PADIC_LAZY_ZERO_PREC WORD(256)
+
+/* Precision of a node for which no approximation has been computed yet */
+#define PADIC_LAZY_NO_PREC WORD_MIN
+
+typedef void (*padic_lazy_func_t)(padic_t, void *, const padic_ctx_t);
+
+typedef enum
+{
+    PADIC_LAZY_CONST,
+    PADIC_LAZY_FUNC,
+    PADIC_LAZY_ADD,
+    PADIC_LAZY_SUB,
+    PADIC_LAZY_NEG,
+    PADIC_LAZY_SHIFT,
+    PADIC_LAZY_MUL,
+    PADIC_LAZY_INV,
+    PADIC_LAZY_EXP,
+    PADIC_LAZY_LOG
+} padic_lazy_op_t;
+
+/*
+    A node of the expression graph. The approximation val is congruent to
+    the value of the node modulo p^N where N = padic_prec(val), or no
+    approximation is known if N is PADIC_LAZY_NO_PREC. For inversion, aux
+    holds the inverse of the unit of the operand modulo p^(padic_prec(aux)),
+    from which higher precision inverses are lifted.
+ */
+typedef struct _padic_lazy_node_struct
+{
+    padic_lazy_op_t op;
+    slong ref;
+    struct _padic_lazy_node_struct * arg[2];
+    slong e;
+    fmpq c;
+    padic_lazy_func_t func;
+    void * data;
+    padic_struct val;
+    padic_struct aux;
+}
+_padic_lazy_node_struct;
+
+typedef struct
+{
+    _padic_lazy_node_struct * node;
+}
+padic_lazy_struct;
+
+typedef padic_lazy_struct padic_lazy_t[1];
+
+/* Nodes *********************************************************************/
+
+FLINT_DLL _padic_lazy_node_struct * _padic_lazy_node_new(padic_lazy_op_t op,
+          _padic_lazy_node_struct * arg0, _padic_lazy_node_struct * arg1);
+
+FLINT_DLL void _padic_lazy_node_release(_padic_lazy_node_struct * node);
+
+FLINT_DLL void _padic_lazy_node_refine(_padic_lazy_node_struct * node,
+                                       slong N, const padic_ctx_t ctx);
+
+FLINT_DLL void _padic_lazy_set_node(padic_lazy_t rop,
+                                    _padic_lazy_node_struct * node);
+
+/* Memory management *********************************************************/
+
+FLINT_DLL void padic_lazy_init(padic_lazy_t rop);
+
+FLINT_DLL void padic_lazy_clear(padic_lazy_t rop);
+
+PADIC_LAZY_INLINE
+void padic_lazy_swap(padic_lazy_t op1, padic_lazy_t op2)
+{
+    _padic_lazy_node_struct * t = op1->node;
+
+    op1->node = op2->node;
+    op2->node = t;
+}
+
+PADIC_LAZY_INLINE
+slong padic_lazy_prec(const padic_lazy_t op)
+{
+    return padic_prec(&(op->node->val));
+}
+
+/* Assignment ****************************************************************/
+
+FLINT_DLL void padic_lazy_set(padic_lazy_t rop, const padic_lazy_t op);
+
+FLINT_DLL void padic_lazy_set_fmpq(padic_lazy_t rop, const fmpq_t op);
+
+FLINT_DLL void padic_lazy_set_fmpz(padic_lazy_t rop, const fmpz_t op);
+
+FLINT_DLL void padic_lazy_set_si(padic_lazy_t rop, slong op);
+
+FLINT_DLL void padic_lazy_set_padic(padic_lazy_t rop, const padic_t op,
+                                    const padic_ctx_t ctx);
+
+FLINT_DLL void padic_lazy_set_func(padic_lazy_t rop,
+                                   padic_lazy_func_t func, void * data);
+
+/* Arithmetic ****************************************************************/
+
+FLINT_DLL void padic_lazy_add(padic_lazy_t rop,
+                      const padic_lazy_t op1, const padic_lazy_t op2);
+
+FLINT_DLL void padic_lazy_sub(padic_lazy_t rop,
+                      const padic_lazy_t op1, const padic_lazy_t op2);
+
+FLINT_DLL void padic_lazy_neg(padic_lazy_t rop, const padic_lazy_t op);
+
+FLINT_DLL void padic_lazy_shift(padic_lazy_t rop,
+                                const padic_lazy_t op, slong v);
+
+FLINT_DLL void padic_lazy_mul(padic_lazy_t rop,
+                      const padic_lazy_t op1, const padic_lazy_t op2);
+
+FLINT_DLL void padic_lazy_inv(padic_lazy_t rop, const padic_lazy_t op);
+
+FLINT_DLL void padic_lazy_div(padic_lazy_t rop,
+                      const padic_lazy_t op1, const padic_lazy_t op2);
+
+FLINT_DLL void padic_lazy_exp(padic_lazy_t rop, const padic_lazy_t op);
+
+FLINT_DLL void padic_lazy_log(padic_lazy_t rop, const padic_lazy_t op);
+
+/* Evaluation ****************************************************************/
+
+FLINT_DLL void padic_lazy_get_padic(padic_t rop, const padic_lazy_t op,
+                                    const padic_ctx_t ctx);
+
+FLINT_DLL slong padic_lazy_val(const padic_lazy_t op, slong N,
+                               const padic_ctx_t ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
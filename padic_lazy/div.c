@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "padic_lazy.h"
+
+void padic_lazy_div(padic_lazy_t rop,
+                    const padic_lazy_t op1, const padic_lazy_t op2)
+{
+    _padic_lazy_node_struct * t;
+
+    t = _padic_lazy_node_new(PADIC_LAZY_INV, op2->node, NULL);
+
+    _padic_lazy_set_node(rop,
+        _padic_lazy_node_new(PADIC_LAZY_MUL, op1->node, t));
+
+    _padic_lazy_node_release(t);
+}
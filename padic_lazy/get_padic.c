@@ -0,0 +1,20 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "padic_lazy.h"
+
+void padic_lazy_get_padic(padic_t rop, const padic_lazy_t op,
+                          const padic_ctx_t ctx)
+{
+    _padic_lazy_node_refine(op->node, padic_prec(rop), ctx);
+
+    padic_set(rop, &(op->node->val), ctx);
+}
@@ -0,0 +1,18 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "padic_lazy.h"
+
+void padic_lazy_inv(padic_lazy_t rop, const padic_lazy_t op)
+{
+    _padic_lazy_set_node(rop,
+        _padic_lazy_node_new(PADIC_LAZY_INV, op->node, NULL));
+}
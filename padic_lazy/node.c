@@ -0,0 +1,62 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "padic_lazy.h"
+
+_padic_lazy_node_struct * _padic_lazy_node_new(padic_lazy_op_t op,
+          _padic_lazy_node_struct * arg0, _padic_lazy_node_struct * arg1)
+{
+    _padic_lazy_node_struct * node;
+
+    node = flint_malloc(sizeof(_padic_lazy_node_struct));
+
+    node->op  = op;
+    node->ref = 1;
+    node->arg[0] = arg0;
+    node->arg[1] = arg1;
+    node->e = 0;
+    node->func = NULL;
+    node->data = NULL;
+
+    fmpq_init(&node->c);
+    padic_init2(&node->val, PADIC_LAZY_NO_PREC);
+    padic_init2(&node->aux, PADIC_LAZY_NO_PREC);
+
+    if (arg0 != NULL)
+        arg0->ref++;
+    if (arg1 != NULL)
+        arg1->ref++;
+
+    return node;
+}
+
+void _padic_lazy_node_release(_padic_lazy_node_struct * node)
+{
+    if (--node->ref > 0)
+        return;
+
+    if (node->arg[0] != NULL)
+        _padic_lazy_node_release(node->arg[0]);
+    if (node->arg[1] != NULL)
+        _padic_lazy_node_release(node->arg[1]);
+
+    fmpq_clear(&node->c);
+    padic_clear(&node->val);
+    padic_clear(&node->aux);
+
+    flint_free(node);
+}
+
+void _padic_lazy_set_node(padic_lazy_t rop, _padic_lazy_node_struct * node)
+{
+    _padic_lazy_node_release(rop->node);
+    rop->node = node;
+}
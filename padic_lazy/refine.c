@@ -0,0 +1,243 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "padic_lazy.h"
+
+/*
+    Returns a lower bound for the valuation of the node, which must
+    already have been refined. This is exact unless the approximation is 
+    zero, in which case it is its precision.
+ */
+static slong _padic_lazy_node_val_bound(const _padic_lazy_node_struct * node)
+{
+    const padic_struct * x = &(node->val);
+
+    return padic_is_zero(x) ? padic_prec(x) : padic_val(x);
+}
+
+/*
+    Refines the node until its approximation is nonzero and returns the
+    valuation. Raises an exception if the node is zero modulo
+    p^(N + PADIC_LAZY_ZERO_PREC).
+ */
+static slong _padic_lazy_node_val_nonzero(_padic_lazy_node_struct * node,
+                                  slong N, const padic_ctx_t ctx)
+{
+    const padic_struct * x = &(node->val);
+    slong prec = N;
+
+    _padic_lazy_node_refine(node, prec, ctx);
+
+    while (padic_is_zero(x))
+    {
+        if (padic_prec(x) >= N + PADIC_LAZY_ZERO_PREC)
+        {
+            flint_printf("Exception (padic_lazy_inv).  Operand is zero "
+                         "modulo p^%wd.\n", padic_prec(x));
+            flint_abort();
+        }
+
+        prec = padic_prec(x) + FLINT_MAX(FLINT_ABS(padic_prec(x)), 16);
+        prec = FLINT_MIN(prec, N + PADIC_LAZY_ZERO_PREC);
+
+        _padic_lazy_node_refine(node, prec, ctx);
+    }
+
+    return padic_val(x);
+}
+
+/*
+    Sets the unit of the approximation of an inversion node, given that
+    the operand has valuation v and that the unit of its inverse is 
+    required modulo p^n, where n >= 1. The inverse computed previously, 
+    if any, is lifted by Newton iteration rather than recomputed.
+ */
+static void _padic_lazy_inv_unit(_padic_lazy_node_struct * node, slong n,
+                                 const padic_ctx_t ctx)
+{
+    const fmpz * u = padic_unit(&(node->arg[0]->val));
+    fmpz * w = padic_unit(&(node->aux));
+    slong k = padic_prec(&(node->aux));
+    fmpz_t pow, t;
+    int alloc;
+
+    if (k >= n)
+    {
+        alloc = _padic_ctx_pow_ui(pow, n, ctx);
+        fmpz_mod(padic_unit(&(node->val)), w, pow);
+        if (alloc)
+            fmpz_clear(pow);
+
+        return;
+    }
+
+    if (k < 1)
+    {
+        _padic_inv(w, u, ctx->p, n);
+    }
+    else
+    {
+        fmpz_init(t);
+
+        while (k < n)
+        {
+            k = FLINT_MIN(2*k, n);
+
+            alloc = _padic_ctx_pow_ui(pow, k, ctx);
+
+            /* w := w + w (1 - u w) mod p^k */
+            fmpz_mul(t, u, w);
+            fmpz_sub_ui(t, t, 1);
+            fmpz_neg(t, t);
+            fmpz_mod(t, t, pow);
+            fmpz_mul(t, t, w);
+            fmpz_add(w, w, t);
+            fmpz_mod(w, w, pow);
+
+            if (alloc)
+                fmpz_clear(pow);
+        }
+
+        fmpz_clear(t);
+    }
+
+    padic_prec(&(node->aux)) = n;
+    fmpz_set(padic_unit(&(node->val)), w);
+}
+
+static void _padic_lazy_node_eval(_padic_lazy_node_struct * node, slong N,
+                                  const padic_ctx_t ctx)
+{
+    _padic_lazy_node_struct * a = node->arg[0], * b = node->arg[1];
+    padic_struct * x = &(node->val);
+    slong va, vb;
+
+    switch (node->op)
+    {
+        case PADIC_LAZY_CONST:
+            padic_prec(x) = N;
+            padic_set_fmpq(x, &node->c, ctx);
+            break;
+
+        case PADIC_LAZY_FUNC:
+            padic_prec(x) = N;
+            node->func(x, node->data, ctx);
+            break;
+
+        case PADIC_LAZY_ADD:
+            _padic_lazy_node_refine(a, N, ctx);
+            _padic_lazy_node_refine(b, N, ctx);
+            padic_prec(x) = N;
+            padic_add(x, &(a->val), &(b->val), ctx);
+            break;
+
+        case PADIC_LAZY_SUB:
+            _padic_lazy_node_refine(a, N, ctx);
+            _padic_lazy_node_refine(b, N, ctx);
+            padic_prec(x) = N;
+            padic_sub(x, &(a->val), &(b->val), ctx);
+            break;
+
+        case PADIC_LAZY_NEG:
+            _padic_lazy_node_refine(a, N, ctx);
+            padic_prec(x) = N;
+            padic_neg(x, &(a->val), ctx);
+            break;
+
+        case PADIC_LAZY_SHIFT:
+            _padic_lazy_node_refine(a, N - node->e, ctx);
+            padic_prec(x) = N;
+            padic_shift(x, &(a->val), node->e, ctx);
+            break;
+
+        case PADIC_LAZY_MUL:
+            /*
+                Each operand is needed to precision N minus the valuation
+                of the other, for which a lower bound is obtained from
+                an approximation to precision N.
+             */
+            _padic_lazy_node_refine(a, N, ctx);
+            _padic_lazy_node_refine(b, N, ctx);
+            va = _padic_lazy_node_val_bound(a);
+            vb = _padic_lazy_node_val_bound(b);
+            _padic_lazy_node_refine(a, N - vb, ctx);
+            _padic_lazy_node_refine(b, N - va, ctx);
+            padic_prec(x) = N;
+            padic_mul(x, &(a->val), &(b->val), ctx);
+            break;
+
+        case PADIC_LAZY_INV:
+            /*
+                If the operand is p^v u then the unit of its inverse is 
+                needed modulo p^(N + v), so the operand is needed to 
+                precision N + 2v.
+             */
+            va = _padic_lazy_node_val_nonzero(a, N, ctx);
+            padic_prec(x) = N;
+            if (N + va <= 0)
+            {
+                padic_zero(x);
+            }
+            else
+            {
+                _padic_lazy_node_refine(a, N + 2*va, ctx);
+                _padic_lazy_inv_unit(node, N + va, ctx);
+                padic_val(x) = -va;
+            }
+            break;
+
+        case PADIC_LAZY_EXP:
+            /* precision 2 suffices to decide convergence */
+            _padic_lazy_node_refine(a, FLINT_MAX(N, 2), ctx);
+            padic_prec(x) = N;
+            if (!padic_exp(x, &(a->val), ctx))
+            {
+                flint_printf("Exception (padic_lazy_exp).  Series does "
+                             "not converge.\n");
+                flint_abort();
+            }
+            break;
+
+        case PADIC_LAZY_LOG:
+            _padic_lazy_node_refine(a, FLINT_MAX(N, 2), ctx);
+            padic_prec(x) = N;
+            if (!padic_log(x, &(a->val), ctx))
+            {
+                flint_printf("Exception (padic_lazy_log).  Series does "
+                             "not converge.\n");
+                flint_abort();
+            }
+            break;
+
+        default:
+            flint_printf("Exception (padic_lazy).  Unknown operation.\n");
+            flint_abort();
+    }
+}
+
+void _padic_lazy_node_refine(_padic_lazy_node_struct * node, slong N,
+                             const padic_ctx_t ctx)
+{
+    slong prev = padic_prec(&(node->val));
+
+    if (prev >= N)
+        return;
+
+    /*
+        When precision is requested a little at a time, at least double
+        it, so that the total cost is within a constant factor of the
+        cost at the final precision.
+     */
+    if (node->op != PADIC_LAZY_CONST && prev > 0)
+        N = FLINT_MAX(N, 2*prev);
+
+    _padic_lazy_node_eval(node, N, ctx);
+}
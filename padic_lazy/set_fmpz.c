@@ -0,0 +1,22 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "padic_lazy.h"
+
+void padic_lazy_set_fmpz(padic_lazy_t rop, const fmpz_t op)
+{
+    _padic_lazy_node_struct * node;
+
+    node = _padic_lazy_node_new(PADIC_LAZY_CONST, NULL, NULL);
+    fmpz_set(fmpq_numref(&node->c), op);
+
+    _padic_lazy_set_node(rop, node);
+}
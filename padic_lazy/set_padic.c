@@ -0,0 +1,23 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "padic_lazy.h"
+
+void padic_lazy_set_padic(padic_lazy_t rop, const padic_t op,
+                          const padic_ctx_t ctx)
+{
+    _padic_lazy_node_struct * node;
+
+    node = _padic_lazy_node_new(PADIC_LAZY_CONST, NULL, NULL);
+    padic_get_fmpq(&node->c, op, ctx);
+
+    _padic_lazy_set_node(rop, node);
+}
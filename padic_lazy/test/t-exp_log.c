@@ -0,0 +1,107 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "ulong_extras.h"
+#include "padic_lazy.h"
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("exp_log....");
+    fflush(stdout);
+
+    /* Check exp and log against padic at increasing precision */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong N;
+        padic_ctx_t ctx;
+        padic_t a, c, d;
+        padic_lazy_t x, z;
+        int log;
+
+        fmpz_init_set_ui(p, n_randtest_prime(state, 0));
+        N = n_randint(state, PADIC_TEST_PREC_MAX) + 1;
+        padic_ctx_init(ctx, p, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), PADIC_SERIES);
+
+        padic_init2(a, N + n_randint(state, 50));
+        padic_init2(c, N);
+        padic_init2(d, N);
+
+        padic_lazy_init(x);
+        padic_lazy_init(z);
+
+        log = n_randint(state, 2);
+
+        /* take p^2 b or 1 + p^2 b, for which the series converges */
+        padic_randtest_int(a, state, ctx);
+        padic_shift(a, a, 2, ctx);
+        if (log)
+        {
+            padic_one(c);
+            padic_add(a, a, c, ctx);
+        }
+
+        padic_lazy_set_padic(x, a, ctx);
+        if (log)
+            padic_lazy_log(z, x);
+        else
+            padic_lazy_exp(z, x);
+
+        for (j = 0; j < 3; j++)
+        {
+            padic_prec(c) = N;
+            padic_prec(d) = N;
+
+            if (log)
+                padic_log(d, a, ctx);
+            else
+                padic_exp(d, a, ctx);
+
+            padic_lazy_get_padic(c, z, ctx);
+
+            result = (padic_equal(c, d));
+            if (!result)
+            {
+                flint_printf("FAIL:\n\n");
+                flint_printf("N = %wd, log = %d\n", N, log);
+                flint_printf("a = "), padic_print(a, ctx), flint_printf("\n");
+                flint_printf("c = "), padic_print(c, ctx), flint_printf("\n");
+                flint_printf("d = "), padic_print(d, ctx), flint_printf("\n");
+                abort();
+            }
+
+            N += n_randint(state, 20);
+        }
+
+        padic_clear(a);
+        padic_clear(c);
+        padic_clear(d);
+
+        padic_lazy_clear(x);
+        padic_lazy_clear(z);
+
+        fmpz_clear(p);
+        padic_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,158 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "ulong_extras.h"
+#include "padic_lazy.h"
+
+#define NUM_LEAVES 4
+#define NUM_OPS 12
+
+static void
+_set_leaf(padic_t rop, void * data, const padic_ctx_t ctx)
+{
+    padic_set(rop, (padic_struct *) data, ctx);
+}
+
+/*
+    Builds an expression from the leaves using the operations in ops,
+    each reading two earlier entries of the list.
+ */
+static void
+_build(padic_lazy_t res, const padic_struct * leaves, const slong * ops,
+       const padic_ctx_t ctx)
+{
+    padic_lazy_struct t[NUM_LEAVES + NUM_OPS];
+    slong i, n = NUM_LEAVES;
+
+    for (i = 0; i < NUM_LEAVES + NUM_OPS; i++)
+        padic_lazy_init(t + i);
+
+    padic_lazy_set_padic(t + 0, leaves + 0, ctx);
+    padic_lazy_set_padic(t + 1, leaves + 1, ctx);
+    padic_lazy_set_func(t + 2, _set_leaf, (void *) (leaves + 2));
+    padic_lazy_set_si(t + 3, -3);
+
+    for (i = 0; i < NUM_OPS; i++, n++)
+    {
+        slong j = ops[3*i + 1] % n, k = ops[3*i + 2] % n;
+
+        switch (ops[3*i])
+        {
+            case 0:
+                padic_lazy_add(t + n, t + j, t + k);
+                break;
+            case 1:
+                padic_lazy_sub(t + n, t + j, t + k);
+                break;
+            case 2:
+                padic_lazy_mul(t + n, t + j, t + k);
+                break;
+            default:
+                padic_lazy_shift(t + n, t + j, k - 2);
+        }
+    }
+
+    padic_lazy_set(res, t + n - 1);
+
+    for (i = 0; i < NUM_LEAVES + NUM_OPS; i++)
+        padic_lazy_clear(t + i);
+}
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("get_padic....");
+    fflush(stdout);
+
+    /*
+        Check that an expression refined through increasing precisions 
+        agrees with the same expression evaluated once at each precision
+     */
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong N, ops[3*NUM_OPS];
+        padic_ctx_t ctx;
+        padic_struct leaves[3];
+        padic_t c, d;
+        padic_lazy_t x, y;
+
+        fmpz_init_set_ui(p, n_randtest_prime(state, 0));
+        N = n_randint(state, PADIC_TEST_PREC_MAX - PADIC_TEST_PREC_MIN) 
+            + PADIC_TEST_PREC_MIN;
+        padic_ctx_init(ctx, p, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), PADIC_SERIES);
+
+        for (j = 0; j < 3; j++)
+        {
+            padic_init2(leaves + j, N + 200);
+            padic_randtest(leaves + j, state, ctx);
+        }
+
+        for (j = 0; j < NUM_OPS; j++)
+        {
+            ops[3*j + 0] = n_randint(state, 4);
+            ops[3*j + 1] = n_randint(state, NUM_LEAVES + j);
+            ops[3*j + 2] = n_randint(state, NUM_LEAVES + j);
+        }
+
+        padic_lazy_init(x);
+        padic_lazy_init(y);
+
+        _build(x, leaves, ops, ctx);
+
+        for (j = 0; j < 5; j++)
+        {
+            padic_init2(c, N);
+            padic_init2(d, N);
+
+            _build(y, leaves, ops, ctx);
+
+            padic_lazy_get_padic(c, x, ctx);
+            padic_lazy_get_padic(d, y, ctx);
+
+            result = (padic_equal(c, d) && padic_lazy_prec(x) >= N);
+            if (!result)
+            {
+                flint_printf("FAIL:\n\n");
+                flint_printf("N = %wd\n", N);
+                flint_printf("c = "), padic_print(c, ctx), flint_printf("\n");
+                flint_printf("d = "), padic_print(d, ctx), flint_printf("\n");
+                abort();
+            }
+
+            padic_clear(c);
+            padic_clear(d);
+
+            N += n_randint(state, 10);
+        }
+
+        for (j = 0; j < 3; j++)
+            padic_clear(leaves + j);
+
+        padic_lazy_clear(x);
+        padic_lazy_clear(y);
+
+        fmpz_clear(p);
+        padic_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+#include "padic_lazy.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul....");
+    fflush(stdout);
+
+    /* Check mul and shift against padic, with aliasing */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong N, v;
+        padic_ctx_t ctx;
+        padic_t a, b, c, d;
+        padic_lazy_t x, y, z;
+
+        fmpz_init_set_ui(p, n_randtest_prime(state, 0));
+        N = n_randint(state, PADIC_TEST_PREC_MAX - PADIC_TEST_PREC_MIN) 
+            + PADIC_TEST_PREC_MIN;
+        padic_ctx_init(ctx, p, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), PADIC_SERIES);
+
+        padic_init2(a, N + n_randint(state, 20));
+        padic_init2(b, N + n_randint(state, 20));
+        padic_init2(c, N);
+        padic_init2(d, N);
+
+        padic_lazy_init(x);
+        padic_lazy_init(y);
+        padic_lazy_init(z);
+
+        padic_randtest(a, state, ctx);
+        padic_randtest(b, state, ctx);
+
+        padic_lazy_set_padic(x, a, ctx);
+        padic_lazy_set_padic(y, b, ctx);
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                padic_lazy_mul(z, x, y);
+                padic_mul(d, a, b, ctx);
+                break;
+            case 1:
+                padic_lazy_mul(x, x, y);
+                padic_lazy_swap(x, z);
+                padic_mul(d, a, b, ctx);
+                break;
+            case 2:
+                padic_lazy_mul(z, x, x);
+                padic_mul(d, a, a, ctx);
+                break;
+            default:
+                v = z_randint(state, 20);
+                padic_lazy_shift(z, x, v);
+                padic_shift(d, a, v, ctx);
+        }
+
+        padic_lazy_get_padic(c, z, ctx);
+
+        result = (padic_equal(c, d) && padic_lazy_prec(z) >= N);
+        if (!result)
+        {
+            flint_printf("FAIL:\n\n");
+            flint_printf("a = "), padic_print(a, ctx), flint_printf("\n");
+            flint_printf("b = "), padic_print(b, ctx), flint_printf("\n");
+            flint_printf("c = "), padic_print(c, ctx), flint_printf("\n");
+            flint_printf("d = "), padic_print(d, ctx), flint_printf("\n");
+            abort();
+        }
+
+        padic_clear(a);
+        padic_clear(b);
+        padic_clear(c);
+        padic_clear(d);
+
+        padic_lazy_clear(x);
+        padic_lazy_clear(y);
+        padic_lazy_clear(z);
+
+        fmpz_clear(p);
+        padic_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,24 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "padic_lazy.h"
+
+slong padic_lazy_val(const padic_lazy_t op, slong N, const padic_ctx_t ctx)
+{
+    const padic_struct * x = &(op->node->val);
+
+    _padic_lazy_node_refine(op->node, N, ctx);
+
+    if (padic_is_zero(x) || padic_val(x) >= N)
+        return N;
+    else
+        return padic_val(x);
+}
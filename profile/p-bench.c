@@ -0,0 +1,813 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+/*
+   Benchmark runner. Each benchmark in the table below is run for every
+   combination of its sizes and bit sizes and of the requested thread
+   counts, and the timings are reported as text, CSV or JSON. A CSV file
+   written by an earlier run can be given as a baseline, in which case
+   the median times are compared and regressions are reported.
+
+   Run with --help for the options. To add a benchmark, write a target
+   in the style of prof_repeat (see profiler.h) taking a bench_params_t,
+   and add it to the table.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gmp.h>
+#include "flint.h"
+#include "profiler.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_factor.h"
+#include "fmpz_poly.h"
+#include "fmpz_mat.h"
+#include "nmod_poly.h"
+#include "nmod_poly_factor.h"
+#include "nmod_mat.h"
+#include "arith.h"
+
+#define BENCH_MAX_PARAMS 8
+#define BENCH_NUM_INPUTS 64
+#define BENCH_NAME_LEN 64
+
+typedef struct
+{
+    slong size;
+    slong bits;
+} bench_params_t;
+
+typedef struct
+{
+    const char * name;
+    profile_target_t target;
+    slong sizes[BENCH_MAX_PARAMS];   /* zero terminated, empty if unused */
+    slong bits[BENCH_MAX_PARAMS];
+} bench_struct;
+
+static flint_rand_t bench_state;
+
+/******************************************************************************
+
+    Benchmarks
+
+******************************************************************************/
+
+/* the randtest functions produce sparse and short inputs, we want dense ones */
+
+static void
+bench_fmpz_poly_rand(fmpz_poly_t a, slong len, slong bits)
+{
+    slong i;
+
+    fmpz_poly_fit_length(a, len);
+    for (i = 0; i < len; i++)
+        fmpz_randbits(a->coeffs + i, bench_state, bits);
+    _fmpz_poly_set_length(a, len);
+    _fmpz_poly_normalise(a);
+}
+
+static void
+bench_nmod_poly_rand(nmod_poly_t a, slong len)
+{
+    slong i;
+
+    nmod_poly_fit_length(a, len);
+    for (i = 0; i < len; i++)
+        a->coeffs[i] = n_randint(bench_state, a->mod.n);
+    a->length = len;
+    _nmod_poly_normalise(a);
+}
+
+/* word inputs have between 2 and FLINT_BITS bits */
+static slong
+bench_word_bits(slong bits)
+{
+    return FLINT_MAX(2, FLINT_MIN(bits, FLINT_BITS));
+}
+
+static mp_limb_t
+bench_modulus(slong bits)
+{
+    return n_randprime(bench_state, bench_word_bits(bits), 0);
+}
+
+static void
+sample_fmpz_mul(void * arg, ulong count)
+{
+    bench_params_t * params = (bench_params_t *) arg;
+    fmpz_t a, b, c;
+    ulong i;
+
+    fmpz_init(a);
+    fmpz_init(b);
+    fmpz_init(c);
+
+    fmpz_randbits(a, bench_state, params->bits);
+    fmpz_randbits(b, bench_state, params->bits);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fmpz_mul(c, a, b);
+    prof_stop();
+
+    fmpz_clear(a);
+    fmpz_clear(b);
+    fmpz_clear(c);
+}
+
+static void
+sample_fmpz_poly_mul(void * arg, ulong count)
+{
+    bench_params_t * params = (bench_params_t *) arg;
+    fmpz_poly_t a, b, c;
+    ulong i;
+
+    fmpz_poly_init(a);
+    fmpz_poly_init(b);
+    fmpz_poly_init(c);
+
+    bench_fmpz_poly_rand(a, params->size, params->bits);
+    bench_fmpz_poly_rand(b, params->size, params->bits);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fmpz_poly_mul(c, a, b);
+    prof_stop();
+
+    fmpz_poly_clear(a);
+    fmpz_poly_clear(b);
+    fmpz_poly_clear(c);
+}
+
+static void
+sample_fmpz_poly_gcd(void * arg, ulong count)
+{
+    bench_params_t * params = (bench_params_t *) arg;
+    fmpz_poly_t a, b, g, c;
+    ulong i;
+
+    fmpz_poly_init(a);
+    fmpz_poly_init(b);
+    fmpz_poly_init(g);
+    fmpz_poly_init(c);
+
+    /* inputs with a common factor of half their length */
+    bench_fmpz_poly_rand(a, params->size / 2 + 1, params->bits);
+    bench_fmpz_poly_rand(b, params->size / 2 + 1, params->bits);
+    bench_fmpz_poly_rand(g, params->size / 2 + 1, params->bits);
+    fmpz_poly_mul(a, a, g);
+    fmpz_poly_mul(b, b, g);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fmpz_poly_gcd(c, a, b);
+    prof_stop();
+
+    fmpz_poly_clear(a);
+    fmpz_poly_clear(b);
+    fmpz_poly_clear(g);
+    fmpz_poly_clear(c);
+}
+
+static void
+sample_nmod_poly_mul(void * arg, ulong count)
+{
+    bench_params_t * params = (bench_params_t *) arg;
+    nmod_poly_t a, b, c;
+    mp_limb_t n;
+    ulong i;
+
+    n = bench_modulus(params->bits);
+
+    nmod_poly_init(a, n);
+    nmod_poly_init(b, n);
+    nmod_poly_init(c, n);
+
+    bench_nmod_poly_rand(a, params->size);
+    bench_nmod_poly_rand(b, params->size);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        nmod_poly_mul(c, a, b);
+    prof_stop();
+
+    nmod_poly_clear(a);
+    nmod_poly_clear(b);
+    nmod_poly_clear(c);
+}
+
+static void
+sample_nmod_poly_factor(void * arg, ulong count)
+{
+    bench_params_t * params = (bench_params_t *) arg;
+    nmod_poly_factor_t fac;
+    nmod_poly_t a;
+    mp_limb_t n;
+    ulong i;
+
+    n = bench_modulus(params->bits);
+
+    nmod_poly_init(a, n);
+    bench_nmod_poly_rand(a, params->size);
+    nmod_poly_set_coeff_ui(a, params->size, 1);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+    {
+        nmod_poly_factor_init(fac);
+        nmod_poly_factor(fac, a);
+        nmod_poly_factor_clear(fac);
+    }
+    prof_stop();
+
+    nmod_poly_clear(a);
+}
+
+static void
+sample_fmpz_mat_mul(void * arg, ulong count)
+{
+    bench_params_t * params = (bench_params_t *) arg;
+    fmpz_mat_t A, B, C;
+    slong n = params->size;
+    ulong i;
+
+    fmpz_mat_init(A, n, n);
+    fmpz_mat_init(B, n, n);
+    fmpz_mat_init(C, n, n);
+
+    fmpz_mat_randbits(A, bench_state, params->bits);
+    fmpz_mat_randbits(B, bench_state, params->bits);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        fmpz_mat_mul(C, A, B);
+    prof_stop();
+
+    fmpz_mat_clear(A);
+    fmpz_mat_clear(B);
+    fmpz_mat_clear(C);
+}
+
+static void
+sample_nmod_mat_mul(void * arg, ulong count)
+{
+    bench_params_t * params = (bench_params_t *) arg;
+    nmod_mat_t A, B, C;
+    slong n = params->size;
+    mp_limb_t p;
+    ulong i;
+
+    p = bench_modulus(params->bits);
+
+    nmod_mat_init(A, n, n, p);
+    nmod_mat_init(B, n, n, p);
+    nmod_mat_init(C, n, n, p);
+
+    nmod_mat_randfull(A, bench_state);
+    nmod_mat_randfull(B, bench_state);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        nmod_mat_mul(C, A, B);
+    prof_stop();
+
+    nmod_mat_clear(A);
+    nmod_mat_clear(B);
+    nmod_mat_clear(C);
+}
+
+static void
+sample_n_factor(void * arg, ulong count)
+{
+    bench_params_t * params = (bench_params_t *) arg;
+    mp_limb_t inputs[BENCH_NUM_INPUTS];
+    n_factor_t fac;
+    ulong i;
+
+    for (i = 0; i < BENCH_NUM_INPUTS; i++)
+        inputs[i] = n_randbits(bench_state, bench_word_bits(params->bits));
+
+    prof_start();
+    for (i = 0; i < count; i++)
+    {
+        n_factor_init(&fac);
+        n_factor(&fac, inputs[i % BENCH_NUM_INPUTS], 0);
+    }
+    prof_stop();
+}
+
+static void
+sample_n_is_prime(void * arg, ulong count)
+{
+    bench_params_t * params = (bench_params_t *) arg;
+    mp_limb_t inputs[BENCH_NUM_INPUTS];
+    slong bits = bench_word_bits(params->bits);
+    ulong i, r = 0;
+
+    /* half of the inputs are prime */
+    for (i = 0; i < BENCH_NUM_INPUTS; i++)
+        inputs[i] = (i % 2) ? n_randbits(bench_state, bits) | 1
+                            : n_randprime(bench_state, bits, 0);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        r += n_is_prime(inputs[i % BENCH_NUM_INPUTS]);
+    prof_stop();
+
+    if (r == UWORD_MAX)
+        flint_printf("\r");
+}
+
+static void
+sample_fmpz_factor(void * arg, ulong count)
+{
+    bench_params_t * params = (bench_params_t *) arg;
+    fmpz_factor_t fac;
+    fmpz_t p, q, n;
+    ulong i;
+
+    fmpz_init(p);
+    fmpz_init(q);
+    fmpz_init(n);
+
+    /* a product of two primes of half the size */
+    fmpz_randprime(p, bench_state, params->bits / 2, 0);
+    fmpz_randprime(q, bench_state, params->bits - params->bits / 2, 0);
+    fmpz_mul(n, p, q);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+    {
+        fmpz_factor_init(fac);
+        fmpz_factor(fac, n);
+        fmpz_factor_clear(fac);
+    }
+    prof_stop();
+
+    fmpz_clear(p);
+    fmpz_clear(q);
+    fmpz_clear(n);
+}
+
+static void
+sample_bernoulli_number_vec(void * arg, ulong count)
+{
+    bench_params_t * params = (bench_params_t *) arg;
+    fmpz * num, * den;
+    ulong i;
+
+    num = _fmpz_vec_init(params->size);
+    den = _fmpz_vec_init(params->size);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        _arith_bernoulli_number_vec_uncached(num, den, params->size);
+    prof_stop();
+
+    _fmpz_vec_clear(num, params->size);
+    _fmpz_vec_clear(den, params->size);
+}
+
+static void
+sample_number_of_partitions(void * arg, ulong count)
+{
+    bench_params_t * params = (bench_params_t *) arg;
+    fmpz_t p;
+    ulong i;
+
+    fmpz_init(p);
+
+    prof_start();
+    for (i = 0; i < count; i++)
+        arith_number_of_partitions(p, params->size);
+    prof_stop();
+
+    fmpz_clear(p);
+}
+
+static const bench_struct benchmarks[] =
+{
+    {"fmpz_mul", sample_fmpz_mul,
+        {0}, {1000, 10000, 100000, 1000000, 0}},
+    {"fmpz_poly_mul", sample_fmpz_poly_mul,
+        {16, 256, 4096, 0}, {64, 1024, 0}},
+    {"fmpz_poly_gcd", sample_fmpz_poly_gcd,
+        {64, 512, 0}, {64, 0}},
+    {"nmod_poly_mul", sample_nmod_poly_mul,
+        {16, 256, 4096, 65536, 0}, {FLINT_BITS - 1, 0}},
+    {"nmod_poly_factor", sample_nmod_poly_factor,
+        {16, 64, 256, 0}, {FLINT_BITS - 1, 0}},
+    {"fmpz_mat_mul", sample_fmpz_mat_mul,
+        {16, 64, 256, 0}, {10, 100, 1000, 0}},
+    {"nmod_mat_mul", sample_nmod_mat_mul,
+        {64, 256, 1024, 0}, {FLINT_BITS - 1, 0}},
+    {"n_factor", sample_n_factor,
+        {0}, {32, 48, FLINT_BITS, 0}},
+    {"n_is_prime", sample_n_is_prime,
+        {0}, {32, FLINT_BITS, 0}},
+    {"fmpz_factor", sample_fmpz_factor,
+        {0}, {64, 100, 0}},
+    {"bernoulli_number_vec", sample_bernoulli_number_vec,
+        {1000, 5000, 0}, {0}},
+    {"number_of_partitions", sample_number_of_partitions,
+        {1000000, 100000000, 0}, {0}},
+};
+
+#define NUM_BENCHMARKS (sizeof(benchmarks) / sizeof(bench_struct))
+
+/******************************************************************************
+
+    Baseline
+
+******************************************************************************/
+
+typedef struct
+{
+    char name[BENCH_NAME_LEN];
+    slong size;
+    slong bits;
+    slong threads;
+    double median;
+} baseline_entry_t;
+
+/* Reads the median times from a CSV file written with --format csv */
+static slong
+baseline_read(baseline_entry_t ** entries, const char * filename)
+{
+    char line[1024];
+    FILE * file;
+    slong num = 0, alloc = 0;
+
+    *entries = NULL;
+
+    if ((file = fopen(filename, "r")) == NULL)
+    {
+        flint_printf("Exception (p-bench). Could not open %s.\n", filename);
+        flint_abort();
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char * field[8];
+        char * s = line;
+        slong i;
+
+        /* skip the header and anything malformed */
+        if (strncmp(line, "name,", 5) == 0)
+            continue;
+
+        for (i = 0; i < 8 && s != NULL; i++)
+        {
+            field[i] = s;
+            s = strchr(s, ',');
+            if (s != NULL)
+                *s++ = '\0';
+        }
+
+        if (i < 8 || strlen(field[0]) >= BENCH_NAME_LEN)
+            continue;
+
+        if (num == alloc)
+        {
+            alloc = FLINT_MAX(16, 2 * alloc);
+            *entries = flint_realloc(*entries, alloc * sizeof(baseline_entry_t));
+        }
+
+        strcpy((*entries)[num].name, field[0]);
+        (*entries)[num].size = strtol(field[1], NULL, 10);
+        (*entries)[num].bits = strtol(field[2], NULL, 10);
+        (*entries)[num].threads = strtol(field[3], NULL, 10);
+        (*entries)[num].median = strtod(field[7], NULL);
+        num++;
+    }
+
+    fclose(file);
+
+    return num;
+}
+
+static double
+baseline_lookup(const baseline_entry_t * entries, slong num,
+                     const char * name, slong size, slong bits, slong threads)
+{
+    slong i;
+
+    for (i = 0; i < num; i++)
+    {
+        if (strcmp(entries[i].name, name) == 0 && entries[i].size == size
+                && entries[i].bits == bits && entries[i].threads == threads)
+            return entries[i].median;
+    }
+
+    return 0.0;
+}
+
+/******************************************************************************
+
+    Output
+
+******************************************************************************/
+
+enum { FORMAT_TEXT, FORMAT_CSV, FORMAT_JSON };
+
+static void
+print_header(FILE * out, int format, int have_baseline)
+{
+    if (format == FORMAT_TEXT)
+    {
+        fprintf(out, "%-22s %10s %8s %7s %12s %12s %10s %14s",
+            "name", "size", "bits", "threads", "median(us)", "min(us)",
+            "stddev(us)", "cycles");
+        if (have_baseline)
+            fprintf(out, " %8s", "ratio");
+        fprintf(out, "\n");
+    }
+    else if (format == FORMAT_CSV)
+    {
+        flint_fprintf(out, "name,size,bits,threads,samples,count,min_us,"
+            "median_us,mean_us,stddev_us,cycles");
+        if (have_baseline)
+            flint_fprintf(out, ",baseline_median_us,ratio");
+        flint_fprintf(out, "\n");
+    }
+    else
+    {
+        flint_fprintf(out, "{\n  \"flint_version\": \"%s\",\n"
+            "  \"clockspeed\": %.0f,\n  \"results\": [", FLINT_VERSION,
+            FLINT_CLOCKSPEED);
+    }
+}
+
+static void
+print_result(FILE * out, int format, int first, const char * name,
+             slong size, slong bits, slong threads, const prof_stats_t stats,
+             double base)
+{
+    double ratio = base > 0.0 ? stats->median / base : 0.0;
+
+    if (format == FORMAT_TEXT)
+    {
+        /* flint_fprintf does not support field widths for words */
+        fprintf(out, "%-22s " WORD_WIDTH_FMT "d " WORD_WIDTH_FMT "d "
+            WORD_WIDTH_FMT "d %12.3f %12.3f %10.3f %14.0f", name, 10, size,
+            8, bits, 7, threads, stats->median, stats->min, stats->stddev,
+            stats->cycles);
+        if (base > 0.0)
+            fprintf(out, " %8.3f", ratio);
+        fprintf(out, "\n");
+    }
+    else if (format == FORMAT_CSV)
+    {
+        flint_fprintf(out, "%s,%wd,%wd,%wd,%wd,%wu,%.6g,%.6g,%.6g,%.6g,%.6g",
+            name, size, bits, threads, stats->samples, stats->count,
+            stats->min, stats->median, stats->mean, stats->stddev,
+            stats->cycles);
+        if (base > 0.0)
+            flint_fprintf(out, ",%.6g,%.4f", base, ratio);
+        flint_fprintf(out, "\n");
+    }
+    else
+    {
+        flint_fprintf(out, "%s\n    {\"name\": \"%s\", \"size\": %wd, "
+            "\"bits\": %wd, \"threads\": %wd, \"samples\": %wd, "
+            "\"count\": %wu, \"min_us\": %.6g, \"median_us\": %.6g, "
+            "\"mean_us\": %.6g, \"stddev_us\": %.6g, \"cycles\": %.6g",
+            first ? "" : ",", name, size, bits, threads, stats->samples,
+            stats->count, stats->min, stats->median, stats->mean,
+            stats->stddev, stats->cycles);
+        if (base > 0.0)
+            flint_fprintf(out, ", \"baseline_median_us\": %.6g, "
+                "\"ratio\": %.4f", base, ratio);
+        flint_fprintf(out, "}");
+    }
+
+    fflush(out);
+}
+
+static void
+print_footer(FILE * out, int format)
+{
+    if (format == FORMAT_JSON)
+        flint_fprintf(out, "\n  ]\n}\n");
+}
+
+/******************************************************************************
+
+    Command line
+
+******************************************************************************/
+
+/* Parses a comma separated list of positive integers, zero terminated */
+static void
+parse_list(slong * list, const char * str)
+{
+    slong i = 0;
+    char * end;
+
+    while (i < BENCH_MAX_PARAMS - 1 && *str != '\0')
+    {
+        list[i] = strtol(str, &end, 10);
+
+        if (end == str || list[i] <= 0)
+        {
+            flint_printf("Exception (p-bench). Invalid list %s.\n", str);
+            flint_abort();
+        }
+
+        i++;
+        str = (*end == ',') ? end + 1 : end;
+    }
+
+    list[i] = 0;
+}
+
+static void
+usage(void)
+{
+    flint_printf(
+    "usage: p-bench [options]\n"
+    "  --list              list the benchmarks and their parameters\n"
+    "  --filter STR        only run benchmarks whose name contains STR\n"
+    "  --sizes N,N,...     override the sizes of the benchmarks having sizes\n"
+    "  --bits N,N,...      override the bit sizes of the benchmarks having them\n"
+    "  --threads N,N,...   thread counts to sweep (default 1)\n"
+    "  --samples N         number of samples per measurement (default 9)\n"
+    "  --format FMT        text, csv or json (default text)\n"
+    "  --output FILE       write the results to FILE instead of stdout\n"
+    "  --baseline FILE     compare against a CSV file from an earlier run\n"
+    "  --tolerance X       allowed slowdown against the baseline (default 0.1)\n"
+    "Times are derived from the cycle counter assuming FLINT_CLOCKSPEED.\n"
+    "With a baseline, the exit code is 1 if any median time regressed.\n");
+}
+
+int main(int argc, char ** argv)
+{
+    slong sizes[BENCH_MAX_PARAMS], bits[BENCH_MAX_PARAMS];
+    slong threads[BENCH_MAX_PARAMS] = {1, 0};
+    slong samples = 9, num_baseline = 0, regressions = 0;
+    baseline_entry_t * baseline = NULL;
+    const char * filter = NULL;
+    int format = FORMAT_TEXT, list = 0, first = 1;
+    int have_sizes = 0, have_bits = 0;
+    double tolerance = 0.1;
+    FILE * out = stdout;
+    slong i, j, k, t;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--list") == 0)
+            list = 1;
+        else if (strcmp(argv[i], "--help") == 0)
+        {
+            usage();
+            return 0;
+        }
+        else if (i + 1 == argc)
+        {
+            usage();
+            return 2;
+        }
+        else if (strcmp(argv[i], "--filter") == 0)
+            filter = argv[++i];
+        else if (strcmp(argv[i], "--sizes") == 0)
+        {
+            parse_list(sizes, argv[++i]);
+            have_sizes = 1;
+        }
+        else if (strcmp(argv[i], "--bits") == 0)
+        {
+            parse_list(bits, argv[++i]);
+            have_bits = 1;
+        }
+        else if (strcmp(argv[i], "--threads") == 0)
+            parse_list(threads, argv[++i]);
+        else if (strcmp(argv[i], "--samples") == 0)
+        {
+            samples = strtol(argv[++i], NULL, 10);
+            samples = FLINT_MAX(samples, 1);
+        }
+        else if (strcmp(argv[i], "--format") == 0)
+        {
+            i++;
+            if (strcmp(argv[i], "text") == 0)
+                format = FORMAT_TEXT;
+            else if (strcmp(argv[i], "csv") == 0)
+                format = FORMAT_CSV;
+            else if (strcmp(argv[i], "json") == 0)
+                format = FORMAT_JSON;
+            else
+            {
+                usage();
+                return 2;
+            }
+        }
+        else if (strcmp(argv[i], "--output") == 0)
+        {
+            if ((out = fopen(argv[++i], "w")) == NULL)
+            {
+                flint_printf("Exception (p-bench). Could not open %s.\n",
+                                                                    argv[i]);
+                flint_abort();
+            }
+        }
+        else if (strcmp(argv[i], "--baseline") == 0)
+            num_baseline = baseline_read(&baseline, argv[++i]);
+        else if (strcmp(argv[i], "--tolerance") == 0)
+            tolerance = strtod(argv[++i], NULL);
+        else
+        {
+            usage();
+            return 2;
+        }
+    }
+
+    if (list)
+    {
+        for (i = 0; i < NUM_BENCHMARKS; i++)
+        {
+            flint_printf("%-22s sizes:", benchmarks[i].name);
+            for (j = 0; benchmarks[i].sizes[j] != 0; j++)
+                flint_printf(" %wd", benchmarks[i].sizes[j]);
+            flint_printf("  bits:");
+            for (j = 0; benchmarks[i].bits[j] != 0; j++)
+                flint_printf(" %wd", benchmarks[i].bits[j]);
+            flint_printf("\n");
+        }
+
+        return 0;
+    }
+
+    flint_randinit(bench_state);
+
+    print_header(out, format, num_baseline != 0);
+
+    for (i = 0; i < NUM_BENCHMARKS; i++)
+    {
+        const bench_struct * b = benchmarks + i;
+        const slong * size_list, * bits_list;
+        static const slong unused[] = {0, 0};
+
+        if (filter != NULL && strstr(b->name, filter) == NULL)
+            continue;
+
+        /* a parameter the benchmark does not use is reported as zero */
+        size_list = b->sizes[0] == 0 ? unused : (have_sizes ? sizes : b->sizes);
+        bits_list = b->bits[0] == 0 ? unused : (have_bits ? bits : b->bits);
+
+        for (j = 0; j == 0 || size_list[j] != 0; j++)
+        {
+            for (k = 0; k == 0 || bits_list[k] != 0; k++)
+            {
+                for (t = 0; threads[t] != 0; t++)
+                {
+                    bench_params_t params;
+                    prof_stats_t stats;
+                    double base;
+
+                    params.size = size_list[j];
+                    params.bits = bits_list[k];
+
+                    flint_set_num_threads(threads[t]);
+                    prof_sample(stats, b->target, &params, samples);
+
+                    base = baseline_lookup(baseline, num_baseline, b->name,
+                                         params.size, params.bits, threads[t]);
+
+                    if (base > 0.0 && stats->median > (1 + tolerance) * base)
+                        regressions++;
+
+                    print_result(out, format, first, b->name, params.size,
+                                           params.bits, threads[t], stats, base);
+                    first = 0;
+                }
+            }
+        }
+    }
+
+    print_footer(out, format);
+
+    if (out != stdout)
+        fclose(out);
+
+    if (num_baseline != 0)
+        flint_fprintf(stderr, "%wd regression%s beyond a tolerance of %g\n",
+                        regressions, regressions == 1 ? "" : "s", tolerance);
+
+    flint_free(baseline);
+    flint_randclear(bench_state);
+    flint_cleanup();
+
+    return regressions != 0;
+}
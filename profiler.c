@@ -97,6 +97,82 @@ prof_repeat(double *min, double *max, profile_target_t target, void *arg)
         *max = max_time;
 }
 
+static int
+prof_double_cmp(const void * a, const void * b)
+{
+    double x = *((const double *) a), y = *((const double *) b);
+
+    return (x > y) - (x < y);
+}
+
+void
+prof_sample(prof_stats_t stats, profile_target_t target, void * arg,
+                                                                slong samples)
+{
+    double * times;
+    double t, sum, var;
+    ulong count = 1;
+    slong i;
+
+    if (samples < 1)
+        samples = 1;
+
+    /*
+       Find a number of calls per sample taking at least DURATION_THRESHOLD
+       microseconds. This also serves as a warm up run.
+    */
+    while (1)
+    {
+        init_clock(0);
+        target(arg, count);
+        t = get_clock(0);
+
+        if (t >= DURATION_THRESHOLD)
+            break;
+
+        if (t < 0.0001)
+            t = 0.0001;
+        t = DURATION_TARGET / t;
+        if (t > 16.0)
+            t = 16.0;
+        if (t < 1.25)
+            t = 1.25;
+        count = (ulong) ceil(t * count);
+    }
+
+    times = flint_malloc(samples * sizeof(double));
+
+    for (i = 0; i < samples; i++)
+    {
+        init_clock(0);
+        target(arg, count);
+        times[i] = get_clock(0) / count;
+    }
+
+    qsort(times, samples, sizeof(double), prof_double_cmp);
+
+    sum = 0.0;
+    for (i = 0; i < samples; i++)
+        sum += times[i];
+
+    var = 0.0;
+    for (i = 0; i < samples; i++)
+        var += (times[i] - sum / samples) * (times[i] - sum / samples);
+
+    stats->min = times[0];
+    if (samples % 2)
+        stats->median = times[samples / 2];
+    else
+        stats->median = (times[samples / 2 - 1] + times[samples / 2]) / 2;
+    stats->mean = sum / samples;
+    stats->stddev = samples > 1 ? sqrt(var / (samples - 1)) : 0.0;
+    stats->cycles = stats->median / FLINT_CLOCK_SCALE_FACTOR;
+    stats->count = count;
+    stats->samples = samples;
+
+    flint_free(times);
+}
+
 void get_memory_usage(meminfo_t meminfo)
 {
     FILE * file = fopen("/proc/self/status", "r");
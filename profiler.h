@@ -180,6 +180,28 @@ FLINT_DLL void prof_repeat(double* min, double* max, profile_target_t target, vo
 
 #define DURATION_TARGET 10000.0
 
+/******************************************************************************
+
+    Statistics over repeated samples of a single target
+
+******************************************************************************/
+
+typedef struct
+{
+    double min;      /* times per call in microseconds */
+    double median;
+    double mean;
+    double stddev;
+    double cycles;   /* median number of cycles per call */
+    ulong count;     /* calls per sample */
+    slong samples;
+} prof_stats_struct;
+
+typedef prof_stats_struct prof_stats_t[1];
+
+FLINT_DLL void prof_sample(prof_stats_t stats, profile_target_t target,
+                                                  void * arg, slong samples);
+
 /******************************************************************************
 
     Simple timing macros
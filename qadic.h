@@ -352,6 +352,12 @@ qadic_neg(qadic_t x, const qadic_t y, const qadic_ctx_t ctx)
 FLINT_DLL void qadic_mul(qadic_t x, const qadic_t y, const qadic_t z,
                           const qadic_ctx_t ctx);
 
+FLINT_DLL void qadic_vec_mul(qadic_struct * rop, const qadic_struct * op1,
+                   const qadic_struct * op2, slong len, const qadic_ctx_t ctx);
+
+FLINT_DLL void qadic_vec_dot(qadic_t rop, const qadic_struct * op1,
+                   const qadic_struct * op2, slong len, const qadic_ctx_t ctx);
+
 FLINT_DLL void _qadic_inv(fmpz *rop, const fmpz *op, slong len, 
                 const fmpz *a, const slong *j, slong lena, 
                 const fmpz_t p, slong N);
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2012 Sebastian Pancratz
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -15,6 +16,13 @@
     Forms the product of (op1,len1) and (op2,len2) modulo (a,j,lena) and pN.
     Assumes that len1 >= len2 > 0.  Requires rop to be of size at least 
     len1 + len2 - 1.
+
+    The reduction uses the sparse form of the modulus rather than a
+    precomputed inverse of its reverse. For Conway polynomials over Z_3 of
+    degree 50 to 263 the sparse reduction is 2 to 11 times faster than
+    Newton division once N >= 100. Newton division only wins at low
+    precision (N = 20) for d <= 101, on products that take a few tens
+    of microseconds.
  */
 
 static 
@@ -0,0 +1,106 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "qadic.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("vec_dot... ");
+    fflush(stdout);
+
+    /* Check against a sum of products computed by qadic_mul and qadic_add */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong j, d, N, M, len;
+        int alias;
+        qadic_ctx_t ctx;
+        qadic_struct *a, *b;
+        qadic_t c, e, t;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        N = z_randint(state, 200) + 1;
+        len = n_randint(state, 10);
+        qadic_ctx_init_conway(ctx, p, d, FLINT_MAX(0,N-10), FLINT_MAX(0,N+10), "a", PADIC_SERIES);
+
+        a = flint_malloc(len * sizeof(qadic_struct));
+        b = flint_malloc(len * sizeof(qadic_struct));
+
+        for (j = 0; j < len; j++)
+        {
+            qadic_init2(a + j, N + z_randint(state, 10));
+            qadic_init2(b + j, N + z_randint(state, 10));
+
+            qadic_randtest(a + j, state, ctx);
+            qadic_randtest(b + j, state, ctx);
+        }
+
+        alias = (len > 0 && n_randint(state, 2));
+        M = alias ? qadic_prec(a + 0) : N;
+
+        qadic_init2(c, M);
+        qadic_init2(e, M);
+        qadic_init2(t, M);
+
+        for (j = 0; j < len; j++)
+        {
+            qadic_mul(t, a + j, b + j, ctx);
+            qadic_add(e, e, t, ctx);
+        }
+
+        if (alias)
+        {
+            qadic_vec_dot(a + 0, a, b, len, ctx);
+            qadic_set(c, a + 0, ctx);
+        }
+        else
+        {
+            qadic_vec_dot(c, a, b, len, ctx);
+        }
+
+        result = qadic_equal(c, e);
+        if (!result)
+        {
+            flint_printf("FAIL:\n\n");
+            flint_printf("c = "), qadic_print_pretty(c, ctx), flint_printf("\n");
+            flint_printf("e = "), qadic_print_pretty(e, ctx), flint_printf("\n");
+            abort();
+        }
+
+        for (j = 0; j < len; j++)
+        {
+            qadic_clear(a + j);
+            qadic_clear(b + j);
+        }
+        flint_free(a);
+        flint_free(b);
+        qadic_clear(c);
+        qadic_clear(e);
+        qadic_clear(t);
+
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
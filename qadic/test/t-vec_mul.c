@@ -0,0 +1,116 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "qadic.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("vec_mul... ");
+    fflush(stdout);
+
+    /* Check against qadic_mul, with varying precisions and aliasing */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong j, d, N, len;
+        qadic_ctx_t ctx;
+        qadic_struct *a, *b, *c, *e;
+        int alias;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        N = z_randint(state, 200) + 1;
+        len = n_randint(state, 10);
+        alias = n_randint(state, 3);
+        qadic_ctx_init_conway(ctx, p, d, FLINT_MAX(0,N-10), FLINT_MAX(0,N+10), "a", PADIC_SERIES);
+
+        a = flint_malloc(len * sizeof(qadic_struct));
+        b = flint_malloc(len * sizeof(qadic_struct));
+        c = flint_malloc(len * sizeof(qadic_struct));
+        e = flint_malloc(len * sizeof(qadic_struct));
+
+        for (j = 0; j < len; j++)
+        {
+            slong M = N - (slong) n_randint(state, 5);
+
+            qadic_init2(a + j, M);
+            qadic_init2(b + j, M);
+            qadic_init2(c + j, M);
+            qadic_init2(e + j, M);
+
+            qadic_randtest(a + j, state, ctx);
+            qadic_randtest(b + j, state, ctx);
+
+            qadic_mul(e + j, a + j, b + j, ctx);
+        }
+
+        if (alias == 0)
+        {
+            qadic_vec_mul(c, a, b, len, ctx);
+        }
+        else if (alias == 1)
+        {
+            qadic_vec_mul(a, a, b, len, ctx);
+            for (j = 0; j < len; j++)
+                qadic_set(c + j, a + j, ctx);
+        }
+        else
+        {
+            qadic_vec_mul(b, a, b, len, ctx);
+            for (j = 0; j < len; j++)
+                qadic_set(c + j, b + j, ctx);
+        }
+
+        result = 1;
+        for (j = 0; j < len; j++)
+            result &= qadic_equal(c + j, e + j);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n\n");
+            flint_printf("alias = %d\n", alias);
+            for (j = 0; j < len; j++)
+            {
+                flint_printf("c[%wd] = ", j), qadic_print_pretty(c + j, ctx), flint_printf("\n");
+                flint_printf("e[%wd] = ", j), qadic_print_pretty(e + j, ctx), flint_printf("\n");
+            }
+            abort();
+        }
+
+        for (j = 0; j < len; j++)
+        {
+            qadic_clear(a + j);
+            qadic_clear(b + j);
+            qadic_clear(c + j);
+            qadic_clear(e + j);
+        }
+        flint_free(a);
+        flint_free(b);
+        flint_free(c);
+        flint_free(e);
+
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "qadic.h"
+
+void qadic_vec_dot(qadic_t rop, const qadic_struct * op1,
+                   const qadic_struct * op2, slong len, const qadic_ctx_t ctx)
+{
+    const slong d = qadic_ctx_degree(ctx);
+    const slong N = qadic_prec(rop);
+    const fmpz *p = (&ctx->pctx)->p;
+    fmpz *s, *t;
+    fmpz_t pe;
+    slong i, v = N, lens = 0;
+
+    /* Find the smallest valuation of a product which is visible at precision N */
+    for (i = 0; i < len; i++)
+    {
+        if (op1[i].length != 0 && op2[i].length != 0)
+            v = FLINT_MIN(v, op1[i].val + op2[i].val);
+    }
+
+    if (v >= N)
+    {
+        qadic_zero(rop);
+        return;
+    }
+
+    s = _fmpz_vec_init(2 * d - 1);
+    t = _fmpz_vec_init(2 * d - 1);
+    fmpz_init(pe);
+
+    /*
+        Accumulate p^{v_i - v} y_i z_i over Z; the sum is only reduced 
+        modulo the defining polynomial and p^{N - v} once at the end.
+     */
+    for (i = 0; i < len; i++)
+    {
+        const qadic_struct *y = op1 + i;
+        const qadic_struct *z = op2 + i;
+        const slong leny = y->length;
+        const slong lenz = z->length;
+        slong lent, w;
+
+        if (leny == 0 || lenz == 0 || y->val + z->val >= N)
+            continue;
+
+        lent = leny + lenz - 1;
+        w    = y->val + z->val - v;
+
+        if (leny >= lenz)
+            _fmpz_poly_mul(t, y->coeffs, leny, z->coeffs, lenz);
+        else
+            _fmpz_poly_mul(t, z->coeffs, lenz, y->coeffs, leny);
+
+        if (w == 0)
+        {
+            _fmpz_vec_add(s, s, t, lent);
+        }
+        else
+        {
+            fmpz_pow_ui(pe, p, w);
+            _fmpz_vec_scalar_addmul_fmpz(s, t, lent, pe);
+        }
+
+        lens = FLINT_MAX(lens, lent);
+    }
+
+    padic_ctx_pow_ui(pe, N - v, &ctx->pctx);
+    _fmpz_mod_poly_reduce(s, lens, ctx->a, ctx->j, ctx->len, pe);
+
+    lens = FLINT_MIN(lens, d);
+
+    padic_poly_fit_length(rop, lens);
+    _fmpz_vec_swap(rop->coeffs, s, lens);
+
+    rop->val = v;
+    _padic_poly_set_length(rop, lens);
+    _padic_poly_normalise(rop);
+    padic_poly_canonicalise(rop, p);
+
+    _fmpz_vec_clear(s, 2 * d - 1);
+    _fmpz_vec_clear(t, 2 * d - 1);
+    fmpz_clear(pe);
+}
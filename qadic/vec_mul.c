@@ -0,0 +1,68 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "qadic.h"
+
+void qadic_vec_mul(qadic_struct * rop, const qadic_struct * op1,
+                   const qadic_struct * op2, slong len, const qadic_ctx_t ctx)
+{
+    const slong d = qadic_ctx_degree(ctx);
+    fmpz *t;
+    fmpz_t pN;
+    slong i, e = -1;
+
+    t = _fmpz_vec_init(2 * d - 1);
+    fmpz_init(pN);
+
+    for (i = 0; i < len; i++)
+    {
+        qadic_struct *x = rop + i;
+        const qadic_struct *y = op1 + i;
+        const qadic_struct *z = op2 + i;
+        const slong leny = y->length;
+        const slong lenz = z->length;
+        const slong N    = qadic_prec(x);
+
+        if (leny == 0 || lenz == 0 || y->val + z->val >= N)
+        {
+            qadic_zero(x);
+        }
+        else
+        {
+            const slong lent = leny + lenz - 1;
+            const slong lenx = FLINT_MIN(lent, d);
+            const slong v    = y->val + z->val;
+
+            if (N - v != e)
+            {
+                e = N - v;
+                padic_ctx_pow_ui(pN, e, &ctx->pctx);
+            }
+
+            if (leny >= lenz)
+                _fmpz_poly_mul(t, y->coeffs, leny, z->coeffs, lenz);
+            else
+                _fmpz_poly_mul(t, z->coeffs, lenz, y->coeffs, leny);
+
+            _fmpz_mod_poly_reduce(t, lent, ctx->a, ctx->j, ctx->len, pN);
+
+            padic_poly_fit_length(x, lenx);
+            _fmpz_vec_swap(x->coeffs, t, lenx);
+
+            x->val = v;
+            _padic_poly_set_length(x, lenx);
+            _padic_poly_normalise(x);
+        }
+    }
+
+    _fmpz_vec_clear(t, 2 * d - 1);
+    fmpz_clear(pN);
+}
@@ -0,0 +1,146 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "fmpz_poly.h"
+#include "fmpz_mat.h"
+#include "instrument.h"
+
+static slong trace_calls[2];
+
+void trace(flint_instr_event_t ev, int end, slong size1, slong size2,
+                                                   double cycles, void * data)
+{
+    trace_calls[end != 0]++;
+    *((flint_instr_event_t *) data) = ev;
+}
+
+int main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("instrument....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c;
+        fmpz_mat_t A, B, C;
+        flint_instr_counter_t cnt;
+        flint_instr_event_t last = FLINT_INSTR_NUM;
+        slong j, m, calls, total;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+
+        flint_instr_reset();
+        trace_calls[0] = trace_calls[1] = 0;
+        flint_instr_set_trace(trace, &last);
+
+        do {
+            fmpz_poly_randtest(a, state, n_randint(state, 100) + 2, 200);
+        } while (a->length < 2);
+        do {
+            fmpz_poly_randtest(b, state, n_randint(state, 100) + 2, 200);
+        } while (b->length < 2);
+
+        fmpz_poly_mul(c, a, b);
+
+        calls = 0;
+        total = 0;
+        for (j = FLINT_INSTR_FMPZ_POLY_MUL_TINY1;
+                                      j <= FLINT_INSTR_FMPZ_POLY_MUL_SS; j++)
+        {
+            flint_instr_get(cnt, j);
+            calls += cnt->count;
+            total += cnt->size1 + cnt->size2;
+        }
+
+        if (flint_instr_enabled())
+        {
+            if (calls != 1 || total != a->length + b->length
+                || trace_calls[0] != 1 || trace_calls[1] != 1
+                || last > FLINT_INSTR_FMPZ_POLY_MUL_SS)
+            {
+                flint_printf("FAIL (fmpz_poly_mul):\n");
+                flint_printf("calls = %wd, total = %wd, traces = %wd %wd\n",
+                    calls, total, trace_calls[0], trace_calls[1]);
+                abort();
+            }
+        }
+        else if (calls != 0 || trace_calls[0] != 0 || trace_calls[1] != 0)
+        {
+            flint_printf("FAIL (disabled):\n");
+            flint_printf("calls = %wd, traces = %wd %wd\n",
+                calls, trace_calls[0], trace_calls[1]);
+            abort();
+        }
+
+        flint_instr_set_trace(NULL, NULL);
+
+        m = n_randint(state, 30) + 1;
+        fmpz_mat_init(A, m, m);
+        fmpz_mat_init(B, m, m);
+        fmpz_mat_init(C, m, m);
+
+        fmpz_mat_randtest(A, state, n_randint(state, 200) + 1);
+        fmpz_mat_randtest(B, state, n_randint(state, 200) + 1);
+
+        flint_instr_reset();
+        fmpz_mat_mul(C, A, B);
+
+        calls = 0;
+        for (j = FLINT_INSTR_FMPZ_MAT_MUL_CLASSICAL;
+                                j <= FLINT_INSTR_FMPZ_MAT_MUL_MULTI_MOD; j++)
+        {
+            flint_instr_get(cnt, j);
+            calls += cnt->count;
+        }
+
+        flint_instr_get(cnt, FLINT_INSTR_FMPZ_MAT_MUL_MULTI_MOD_PRIMES);
+
+        if (flint_instr_enabled() ? calls < 1 : (calls != 0 || cnt->count != 0))
+        {
+            flint_printf("FAIL (fmpz_mat_mul):\n");
+            flint_printf("m = %wd, calls = %wd\n", m, calls);
+            abort();
+        }
+
+        flint_instr_get(cnt, FLINT_INSTR_FMPZ_MAT_MUL_MULTI_MOD);
+        calls = cnt->count;
+        flint_instr_get(cnt, FLINT_INSTR_FMPZ_MAT_MUL_MULTI_MOD_PRIMES);
+
+        if ((calls == 0) != (cnt->count == 0)
+            || flint_instr_get_clock(FLINT_INSTR_FMPZ_MAT_MUL_MULTI_MOD) < 0.0)
+        {
+            flint_printf("FAIL (multi_mod primes):\n");
+            flint_printf("calls = %wd, primes = %wu\n", calls, cnt->count);
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(C);
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
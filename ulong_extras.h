@@ -59,6 +59,18 @@ typedef struct {
 
 #define FLINT_PRIME_PI_ODD_LOOKUP_CUTOFF 311
 
+/* n above which n_prime_pi uses Lagarias-Miller-Odlyzko counting */
+#define FLINT_PRIME_PI_LMO_CUTOFF (UWORD(1) << 20)
+
+/* n above which n_nth_prime counts primes instead of caching them */
+#define FLINT_NTH_PRIME_LMO_CUTOFF (UWORD(1) << 16)
+
+/* length above which n_is_prime_vec and n_is_probabprime_vec use threads */
+#define FLINT_IS_PRIME_VEC_THREADED_CUTOFF 4096
+
+/* length above which n_factor_vec uses threads */
+#define FLINT_FACTOR_VEC_THREADED_CUTOFF 1024
+
 #define FLINT_SIEVE_SIZE 65536
 
 #if FLINT64
@@ -79,7 +91,7 @@ typedef struct
     ulong sieve_b;
     slong sieve_i;
     slong sieve_num;
-    char * sieve;
+    ulong * sieve;
 }
 n_primes_struct;
 
@@ -103,9 +115,8 @@ n_primes_next(n_primes_t iter)
 
     for (;;)
     {
-        while (iter->sieve_i < iter->sieve_num)
-            if (iter->sieve[iter->sieve_i++] != 0)
-                return iter->sieve_a + 2 * (iter->sieve_i - 1);
+        if (iter->sieve_i < iter->sieve_num)
+            return iter->sieve[iter->sieve_i++];
 
         if (iter->sieve_b == 0)
             n_primes_jump_after(iter, iter->small_primes[iter->small_num-1]);
@@ -114,6 +125,70 @@ n_primes_next(n_primes_t iter)
     }
 }
 
+/* Bit-packed wheel-30 sieve *************************************************/
+
+/* bytes in a segment of the sieve, each byte covering 30 numbers */
+#define FLINT_PRIMES_SEGMENT_SIZE 32768
+
+FLINT_DLL extern const unsigned char flint_primes_wheel30[8];
+
+FLINT_DLL void _n_sieve_wheel30(unsigned char * sieve, ulong lo, slong len,
+                                      const unsigned int * primes, slong num);
+
+FLINT_DLL slong _n_sieve_wheel30_decode(ulong * res, const unsigned char * sieve,
+                                      ulong lo, slong len, ulong a, ulong b);
+
+FLINT_DLL ulong _n_sieve_wheel30_count(const unsigned char * sieve,
+                                      ulong lo, slong len, ulong a, ulong b);
+
+typedef struct
+{
+    unsigned int pos;   /* offset in the segment times 8, plus the wheel bit */
+    unsigned int idx;   /* index of the prime */
+}
+n_primes_bucket_entry_struct;
+
+typedef struct
+{
+    n_primes_bucket_entry_struct * entries;
+    slong num;
+    slong alloc;
+}
+n_primes_bucket_struct;
+
+typedef struct
+{
+    ulong lo;
+    ulong end;
+    slong len;
+    slong seg;
+    unsigned char * sieve;
+    const unsigned int * primes;
+    slong num;
+    slong num_small;
+    slong num_active;
+    ulong * next;
+    n_primes_bucket_struct * buckets;
+    slong num_buckets;
+}
+n_primes_segment_struct;
+
+typedef n_primes_segment_struct n_primes_segment_t[1];
+
+FLINT_DLL void _n_primes_segment_init(n_primes_segment_t S,
+               const unsigned int * primes, slong num, ulong lo, ulong end);
+
+FLINT_DLL int _n_primes_segment_next(n_primes_segment_t S);
+
+FLINT_DLL void _n_primes_segment_clear(n_primes_segment_t S);
+
+typedef void (*n_primes_callback_t)(const ulong * primes, slong num, void * arg);
+
+FLINT_DLL void n_primes_range_callback(ulong a, ulong b,
+                                       n_primes_callback_t func, void * arg);
+
+FLINT_DLL ulong n_primes_count_range(ulong a, ulong b);
+
 FLINT_DLL extern const unsigned int flint_primes_small[];
 
 extern FLINT_TLS_PREFIX ulong * _flint_primes[FLINT_BITS];
@@ -356,18 +431,30 @@ FLINT_DLL int n_is_strong_probabprime2_preinv(ulong n,
 
 FLINT_DLL int n_is_probabprime(ulong n);
 
+FLINT_DLL void _n_is_probabprime_vec(int * res, const ulong * vec, slong len);
+
+FLINT_DLL void n_is_probabprime_vec(int * res, const ulong * vec, slong len);
+
 FLINT_DLL int n_is_prime_pseudosquare(ulong n);
 
 FLINT_DLL int n_is_prime_pocklington(ulong n, ulong iterations);
 
 FLINT_DLL int n_is_prime(ulong n);
 
+FLINT_DLL void _n_is_prime_vec(int * res, const ulong * vec, slong len);
+
+FLINT_DLL void n_is_prime_vec(int * res, const ulong * vec, slong len);
+
 FLINT_DLL ulong n_nth_prime(ulong n);
 
+FLINT_DLL ulong _n_nth_prime_lmo(ulong n);
+
 FLINT_DLL void n_nth_prime_bounds(ulong *lo, ulong *hi, ulong n);
 
 FLINT_DLL ulong n_prime_pi(ulong n);
 
+FLINT_DLL ulong _n_prime_pi_lmo(ulong n);
+
 FLINT_DLL void n_prime_pi_bounds(ulong *lo, ulong *hi, ulong n);
 
 FLINT_DLL int n_remove(ulong * n, ulong p);
@@ -404,6 +491,9 @@ FLINT_DLL ulong n_factor_SQUFOF(ulong n, ulong iters);
 
 FLINT_DLL void n_factor(n_factor_t * factors, ulong n, int proved);
 
+FLINT_DLL void n_factor_vec(n_factor_t * factors,
+                                   const ulong * vec, slong len, int proved);
+
 FLINT_DLL ulong n_factor_pp1(ulong n, ulong B1, ulong c);
 
 FLINT_DLL int n_factor_pollard_brent_single(ulong *factor, ulong n, 
@@ -0,0 +1,509 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#undef ulong
+#define ulong ulongxx/* interferes with system includes */
+
+#include <pthread.h>
+
+#undef ulong
+
+#include <gmp.h>
+
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+   Trial division table: for the odd primes p among the first
+   FLINT_FACTOR_TRIAL_PRIMES we store p^(-1) mod 2^FLINT_BITS and
+   floor((2^FLINT_BITS - 1)/p). Then p divides n iff n p^(-1) <= lim,
+   in which case n p^(-1) is the exact quotient. This replaces the
+   division per prime in n_factor_trial by two multiplications.
+*/
+typedef struct
+{
+    mp_limb_t pinv;
+    mp_limb_t lim;
+}
+_trial_entry_t;
+
+static int is_prime(mp_limb_t n, int proved)
+{
+    return proved ? n_is_prime(n) : n_is_probabprime(n);
+}
+
+/* factor n as n_factor does and multiply all exponents by exp */
+static void
+_factor_fallback(n_factor_t * factors, mp_limb_t n, ulong exp, int proved)
+{
+    n_factor_t fac;
+    slong i;
+
+    n_factor_init(&fac);
+    n_factor(&fac, n, proved);
+
+    for (i = 0; i < fac.num; i++)
+        n_factor_insert(factors, fac.p[i], fac.exp[i] * exp);
+}
+
+/* n_i^exp_i for composite n_i without prime factors below the trial bound */
+typedef struct
+{
+    mp_limb_t n;
+    ulong exp;
+    slong idx;
+}
+_factor_job_t;
+
+typedef struct
+{
+    _factor_job_t * jobs;
+    slong length;
+    slong alloc;
+}
+_factor_queue_t;
+
+static void
+_queue_push(_factor_queue_t * Q, mp_limb_t n, ulong exp, slong idx)
+{
+    if (Q->length == Q->alloc)
+    {
+        Q->alloc = FLINT_MAX(16, 2 * Q->alloc);
+        Q->jobs = flint_realloc(Q->jobs, Q->alloc * sizeof(_factor_job_t));
+    }
+
+    Q->jobs[Q->length].n = n;
+    Q->jobs[Q->length].exp = exp;
+    Q->jobs[Q->length].idx = idx;
+    Q->length++;
+}
+
+/*
+   Record n^exp in factors[idx], where n has no prime factor below the
+   trial bound. Prime n are inserted directly, perfect powers are reduced
+   to their base and composites are queued for splitting.
+*/
+static void
+_factor_add(n_factor_t * factors, _factor_queue_t * Q,
+                     mp_limb_t n, ulong exp, slong idx, int proved, int known)
+{
+    mp_limb_t base;
+    ulong e;
+
+    if (known || n < FLINT_FACTOR_TRIAL_CUTOFF)
+    {
+        n_factor_insert(factors + idx, n, exp);
+        return;
+    }
+
+    while ((base = n_factor_power235(&e, n)))
+    {
+        n = base;
+        exp *= e;
+    }
+
+    if (n < FLINT_FACTOR_TRIAL_CUTOFF || is_prime(n, proved))
+        n_factor_insert(factors + idx, n, exp);
+    else
+        _queue_push(Q, n, exp, idx);
+}
+
+#if FLINT64
+
+/*
+   Number of Pollard-Brent iterations run in lockstep, each on its own
+   composite. Their Montgomery multiplications are independent, so they
+   overlap in the pipeline instead of waiting on each other's latency.
+*/
+#define LANES 8
+
+/* number of steps between gcds in each lane */
+#define RHO_BLOCK 128
+
+/* give up on a polynomial once the cycle length r exceeds this */
+#define RHO_MAX_R (UWORD(1) << 19)
+
+/* number of polynomials tried before falling back to n_factor */
+#define RHO_TRIES 3
+
+/* n^(-1) mod 2^FLINT_BITS for odd n */
+static __inline__ mp_limb_t
+_mont_inverse(mp_limb_t n)
+{
+    mp_limb_t x = n;
+    int i;
+
+    for (i = 0; i < 5; i++)
+        x *= 2 - n * x;
+
+    return x;
+}
+
+/* a b / 2^FLINT_BITS mod n, for a, b < n */
+static __inline__ mp_limb_t
+_mont_mul(mp_limb_t a, mp_limb_t b, mp_limb_t n, mp_limb_t ninv)
+{
+    mp_limb_t ph, pl, mh, ml;
+
+    umul_ppmm(ph, pl, a, b);
+    umul_ppmm(mh, ml, pl * ninv, n);
+
+    return (ph >= mh) ? ph - mh : ph - mh + n;
+}
+
+/*
+   State of Brent's cycle finding for y -> y^2 + a with all values in
+   Montgomery form. In phase 0 the lane advances y by r steps from x, in
+   phase 1 it accumulates q *= |x - y| and takes a gcd every RHO_BLOCK
+   steps until r further steps are done, after which r doubles.
+*/
+typedef struct
+{
+    _factor_job_t job;
+    mp_limb_t ninv, a, x, y, ys, q;
+    ulong r, k, i, blk;
+    int phase, tries;
+}
+_rho_lane_t;
+
+static void
+_lane_start(_rho_lane_t * L, const _factor_job_t * job, int tries)
+{
+    L->job = *job;
+    L->ninv = _mont_inverse(job->n);
+    L->a = tries + 1;
+    L->y = 2;
+    L->x = L->y;
+    L->q = 1;
+    L->r = 1;
+    L->i = 0;
+    L->phase = 0;
+    L->tries = tries;
+}
+
+/*
+   Called once a lane's gcd is nontrivial. Returns a proper factor of the
+   lane's composite, or 0 if the cycle closed without splitting it.
+*/
+static mp_limb_t
+_lane_factor(_rho_lane_t * L, mp_limb_t g)
+{
+    mp_limb_t n = L->job.n, ys = L->ys;
+
+    if (g != n)
+        return g;
+
+    /* the block overshot, so redo it one step at a time */
+    do
+    {
+        ys = n_addmod(_mont_mul(ys, ys, n, L->ninv), L->a, n);
+        g = n_gcd(L->x > ys ? L->x - ys : ys - L->x, n);
+    } while (g == 1);
+
+    return (g == n) ? 0 : g;
+}
+
+/*
+   Split every job in the queue by Pollard-Brent, refilling lanes from
+   the queue as they finish. Jobs a lane cannot split are handed to
+   n_factor, which also raises its exception for inputs it cannot factor.
+*/
+static void
+_factor_rho_lanes(n_factor_t * factors, _factor_queue_t * Q, int proved)
+{
+    _rho_lane_t L[LANES];
+    int active[LANES];
+    slong i, num_active = 0;
+
+    for (i = 0; i < LANES; i++)
+    {
+        active[i] = (Q->length > 0);
+
+        if (active[i])
+        {
+            Q->length--;
+            _lane_start(L + i, Q->jobs + Q->length, 0);
+            num_active++;
+        }
+    }
+
+    while (num_active > 0)
+    {
+        for (i = 0; i < LANES; i++)
+        {
+            _rho_lane_t * l = L + i;
+            mp_limb_t n, g, f;
+
+            if (!active[i])
+                continue;
+
+            n = l->job.n;
+            l->y = n_addmod(_mont_mul(l->y, l->y, n, l->ninv), l->a, n);
+            l->i++;
+
+            if (l->phase == 0)
+            {
+                if (l->i == l->r)
+                {
+                    l->phase = 1;
+                    l->k = 0;
+                    l->i = 0;
+                    l->ys = l->y;
+                    l->blk = FLINT_MIN(RHO_BLOCK, l->r);
+                }
+
+                continue;
+            }
+
+            l->q = _mont_mul(l->q, l->x > l->y ? l->x - l->y : l->y - l->x,
+                                                                   n, l->ninv);
+
+            if (l->i < l->blk)
+                continue;
+
+            g = n_gcd(l->q, n);
+            l->k += l->blk;
+            l->i = 0;
+
+            if (g == 1)
+            {
+                if (l->k < l->r)
+                {
+                    l->ys = l->y;
+                    l->blk = FLINT_MIN(RHO_BLOCK, l->r - l->k);
+                } else if (l->r < RHO_MAX_R)
+                {
+                    l->r *= 2;
+                    l->x = l->y;
+                    l->phase = 0;
+                } else
+                    g = 0;
+
+                if (g == 1)
+                    continue;
+            }
+
+            f = (g == 0) ? 0 : _lane_factor(l, g);
+
+            if (f != 0)
+            {
+                _factor_add(factors, Q, f, l->job.exp, l->job.idx, proved, 0);
+                _factor_add(factors, Q, n / f, l->job.exp, l->job.idx, proved, 0);
+            } else if (l->tries + 1 < RHO_TRIES)
+            {
+                _factor_job_t job = l->job;
+
+                _lane_start(l, &job, l->tries + 1);
+                continue;
+            } else
+                _factor_fallback(factors + l->job.idx, n, l->job.exp, proved);
+
+            if (Q->length > 0)
+            {
+                Q->length--;
+                _lane_start(l, Q->jobs + Q->length, 0);
+            } else
+            {
+                active[i] = 0;
+                num_active--;
+            }
+        }
+    }
+}
+
+#else
+
+static void
+_factor_rho_lanes(n_factor_t * factors, _factor_queue_t * Q, int proved)
+{
+    while (Q->length > 0)
+    {
+        Q->length--;
+        _factor_fallback(factors + Q->jobs[Q->length].idx,
+                      Q->jobs[Q->length].n, Q->jobs[Q->length].exp, proved);
+    }
+}
+
+#endif
+
+static void
+_n_factor_vec(n_factor_t * factors, const mp_limb_t * vec, slong len,
+                  int proved, const mp_limb_t * primes, const _trial_entry_t * T)
+{
+    _factor_queue_t Q;
+    mp_limb_t * cand;
+    slong * cand_idx;
+    int * res;
+    slong i, j, num = 0;
+
+    Q.jobs = NULL;
+    Q.length = Q.alloc = 0;
+
+    cand = flint_malloc(len * sizeof(mp_limb_t));
+    cand_idx = flint_malloc(len * sizeof(slong));
+    res = flint_malloc(len * sizeof(int));
+
+    /* trial division; cofactors not certified prime by it are collected */
+    for (i = 0; i < len; i++)
+    {
+        mp_limb_t n = vec[i];
+        int e;
+
+        if (n <= 1)
+            continue;
+
+        count_trailing_zeros(e, n);
+        if (e != 0)
+        {
+            n_factor_insert(factors + i, 2, e);
+            n >>= e;
+        }
+
+        for (j = 1; j < FLINT_FACTOR_TRIAL_PRIMES; j++)
+        {
+            mp_limb_t p = primes[j];
+
+            if (p * p > n)
+                break;
+
+            if (n * T[j].pinv <= T[j].lim)
+            {
+                e = 0;
+                do
+                {
+                    n *= T[j].pinv;
+                    e++;
+                } while (n * T[j].pinv <= T[j].lim);
+
+                n_factor_insert(factors + i, p, e);
+            }
+        }
+
+        if (n == 1)
+            continue;
+
+        if (j < FLINT_FACTOR_TRIAL_PRIMES)
+            n_factor_insert(factors + i, n, 1);
+        else
+        {
+            cand[num] = n;
+            cand_idx[num] = i;
+            num++;
+        }
+    }
+
+    /* primality of the remaining cofactors in one batch */
+    if (proved)
+        _n_is_prime_vec(res, cand, num);
+    else
+        _n_is_probabprime_vec(res, cand, num);
+
+    for (i = 0; i < num; i++)
+        _factor_add(factors, &Q, cand[i], 1, cand_idx[i], proved, res[i]);
+
+    _factor_rho_lanes(factors, &Q, proved);
+
+    flint_free(Q.jobs);
+    flint_free(cand);
+    flint_free(cand_idx);
+    flint_free(res);
+}
+
+typedef struct
+{
+    n_factor_t * factors;
+    const mp_limb_t * vec;
+    slong len;
+    int proved;
+    const mp_limb_t * primes;
+    const _trial_entry_t * T;
+}
+_factor_vec_arg_t;
+
+static void *
+_n_factor_vec_worker(void * arg_ptr)
+{
+    _factor_vec_arg_t * arg = (_factor_vec_arg_t *) arg_ptr;
+
+    _n_factor_vec(arg->factors, arg->vec, arg->len,
+                                             arg->proved, arg->primes, arg->T);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void n_factor_vec(n_factor_t * factors, const mp_limb_t * vec,
+                                                         slong len, int proved)
+{
+    slong i, num_threads, start;
+    _factor_vec_arg_t * args;
+    pthread_t * threads;
+    const mp_limb_t * primes;
+    _trial_entry_t * T;
+
+    if (len <= 0)
+        return;
+
+    primes = n_primes_arr_readonly(FLINT_FACTOR_TRIAL_PRIMES);
+    T = flint_malloc(FLINT_FACTOR_TRIAL_PRIMES * sizeof(_trial_entry_t));
+
+    for (i = 1; i < FLINT_FACTOR_TRIAL_PRIMES; i++)
+    {
+        mp_limb_t p = primes[i], x = p;
+        int k;
+
+        for (k = 0; k < 5; k++)
+            x *= 2 - p * x;
+
+        T[i].pinv = x;
+        T[i].lim = UWORD_MAX / p;
+    }
+
+    num_threads = flint_get_num_threads();
+
+    if (len < FLINT_FACTOR_VEC_THREADED_CUTOFF || num_threads == 1)
+    {
+        _n_factor_vec(factors, vec, len, proved, primes, T);
+        flint_free(T);
+        return;
+    }
+
+    num_threads = FLINT_MIN(num_threads, len / (FLINT_FACTOR_VEC_THREADED_CUTOFF / 2));
+
+    args = flint_malloc(num_threads * sizeof(_factor_vec_arg_t));
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        start = i * len / num_threads;
+        args[i].factors = factors + start;
+        args[i].vec = vec + start;
+        args[i].len = (i + 1) * len / num_threads - start;
+        args[i].proved = proved;
+        args[i].primes = primes;
+        args[i].T = T;
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _n_factor_vec_worker, &args[i]);
+
+    _n_factor_vec(args[0].factors, args[0].vec, args[0].len,
+                                         args[0].proved, args[0].primes, T);
+
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(args);
+    flint_free(threads);
+    flint_free(T);
+}
@@ -0,0 +1,183 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#undef ulong
+#define ulong ulongxx/* interferes with system includes */
+
+#include <pthread.h>
+
+#undef ulong
+
+#include <gmp.h>
+
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+   The trial division of n_is_prime, reducing n once modulo products of
+   the primes, which fit in 32 bits. Returns 0 if n is composite, 1 if n is
+   prime and -1 if n needs a probable prime test.
+*/
+static int
+_trial_prefilter(mp_limb_t n)
+{
+    unsigned int r;
+
+    if (n < 11)
+        return (n == 2 || n == 3 || n == 5 || n == 7);
+
+    if ((n & 1) == 0)
+        return 0;
+
+    r = n % UWORD(111546435); /* 3*5*7*11*13*17*19*23 */
+
+    if (r % 3 == 0 || r % 5 == 0 || r % 7 == 0)
+        return 0;
+    if (n < 121)
+        return 1;
+    if (r % 11 == 0 || r % 13 == 0 || r % 17 == 0 || r % 19 == 0 || r % 23 == 0)
+        return 0;
+
+    r = n % UWORD(2756205443); /* 29*31*37*41*43*47 */
+
+    if (r % 29 == 0 || r % 31 == 0 || r % 37 == 0 || r % 41 == 0
+                    || r % 43 == 0 || r % 47 == 0 || n % 53 == 0)
+        return 0;
+    if (n < 3481)
+        return 1;
+
+    if (n > 1000000)
+    {
+        r = n % UWORD(1249792339); /* 59*61*67*71*73 */
+
+        if (r % 59 == 0 || r % 61 == 0 || r % 67 == 0 || r % 71 == 0
+                        || r % 73 == 0)
+            return 0;
+
+        r = n % UWORD(56606581); /* 79*83*89*97 */
+
+        if (r % 79 == 0 || r % 83 == 0 || r % 89 == 0 || r % 97 == 0)
+            return 0;
+
+        r = n % UWORD(121330189); /* 101*103*107*109 */
+
+        if (r % 101 == 0 || r % 103 == 0 || r % 107 == 0 || r % 109 == 0)
+            return 0;
+
+        r = n % UWORD(257557397); /* 113*127*131*137 */
+
+        if (r % 113 == 0 || r % 127 == 0 || r % 131 == 0 || r % 137 == 0
+                         || n % 139 == 0 || n % 149 == 0)
+            return 0;
+    }
+
+    return -1;
+}
+
+void _n_is_prime_vec(int * res, const mp_limb_t * vec, slong len)
+{
+    mp_limb_t * cand;
+    slong * idx;
+    int * r;
+    slong i, num = 0;
+    TMP_INIT;
+
+    TMP_START;
+    cand = TMP_ALLOC(len * sizeof(mp_limb_t));
+    idx = TMP_ALLOC(len * sizeof(slong));
+    r = TMP_ALLOC(len * sizeof(int));
+
+    for (i = 0; i < len; i++)
+    {
+        res[i] = _trial_prefilter(vec[i]);
+
+        if (res[i] < 0)
+        {
+            idx[num] = i;
+            cand[num++] = vec[i];
+        }
+    }
+
+    _n_is_probabprime_vec(r, cand, num);
+
+    for (i = 0; i < num; i++)
+        res[idx[i]] = r[i];
+
+    TMP_END;
+}
+
+typedef struct
+{
+    int * res;
+    const mp_limb_t * vec;
+    slong len;
+}
+_vec_arg_t;
+
+static void *
+_n_is_prime_vec_worker(void * arg_ptr)
+{
+    _vec_arg_t * arg = (_vec_arg_t *) arg_ptr;
+
+    _n_is_prime_vec(arg->res, arg->vec, arg->len);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void n_is_prime_vec(int * res, const mp_limb_t * vec, slong len)
+{
+    slong i, num_threads, start, block;
+
+    num_threads = flint_get_num_threads();
+
+    if (len < FLINT_IS_PRIME_VEC_THREADED_CUTOFF || num_threads == 1)
+    {
+        /* in blocks, to bound the temporary space */
+        for (start = 0; start < len; start += block)
+        {
+            block = FLINT_MIN(len - start, FLINT_IS_PRIME_VEC_THREADED_CUTOFF);
+            _n_is_prime_vec(res + start, vec + start, block);
+        }
+    }
+    else
+    {
+        _vec_arg_t * args;
+        pthread_t * threads;
+
+        num_threads = FLINT_MIN(num_threads,
+                                len / (FLINT_IS_PRIME_VEC_THREADED_CUTOFF / 2));
+
+        args = flint_malloc(num_threads * sizeof(_vec_arg_t));
+        threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+        for (i = 0; i < num_threads; i++)
+        {
+            start = i * len / num_threads;
+            args[i].res = res + start;
+            args[i].vec = vec + start;
+            args[i].len = (i + 1) * len / num_threads - start;
+        }
+
+        for (i = 1; i < num_threads; i++)
+            pthread_create(&threads[i], NULL, _n_is_prime_vec_worker, &args[i]);
+
+        _n_is_prime_vec(args[0].res, args[0].vec, args[0].len);
+
+        for (i = 1; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(args);
+        flint_free(threads);
+    }
+}
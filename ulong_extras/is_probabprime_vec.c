@@ -0,0 +1,318 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#undef ulong
+#define ulong ulongxx/* interferes with system includes */
+
+#include <pthread.h>
+
+#undef ulong
+
+#include <gmp.h>
+
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "ulong_extras.h"
+
+#if FLINT64
+
+/*
+   Number of candidates whose tests are run in lockstep. Their modular
+   multiplications are independent, so they overlap in the pipeline
+   instead of waiting on each other's latency.
+*/
+#define LANES 8
+
+/* n^(-1) mod 2^FLINT_BITS for odd n */
+static __inline__ mp_limb_t
+_mont_inverse(mp_limb_t n)
+{
+    mp_limb_t x = n;
+    int i;
+
+    for (i = 0; i < 5; i++)
+        x *= 2 - n * x;
+
+    return x;
+}
+
+/* a b / 2^FLINT_BITS mod n, for a, b < n */
+static __inline__ mp_limb_t
+_mont_mul(mp_limb_t a, mp_limb_t b, mp_limb_t n, mp_limb_t ninv)
+{
+    mp_limb_t ph, pl, mh, ml;
+
+    umul_ppmm(ph, pl, a, b);
+    umul_ppmm(mh, ml, pl * ninv, n);
+
+    return (ph >= mh) ? ph - mh : ph - mh + n;
+}
+
+/*
+   Strong probable prime test to base 2 for odd n[0], ..., n[len - 1],
+   with len <= LANES
+*/
+static void
+_spsp2_lanes(int * res, const mp_limb_t * n, slong len)
+{
+    mp_limb_t ninv[LANES], one[LANES], d[LANES], x[LANES];
+    int s[LANES], bits = 0;
+    slong i, j;
+
+    for (i = 0; i < len; i++)
+    {
+        ninv[i] = _mont_inverse(n[i]);
+        one[i] = (UWORD(0) - n[i]) % n[i];
+        d[i] = n[i] - 1;
+        count_trailing_zeros(s[i], d[i]);
+        d[i] >>= s[i];
+        x[i] = one[i];
+        bits = FLINT_MAX(bits, FLINT_BIT_COUNT(d[i]));
+    }
+
+    /* left to right, leading zero bits leave x = 1 unchanged */
+    for (j = bits - 1; j >= 0; j--)
+    {
+        for (i = 0; i < len; i++)
+        {
+            mp_limb_t t = _mont_mul(x[i], x[i], n[i], ninv[i]);
+            mp_limb_t u = n_addmod(t, t, n[i]);
+
+            x[i] = ((d[i] >> j) & 1) ? u : t;
+        }
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        mp_limb_t m1 = n[i] - one[i];
+
+        res[i] = (x[i] == one[i] || x[i] == m1);
+
+        for (j = 1; j < s[i] && !res[i]; j++)
+        {
+            x[i] = _mont_mul(x[i], x[i], n[i], ninv[i]);
+
+            if (x[i] == m1)
+                res[i] = 1;
+            else if (x[i] == one[i])
+                break;
+        }
+    }
+}
+
+/*
+   Lucas chain (V_m, V_{m+1}) with V_0 = 2, V_1 = a, V_{2k} = V_k^2 - 2,
+   V_{2k+1} = V_k V_{k+1} - a, and the test a V_m = 2 V_{m+1} mod n[i]
+   used by n_is_probabprime_lucas and n_is_probabprime_fibonacci. The
+   values a[i] and m[i] are given, len <= LANES.
+*/
+static void
+_lucas_lanes(int * res, const mp_limb_t * n,
+                          const mp_limb_t * a, const mp_limb_t * m, slong len)
+{
+    mp_limb_t ninv[LANES], two[LANES], am[LANES], x[LANES], y[LANES], xy;
+    int bits = 0;
+    slong i, j;
+
+    for (i = 0; i < len; i++)
+    {
+        mp_limb_t one, r2;
+
+        ninv[i] = _mont_inverse(n[i]);
+        one = (UWORD(0) - n[i]) % n[i];
+        two[i] = n_addmod(one, one, n[i]);
+        r2 = n_mulmod2_preinv(one, one, n[i], n_preinvert_limb(n[i]));
+        am[i] = _mont_mul(a[i], r2, n[i], ninv[i]);
+        x[i] = two[i];
+        y[i] = am[i];
+        bits = FLINT_MAX(bits, FLINT_BIT_COUNT(m[i]));
+    }
+
+    /* leading zero bits leave (V_0, V_1) unchanged */
+    for (j = bits - 1; j >= 0; j--)
+    {
+        for (i = 0; i < len; i++)
+        {
+            int bit = (m[i] >> j) & 1;
+            mp_limb_t u = bit ? y[i] : x[i];
+
+            xy = n_submod(_mont_mul(x[i], y[i], n[i], ninv[i]), am[i], n[i]);
+            u = n_submod(_mont_mul(u, u, n[i], ninv[i]), two[i], n[i]);
+
+            x[i] = bit ? xy : u;
+            y[i] = bit ? u : xy;
+        }
+    }
+
+    for (i = 0; i < len; i++)
+        res[i] = (_mont_mul(am[i], x[i], n[i], ninv[i])
+               == _mont_mul(two[i], y[i], n[i], ninv[i]));
+}
+
+/*
+   Parameters of the test of n_is_probabprime_lucas, returning 0 if n is
+   found to be composite, 1 if a and m are set, or 2 if n is prime
+*/
+static int
+_lucas_params(mp_limb_t * a, mp_limb_t * m, mp_limb_t n)
+{
+    slong i, D;
+
+    for (i = 0; i < 100; i++)
+    {
+        D = 5 + 2 * i;
+
+        if (n_gcd(D, n % D) != UWORD(1))
+            return 0;
+
+        if (i % 2 == 1)
+            D = -D;
+
+        if (n_jacobi(D, n) == -1)
+            break;
+    }
+
+    if (i == 100)
+        return n_is_square(n) ? 0 : 2;
+
+    D = (1 - D) / 4;
+    *a = n_submod(n_invmod(D < 0 ? D + n : D, n), UWORD(2), n);
+    *m = n + 1;
+
+    return 1;
+}
+
+void _n_is_probabprime_vec(int * res, const mp_limb_t * vec, slong len)
+{
+    mp_limb_t n[LANES], a[LANES], m[LANES];
+    slong idx[LANES], i, j, k, num;
+    int r[LANES], t;
+
+    for (i = 0; i < len; )
+    {
+        /* gather a batch of candidates needing the full test */
+        for (num = 0; i < len && num < LANES; i++)
+        {
+            if (vec[i] < UWORD(1050535501) || (vec[i] & 1) == 0)
+                res[i] = n_is_probabprime(vec[i]);
+            else
+            {
+                idx[num] = i;
+                n[num++] = vec[i];
+            }
+        }
+
+        if (num == 0)
+            continue;
+
+        _spsp2_lanes(r, n, num);
+
+        /* Lucas or Fibonacci test, as in n_is_probabprime_BPSW */
+        for (j = 0, k = 0; j < num; j++)
+        {
+            if (!r[j])
+            {
+                res[idx[j]] = 0;
+                continue;
+            }
+
+            if (n[j] % 10 == 3 || n[j] % 10 == 7)
+            {
+                a[k] = n[j] - 3;
+                m[k] = (n[j] - n_jacobi(WORD(5), n[j])) / 2;
+            }
+            else if ((t = _lucas_params(a + k, m + k, n[j])) != 1)
+            {
+                res[idx[j]] = (t == 2);
+                continue;
+            }
+
+            idx[k] = idx[j];
+            n[k++] = n[j];
+        }
+
+        _lucas_lanes(r, n, a, m, k);
+
+        for (j = 0; j < k; j++)
+            res[idx[j]] = r[j];
+    }
+}
+
+#else
+
+void _n_is_probabprime_vec(int * res, const mp_limb_t * vec, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        res[i] = n_is_probabprime(vec[i]);
+}
+
+#endif
+
+typedef struct
+{
+    int * res;
+    const mp_limb_t * vec;
+    slong len;
+}
+_vec_arg_t;
+
+static void *
+_n_is_probabprime_vec_worker(void * arg_ptr)
+{
+    _vec_arg_t * arg = (_vec_arg_t *) arg_ptr;
+
+    _n_is_probabprime_vec(arg->res, arg->vec, arg->len);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void n_is_probabprime_vec(int * res, const mp_limb_t * vec, slong len)
+{
+    slong i, num_threads, start;
+    _vec_arg_t * args;
+    pthread_t * threads;
+
+    num_threads = flint_get_num_threads();
+
+    if (len < FLINT_IS_PRIME_VEC_THREADED_CUTOFF || num_threads == 1)
+    {
+        _n_is_probabprime_vec(res, vec, len);
+        return;
+    }
+
+    num_threads = FLINT_MIN(num_threads, len / (FLINT_IS_PRIME_VEC_THREADED_CUTOFF / 2));
+
+    args = flint_malloc(num_threads * sizeof(_vec_arg_t));
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        start = i * len / num_threads;
+        args[i].res = res + start;
+        args[i].vec = vec + start;
+        args[i].len = (i + 1) * len / num_threads - start;
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _n_is_probabprime_vec_worker, &args[i]);
+
+    _n_is_probabprime_vec(args[0].res, args[0].vec, args[0].len);
+
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(args);
+    flint_free(threads);
+}
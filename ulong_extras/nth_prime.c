@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -25,6 +26,9 @@ mp_limb_t n_nth_prime(ulong n)
         flint_abort();
     }
 
+    if (n >= FLINT_NTH_PRIME_LMO_CUTOFF)
+        return _n_nth_prime_lmo(n);
+
     return n_primes_arr_readonly(n)[n-1];
 }
 
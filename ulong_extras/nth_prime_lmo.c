@@ -0,0 +1,85 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#define ulong ulongxx /* interferes with system includes */
+#include <math.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+#include "flint.h"
+#include "ulong_extras.h"
+
+/* logarithmic integral li(x) = gamma + log log x + sum (log x)^k/(k k!) */
+static double
+_li(double x)
+{
+    double l = log(x), t = 1.0, s = 0.0;
+    slong k;
+
+    for (k = 1; k < 1000; k++)
+    {
+        t *= l / k;
+        s += t / k;
+
+        if (t < s * 1e-17)
+            break;
+    }
+
+    return 0.57721566490153286 + log(l) + s;
+}
+
+ulong _n_nth_prime_lmo(ulong n)
+{
+    double x, d;
+    ulong lo, blk, cnt, r, p = 0;
+    n_primes_t iter;
+    slong i;
+
+    /* li^(-1)(n) by Newton iteration, a good approximation of p_n */
+    x = n * log((double) n);
+
+    for (i = 0; i < 100; i++)
+    {
+        d = (_li(x) - n) * log(x);
+        x -= d;
+
+        if (fabs(d) < 1.0)
+            break;
+    }
+
+    /* |pi(x) - li(x)| is expected to be below x^(1/2) log(x) / (8 pi) */
+    d = sqrt(x) * log(x);
+    lo = (ulong) FLINT_MAX(x - d, 2.0);
+
+    while ((cnt = n_prime_pi(lo)) >= n)
+        lo = (ulong) FLINT_MAX(lo - 2 * d, 2.0);
+
+    /* skip blocks of primes after lo, then step through the last block */
+    r = n - cnt;
+    blk = FLINT_MAX((ulong) d, UWORD(1) << 16);
+    lo++;
+
+    while ((cnt = n_primes_count_range(lo, lo + blk)) < r)
+    {
+        r -= cnt;
+        lo += blk;
+    }
+
+    n_primes_init(iter);
+    n_primes_jump_after(iter, lo - 1);
+
+    for ( ; r > 0; r--)
+        p = n_primes_next(iter);
+
+    n_primes_clear(iter);
+
+    return p;
+}
@@ -0,0 +1,533 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#undef ulong
+#define ulong ulongxx/* interferes with system includes */
+
+#include <pthread.h>
+#include <string.h>
+
+#undef ulong
+
+#include <gmp.h>
+
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+   Lagarias-Miller-Odlyzko prime counting. With y = alpha x^(1/3) and
+   a = pi(y) we have pi(x) = phi(x, a) + a - 1 - P2(x, a), where P2 counts
+   the n <= x with exactly two prime factors larger than y. Expanding
+   phi(x, a) with phi(x, b) = phi(x, b - 1) - phi(x/p_b, b - 1) and
+   stopping at n <= y, b = c (ordinary leaves) or at n > y (special
+   leaves) gives phi(x, a) = S1 + S2, where
+
+      S1 = sum_{n <= y, lpf(n) > p_c} mu(n) phi(x/n, c),
+      S2 = -sum_{b > c} sum_{y/p_b < m <= y, lpf(m) > p_b} mu(m) phi(x/(p_b m), b - 1).
+
+   The special leaves have x/(p_b m) < x/y, and are computed with a
+   segmented sieve of [1, x/y] which removes one prime at a time, keeping
+   running counts of the surviving integers in blocks. P2 needs pi(t) for
+   x^(1/2) <= t < x/y, and is computed with the wheel sieve.
+
+   Both sieves are split into contiguous chunks which are processed by
+   different threads. The counts of each chunk are relative to the start
+   of the chunk and are corrected once all chunks are done.
+
+   All arithmetic is done modulo 2^FLINT_BITS; the final result is exact.
+*/
+
+/* bits per segment of the special leaf sieve */
+#define S2_SEGMENT_BITS 262144
+
+/* bits per counter of the special leaf sieve */
+#define S2_COUNTER_BITS 512
+
+/*
+   Period in words of the pattern of odd integers free of 3, 5, 7, 11 and 13,
+   with which each segment is initialised
+*/
+#define S2_PATTERN_WORDS 15015
+
+typedef struct
+{
+    ulong x;
+    ulong y;
+    slong a;
+    slong c;
+    const unsigned int * primes;
+    const unsigned int * lpf;
+    const signed char * mu;
+    mp_srcptr pattern;
+    ulong lo;
+    ulong hi;
+    ulong * phi;
+    ulong * weight;
+    ulong sum;
+}
+_s2_arg_t;
+
+/*
+   Sum of the special leaves with x/(p_b m) in [lo, hi), where phi(z, b-1)
+   is replaced by the number of integers in [lo, z] free of the first b - 1
+   primes. Sets phi[b - 1] to the number of integers in [lo, hi) free of
+   the first b - 1 primes and weight[b] to the sum of -mu(m) over the
+   leaves, for each b > c that can have leaves beyond hi. Only odd
+   integers are stored, bit i of a segment starting at low standing for
+   low + 2i + 1, and the multiples of the first c = 6 primes are removed
+   by copying a pattern, for which lo must be divisible by 128.
+*/
+static void
+_s2_sieve(_s2_arg_t * arg)
+{
+    const ulong x = arg->x, y = arg->y;
+    const unsigned int * primes = arg->primes;
+    const slong nw = S2_SEGMENT_BITS / FLINT_BITS;
+    slong b, bmax, i, k;
+    ulong low, high, len, p, q, m, mlo, mhi, idx, total, cnt, s, w, t, r;
+    mp_ptr bits;
+    ulong * counters;
+
+    bits = flint_malloc(nw * sizeof(mp_limb_t));
+    counters = flint_malloc(S2_SEGMENT_BITS / S2_COUNTER_BITS * sizeof(ulong));
+
+    arg->sum = 0;
+    bmax = arg->a - 1;
+
+    for (low = arg->lo; low < arg->hi; low += 2 * S2_SEGMENT_BITS)
+    {
+        high = FLINT_MIN(low + 2 * S2_SEGMENT_BITS, arg->hi);
+        len = (high - low) / 2;
+        q = x / FLINT_MAX(low, 1);
+
+        /* leaves x/(p_b m) >= low need p_b p_{b+1} <= x/low */
+        while (bmax > arg->c && (ulong) primes[bmax - 1] * primes[bmax] > q)
+            bmax--;
+
+        if (bmax <= arg->c)
+            break;
+
+        t = (low / (2 * FLINT_BITS)) % S2_PATTERN_WORDS;
+
+        for (i = 0; i < nw; i++)
+        {
+            bits[i] = (i < (len + FLINT_BITS - 1) / FLINT_BITS) ? arg->pattern[t] : 0;
+            t = (t == S2_PATTERN_WORDS - 1) ? 0 : t + 1;
+        }
+
+        if (len % FLINT_BITS != 0)
+            bits[len / FLINT_BITS] &= (UWORD(1) << (len % FLINT_BITS)) - 1;
+
+        for (k = 0, total = 0; k < S2_SEGMENT_BITS / S2_COUNTER_BITS; k++)
+        {
+            counters[k] = mpn_popcount(bits + k * (S2_COUNTER_BITS / FLINT_BITS),
+                                                   S2_COUNTER_BITS / FLINT_BITS);
+            total += counters[k];
+        }
+
+        for (b = arg->c + 1; b <= bmax; b++)
+        {
+            p = primes[b - 1];
+
+            mhi = FLINT_MIN(y, q / p);
+            mlo = FLINT_MAX(y / p, x / p / high) + 1;
+
+            k = 0;
+            cnt = 0;
+            s = 0;
+            w = 0;
+
+            /* x/(p m) increases as m decreases */
+            for (m = mhi; m >= mlo; m--)
+            {
+                if (arg->mu[m] == 0 || arg->lpf[m] <= p)
+                    continue;
+
+                /* number of odd integers in [low, x/(p m)] */
+                idx = (x / (p * m) - low + 1) / 2;
+
+                while ((k + 1) * S2_COUNTER_BITS <= idx)
+                    cnt += counters[k++];
+
+                i = (k * S2_COUNTER_BITS) / FLINT_BITS;
+                t = cnt;
+                if (idx / FLINT_BITS > i)
+                    t += mpn_popcount(bits + i, idx / FLINT_BITS - i);
+                if (idx % FLINT_BITS != 0)
+                {
+                    r = bits[idx / FLINT_BITS] & ((UWORD(1) << (idx % FLINT_BITS)) - 1);
+                    t += mpn_popcount(&r, 1);
+                }
+
+                t += arg->phi[b - 1];
+
+                if (arg->mu[m] > 0)
+                {
+                    s -= t;
+                    w--;
+                }
+                else
+                {
+                    s += t;
+                    w++;
+                }
+            }
+
+            arg->sum += s;
+            arg->weight[b] += w;
+
+            arg->phi[b - 1] += total;
+
+            /* remove the odd multiples of p_b */
+            t = ((low + p - 1) / p) * p;
+            t += (t % 2 == 0) ? p : 0;
+
+            for (i = (t - low) / 2; i < len; i += p)
+            {
+                r = (bits[i / FLINT_BITS] >> (i % FLINT_BITS)) & 1;
+                bits[i / FLINT_BITS] &= ~(UWORD(1) << (i % FLINT_BITS));
+                counters[i / S2_COUNTER_BITS] -= r;
+                total -= r;
+            }
+        }
+    }
+
+    flint_free(counters);
+    flint_free(bits);
+}
+
+static void *
+_s2_worker(void * arg_ptr)
+{
+    _s2_sieve((_s2_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static ulong
+_S2(ulong x, ulong y, slong a, slong c, const unsigned int * primes,
+                                  const unsigned int * lpf, const signed char * mu)
+{
+    ulong zmax = x / y, sum = 0, n;
+    ulong * before;
+    mp_ptr pattern;
+    slong b, i, num_threads;
+    _s2_arg_t * args;
+    pthread_t * threads;
+
+    pattern = flint_malloc(S2_PATTERN_WORDS * sizeof(mp_limb_t));
+
+    for (i = 0; i < S2_PATTERN_WORDS; i++)
+        pattern[i] = ~UWORD(0);
+
+    /* bit n stands for 2n + 1 */
+    for (i = 1; i < 6; i++)
+        for (n = primes[i] / 2; n < S2_PATTERN_WORDS * FLINT_BITS; n += primes[i])
+            pattern[n / FLINT_BITS] &= ~(UWORD(1) << (n % FLINT_BITS));
+
+    num_threads = flint_get_num_threads();
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads,
+                                      (slong) (zmax / (2 * S2_SEGMENT_BITS))));
+
+    args = flint_malloc(num_threads * sizeof(_s2_arg_t));
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+    /*
+       The work per integer near z is roughly proportional to the number of
+       primes up to (x/z)^(1/2), so chunks grow quadratically
+    */
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].x = x;
+        args[i].y = y;
+        args[i].a = a;
+        args[i].c = c;
+        args[i].primes = primes;
+        args[i].lpf = lpf;
+        args[i].mu = mu;
+        args[i].pattern = pattern;
+        args[i].lo = (i == 0) ? 0 : args[i - 1].hi;
+        args[i].hi = (i == num_threads - 1) ? zmax + 1 : FLINT_MAX(args[i].lo,
+                (ulong) (zmax * ((double) (i + 1) / num_threads)
+                              * ((double) (i + 1) / num_threads)) & ~UWORD(127));
+        args[i].phi = flint_calloc(a, sizeof(ulong));
+        args[i].weight = flint_calloc(a, sizeof(ulong));
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _s2_worker, &args[i]);
+
+    _s2_sieve(&args[0]);
+
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    /* correct the counts of each chunk by those of the previous chunks */
+    before = flint_calloc(a, sizeof(ulong));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        sum += args[i].sum;
+
+        for (b = c + 1; b < a; b++)
+            sum += args[i].weight[b] * before[b - 1];
+
+        for (b = 0; b < a; b++)
+            before[b] += args[i].phi[b];
+
+        flint_free(args[i].phi);
+        flint_free(args[i].weight);
+    }
+
+    flint_free(before);
+    flint_free(pattern);
+    flint_free(args);
+    flint_free(threads);
+
+    return sum;
+}
+
+typedef struct
+{
+    const unsigned int * primes;
+    slong num;
+    ulong lo;
+    ulong end;
+    const ulong * targets;
+    ulong * counts;
+    slong len;
+    ulong total;
+}
+_p2_arg_t;
+
+/*
+   Sets counts[j] to the number of primes in [lo, targets[j]] for the
+   increasing targets below end, and total to the number of primes in
+   [lo, end)
+*/
+static void
+_p2_sieve(_p2_arg_t * arg)
+{
+    n_primes_segment_t S;
+    slong j = 0, pos, e;
+    ulong cnt = 0;
+
+    /* x/p_i can equal x^(1/2) when p_i = x^(1/2) */
+    for ( ; j < arg->len && arg->targets[j] < arg->lo; j++)
+        arg->counts[j] = 0;
+
+    _n_primes_segment_init(S, arg->primes, arg->num,
+                                             arg->lo - arg->lo % 30, arg->end);
+
+    while (_n_primes_segment_next(S))
+    {
+        pos = 0;
+
+        for ( ; j < arg->len && arg->targets[j] < S->lo + 30 * (ulong) S->len; j++)
+        {
+            e = (arg->targets[j] - S->lo) / 30;
+
+            cnt += _n_sieve_wheel30_count(S->sieve + pos,
+                               S->lo + 30 * pos, e - pos, arg->lo, arg->end - 1);
+            pos = e;
+
+            arg->counts[j] = cnt + _n_sieve_wheel30_count(S->sieve + e,
+                                  S->lo + 30 * e, 1, arg->lo, arg->targets[j]);
+        }
+
+        cnt += _n_sieve_wheel30_count(S->sieve + pos,
+                         S->lo + 30 * pos, S->len - pos, arg->lo, arg->end - 1);
+    }
+
+    _n_primes_segment_clear(S);
+
+    arg->total = cnt;
+}
+
+static void *
+_p2_worker(void * arg_ptr)
+{
+    _p2_sieve((_p2_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/* sum_{a < i <= pi(x^(1/2))} (pi(x/p_i) - i + 1), for p_{a+1}^3 > x */
+static ulong
+_P2(ulong x, slong a, const unsigned int * primes)
+{
+    const ulong span = 30 * (ulong) FLINT_PRIMES_SEGMENT_SIZE;
+    ulong s, hi, m, pi, sum = 0;
+    ulong * targets, * counts;
+    slong i, j, nt, ns, num, num_threads;
+    _p2_arg_t * args;
+    pthread_t * threads;
+
+    s = n_sqrt(x);
+
+    for (ns = a; primes[ns] <= s; ns++) ;
+
+    if (ns == a)
+        return 0;
+
+    /* x/p_i for i = ns, ..., a + 1, which are increasing */
+    nt = ns - a;
+    targets = flint_malloc(nt * sizeof(ulong));
+    counts = flint_malloc(nt * sizeof(ulong));
+
+    for (j = 0; j < nt; j++)
+        targets[j] = x / primes[ns - 1 - j];
+
+    hi = targets[nt - 1] + 1;
+
+    /* sieving primes from 7 to sqrt(hi - 1) */
+    for (num = 3; (ulong) primes[num] * primes[num] < hi; num++) ;
+    num -= 3;
+
+    m = (hi - s - 1) / span;
+    num_threads = flint_get_num_threads();
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, (slong) m));
+
+    args = flint_malloc(num_threads * sizeof(_p2_arg_t));
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+    for (i = 0, j = 0; i < num_threads; i++)
+    {
+        args[i].primes = primes + 3;
+        args[i].num = num;
+        args[i].lo = (i == 0) ? s + 1 : args[i - 1].end;
+        args[i].end = (i == num_threads - 1) ? hi : s + 1 + ((i + 1) * m / num_threads) * span;
+        args[i].targets = targets + j;
+        args[i].counts = counts + j;
+
+        for (args[i].len = 0; j < nt && targets[j] < args[i].end; j++)
+            args[i].len++;
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _p2_worker, &args[i]);
+
+    _p2_sieve(&args[0]);
+
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    /* pi(x/p_i) = pi(s) + primes in previous chunks + primes in this chunk */
+    pi = ns;
+
+    for (i = 0, j = 0; i < num_threads; i++)
+    {
+        for ( ; j < nt && targets[j] < args[i].end; j++)
+            sum += pi + counts[j] - (ns - 1 - j);
+
+        pi += args[i].total;
+    }
+
+    flint_free(args);
+    flint_free(threads);
+    flint_free(targets);
+    flint_free(counts);
+
+    return sum;
+}
+
+ulong _n_prime_pi_lmo(ulong x)
+{
+    ulong y, n, pp, tot, pc, S1, S2, P2, res;
+    slong i, a, c;
+    unsigned int * lpf, * tab;
+    signed char * mu;
+    const unsigned int * primes;
+    n_primes_t iter;
+
+    /*
+       y >= x^(1/3) so that P2 accounts for all products of large primes;
+       larger multiples of x^(1/3) were found to be slower up to 10^15
+    */
+    y = n_cbrt(x);
+
+    n_primes_init(iter);
+    n_primes_extend_small(iter, n_sqrt(x) + 1);
+    primes = iter->small_primes;
+
+    for (a = 0; primes[a] <= y; a++) ;
+
+    c = 6;
+
+    /* least prime factor and Moebius function up to y, with lpf(1) = oo */
+    lpf = flint_calloc(y + 1, sizeof(unsigned int));
+    mu = flint_malloc(y + 1);
+    memset(mu, 1, y + 1);
+
+    for (i = 0; i < a; i++)
+    {
+        ulong p = primes[i];
+
+        for (n = p; n <= y; n += p)
+        {
+            if (lpf[n] == 0)
+                lpf[n] = p;
+            mu[n] = -mu[n];
+        }
+
+        for (n = p * p; n <= y; n += p * p)
+            mu[n] = 0;
+    }
+
+    lpf[1] = ~0U;
+
+    /* phi(z, c) = (z / pp) phi(pp) + tab[z % pp] */
+    for (i = 0, pp = 1; i < c; i++)
+        pp *= primes[i];
+
+    tab = flint_malloc(pp * sizeof(unsigned int));
+
+    for (n = 0, tot = 0; n < pp; n++)
+    {
+        if (n != 0 && n_gcd(pp, n) == 1)
+            tot++;
+        tab[n] = tot;
+    }
+
+    pc = (c == 0) ? 0 : primes[c - 1];
+
+    S1 = 0;
+    for (n = 1; n <= y; n++)
+    {
+        if (mu[n] != 0 && lpf[n] > pc)
+        {
+            ulong z = x / n;
+            ulong t = (z / pp) * tab[pp - 1] + tab[z % pp];
+
+            if (mu[n] > 0)
+                S1 += t;
+            else
+                S1 -= t;
+        }
+    }
+
+    S2 = _S2(x, y, a, c, primes, lpf, mu);
+
+    P2 = _P2(x, a, primes);
+
+    res = S1 + S2 + a - 1 - P2;
+
+    flint_free(tab);
+    flint_free(mu);
+    flint_free(lpf);
+    n_primes_clear(iter);
+
+    return res;
+}
@@ -0,0 +1,127 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#undef ulong
+#define ulong ulongxx/* interferes with system includes */
+
+#include <pthread.h>
+
+#undef ulong
+
+#include <gmp.h>
+
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    const unsigned int * primes;
+    slong num;
+    ulong lo;
+    ulong end;
+    ulong a;
+    ulong b;
+    ulong count;
+}
+_count_arg_t;
+
+static void
+_count_sieve(_count_arg_t * arg)
+{
+    n_primes_segment_t S;
+
+    arg->count = 0;
+
+    _n_primes_segment_init(S, arg->primes, arg->num, arg->lo, arg->end);
+
+    while (_n_primes_segment_next(S))
+        arg->count += _n_sieve_wheel30_count(S->sieve, S->lo, S->len,
+                                                           arg->a, arg->b);
+
+    _n_primes_segment_clear(S);
+}
+
+static void *
+_count_worker(void * arg_ptr)
+{
+    _count_sieve((_count_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+ulong n_primes_count_range(ulong a, ulong b)
+{
+    const ulong span = 30 * (ulong) FLINT_PRIMES_SEGMENT_SIZE;
+    ulong lo, m, count = 0;
+    slong i, num, num_threads;
+    _count_arg_t * args;
+    pthread_t * threads;
+    n_primes_t iter;
+
+    if (b <= a)
+        return 0;
+
+    /* 2, 3 and 5 are not in the wheel */
+    for (i = 0; i < 3; i++)
+        if (flint_primes_small[i] >= a && flint_primes_small[i] < b)
+            count++;
+
+    if (b <= 7)
+        return count;
+
+    /* sieving primes from 7 to sqrt(b - 1) */
+    n_primes_init(iter);
+    n_primes_extend_small(iter, n_sqrt(b - 1) + 1);
+
+    for (num = 3; (ulong) iter->small_primes[num] * iter->small_primes[num] < b; num++) ;
+    num -= 3;
+
+    /* one contiguous chunk of whole segments per thread */
+    lo = a - a % 30;
+    m = (b - lo) / span;
+    num_threads = flint_get_num_threads();
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, (slong) m));
+
+    args = flint_malloc(num_threads * sizeof(_count_arg_t));
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].primes = iter->small_primes + 3;
+        args[i].num = num;
+        args[i].lo = lo + (i * m / num_threads) * span;
+        args[i].end = (i == num_threads - 1) ? b
+                                    : lo + ((i + 1) * m / num_threads) * span;
+        args[i].a = a;
+        args[i].b = b - 1;
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _count_worker, &args[i]);
+
+    _count_sieve(&args[0]);
+
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    for (i = 0; i < num_threads; i++)
+        count += args[i].count;
+
+    flint_free(args);
+    flint_free(threads);
+
+    n_primes_clear(iter);
+
+    return count;
+}
@@ -0,0 +1,145 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#undef ulong
+#define ulong ulongxx/* interferes with system includes */
+
+#include <pthread.h>
+
+#undef ulong
+
+#include <gmp.h>
+
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    const unsigned int * primes;
+    slong num;
+    ulong lo;
+    ulong end;
+    ulong a;
+    ulong b;
+    n_primes_callback_t func;
+    void * arg;
+}
+_range_arg_t;
+
+/* number of sieve bytes decoded per call to the callback */
+#define BATCH_BYTES (FLINT_PRIMES_SEGMENT_SIZE / 8)
+
+static void
+_range_sieve(_range_arg_t * arg)
+{
+    n_primes_segment_t S;
+    ulong * batch;
+    slong off, len, n;
+
+    batch = flint_malloc(8 * BATCH_BYTES * sizeof(ulong));
+
+    _n_primes_segment_init(S, arg->primes, arg->num, arg->lo, arg->end);
+
+    while (_n_primes_segment_next(S))
+    {
+        for (off = 0; off < S->len; off += BATCH_BYTES)
+        {
+            len = FLINT_MIN(BATCH_BYTES, S->len - off);
+
+            n = _n_sieve_wheel30_decode(batch, S->sieve + off,
+                                  S->lo + 30 * off, len, arg->a, arg->b);
+
+            if (n != 0)
+                arg->func(batch, n, arg->arg);
+        }
+    }
+
+    _n_primes_segment_clear(S);
+    flint_free(batch);
+}
+
+static void *
+_range_worker(void * arg_ptr)
+{
+    _range_sieve((_range_arg_t *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void n_primes_range_callback(ulong a, ulong b,
+                             n_primes_callback_t func, void * arg)
+{
+    const ulong span = 30 * (ulong) FLINT_PRIMES_SEGMENT_SIZE;
+    ulong small[3], lo, m;
+    slong i, j, num, num_threads;
+    _range_arg_t * args;
+    pthread_t * threads;
+    n_primes_t iter;
+
+    if (b <= a)
+        return;
+
+    /* 2, 3 and 5 are not in the wheel */
+    for (i = 0, j = 0; i < 3; i++)
+        if (flint_primes_small[i] >= a && flint_primes_small[i] < b)
+            small[j++] = flint_primes_small[i];
+
+    if (j != 0)
+        func(small, j, arg);
+
+    if (b <= 7)
+        return;
+
+    /* sieving primes from 7 to sqrt(b - 1) */
+    n_primes_init(iter);
+    n_primes_extend_small(iter, n_sqrt(b - 1) + 1);
+
+    for (num = 3; (ulong) iter->small_primes[num] * iter->small_primes[num] < b; num++) ;
+    num -= 3;
+
+    /* one contiguous chunk of whole segments per thread */
+    lo = a - a % 30;
+    m = (b - lo) / span;
+    num_threads = flint_get_num_threads();
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, (slong) m));
+
+    args = flint_malloc(num_threads * sizeof(_range_arg_t));
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].primes = iter->small_primes + 3;
+        args[i].num = num;
+        args[i].lo = lo + (i * m / num_threads) * span;
+        args[i].end = (i == num_threads - 1) ? b
+                                    : lo + ((i + 1) * m / num_threads) * span;
+        args[i].a = a;
+        args[i].b = b - 1;
+        args[i].func = func;
+        args[i].arg = arg;
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _range_worker, &args[i]);
+
+    _range_sieve(&args[0]);
+
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(args);
+    flint_free(threads);
+
+    n_primes_clear(iter);
+}
@@ -0,0 +1,213 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+   A segmented wheel-30 sieve of [lo, end). Primes below the segment size
+   cross off their multiples directly, carrying the offset of their next
+   multiple of each wheel residue from one segment to the next. Larger
+   primes hit a segment at most once per residue, so their next hits are
+   kept in buckets indexed by segment, and a segment only touches the
+   primes which actually hit it.
+*/
+
+static void
+_bucket_push(n_primes_bucket_struct * B, unsigned int pos, unsigned int idx)
+{
+    if (B->num == B->alloc)
+    {
+        B->alloc = FLINT_MAX(16, 2 * B->alloc);
+        B->entries = flint_realloc(B->entries,
+                                B->alloc * sizeof(n_primes_bucket_entry_struct));
+    }
+
+    B->entries[B->num].pos = pos;
+    B->entries[B->num].idx = idx;
+    B->num++;
+}
+
+/*
+   Byte offset from lo of the least multiple p*k >= p^2 of p with p*k
+   congruent to the j-th wheel residue modulo 30, or UWORD_MAX on overflow
+*/
+static ulong
+_first_offset(ulong p, ulong pinv, ulong lo, int j)
+{
+    ulong k0, k;
+
+    k0 = FLINT_MAX(p, lo / p + (lo % p != 0));
+    k = (flint_primes_wheel30[j] * pinv) % 30;
+    k = k0 + (k + 30 - k0 % 30) % 30;
+
+    if (k > UWORD_MAX / p)
+        return UWORD_MAX;
+
+    return (p * k - lo) / 30;
+}
+
+void _n_primes_segment_init(n_primes_segment_t S,
+               const unsigned int * primes, slong num, ulong lo, ulong end)
+{
+    slong i;
+    int j;
+    ulong pinv;
+
+    S->lo = lo;
+    S->end = end;
+    S->len = 0;
+    S->seg = -1;
+    S->sieve = flint_malloc(FLINT_PRIMES_SEGMENT_SIZE);
+    S->primes = primes;
+    S->num = num;
+
+    for (i = 0; i < num && primes[i] < FLINT_PRIMES_SEGMENT_SIZE; i++) ;
+
+    S->num_small = i;
+    S->num_active = i;
+    S->next = flint_malloc(8 * FLINT_MAX(i, 1) * sizeof(ulong));
+
+    for (i = 0; i < S->num_small; i++)
+    {
+        pinv = n_invmod(primes[i] % 30, 30);
+
+        for (j = 0; j < 8; j++)
+            S->next[8*i + j] = _first_offset(primes[i], pinv, lo, j);
+    }
+
+    if (num > S->num_small)
+    {
+        S->num_buckets = primes[num - 1] / FLINT_PRIMES_SEGMENT_SIZE + 2;
+        S->buckets = flint_calloc(S->num_buckets, sizeof(n_primes_bucket_struct));
+    }
+    else
+    {
+        S->num_buckets = 0;
+        S->buckets = NULL;
+    }
+}
+
+int _n_primes_segment_next(n_primes_segment_t S)
+{
+    const ulong span = 30 * (ulong) FLINT_PRIMES_SEGMENT_SIZE;
+    unsigned char * sieve = S->sieve;
+    slong i, e, len;
+    ulong p, o, q, left, pinv;
+    int j;
+
+    if (S->seg >= 0)
+    {
+        if (S->end - S->lo <= span)
+            return 0;
+
+        S->lo += span;
+    }
+    else if (S->lo >= S->end)
+        return 0;
+
+    S->seg++;
+
+    left = S->end - S->lo;
+    len = (left >= span) ? FLINT_PRIMES_SEGMENT_SIZE : (left + 29) / 30;
+    S->len = len;
+
+    memset(sieve, 0xff, len);
+
+    if (S->lo == 0)
+        sieve[0] &= ~1; /* 1 is not prime */
+
+    /* small primes, several hits per segment */
+    for (i = 0; i < S->num_small; i++)
+    {
+        p = S->primes[i];
+
+        for (j = 0; j < 8; j++)
+        {
+            for (o = S->next[8*i + j]; o < (ulong) len; o += p)
+                sieve[o] &= ~(1 << j);
+
+            S->next[8*i + j] = o - len;
+        }
+    }
+
+    if (S->num_buckets == 0)
+        return 1;
+
+    /* put the large primes whose square is reached into the buckets */
+    while (S->num_active < S->num)
+    {
+        p = S->primes[S->num_active];
+        q = p * p;
+
+        if (q >= S->lo && q - S->lo >= 30 * (ulong) len)
+            break;
+
+        pinv = n_invmod(p % 30, 30);
+
+        for (j = 0; j < 8; j++)
+        {
+            o = _first_offset(p, pinv, S->lo, j);
+
+            if (o == UWORD_MAX)
+                continue;
+
+            _bucket_push(S->buckets + (S->seg + o / FLINT_PRIMES_SEGMENT_SIZE)
+                % S->num_buckets, ((o % FLINT_PRIMES_SEGMENT_SIZE) << 3) | j,
+                S->num_active);
+        }
+
+        S->num_active++;
+    }
+
+    /* large primes hitting this segment, then move them to their next one */
+    {
+        n_primes_bucket_struct * B = S->buckets + S->seg % S->num_buckets;
+
+        for (e = 0; e < B->num; e++)
+        {
+            unsigned int pos = B->entries[e].pos;
+            unsigned int idx = B->entries[e].idx;
+
+            o = pos >> 3;
+            j = pos & 7;
+
+            if (o >= (ulong) len) /* past the end of the range */
+                continue;
+
+            sieve[o] &= ~(1 << j);
+
+            o += S->primes[idx];
+
+            _bucket_push(S->buckets + (S->seg + o / FLINT_PRIMES_SEGMENT_SIZE)
+                % S->num_buckets, ((o % FLINT_PRIMES_SEGMENT_SIZE) << 3) | j,
+                idx);
+        }
+
+        B->num = 0;
+    }
+
+    return 1;
+}
+
+void _n_primes_segment_clear(n_primes_segment_t S)
+{
+    slong i;
+
+    for (i = 0; i < S->num_buckets; i++)
+        flint_free(S->buckets[i].entries);
+
+    flint_free(S->buckets);
+    flint_free(S->next);
+    flint_free(S->sieve);
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -14,63 +15,20 @@
 #include "flint.h"
 #include "ulong_extras.h"
 
-static void
-mark(char * sieve, mp_limb_t a, slong len, mp_limb_t p)
-{
-    mp_limb_t t;
-
-    t = p * p;
-    if (t >= a)
-    {
-        t = (t - a) / 2;
-    }
-    else
-    {
-        t = p - ((a - p) / 2) % p;
-        if (t == p)
-            t = 0;
-    }
-
-    while (t < len)
-    {
-        sieve[t] = 0;
-        t += p;
-    }
-}
-
-void
-n_sieve_odd(char * sieve, ulong n, mp_limb_t a,
-    unsigned int * sieve_primes, mp_limb_t bound)
-{
-    slong i;
-    mp_limb_t p;
-
-    for (i = 0; i < n / 2; i++)
-        sieve[i] = 1;
-
-    i = 0;
-    while (1)
-    {
-        i++;
-        p = sieve_primes[i];
-        if (p > bound)
-            break;
-        mark(sieve, a, n / 2, p);
-    }
-}
-
 void
 n_primes_sieve_range(n_primes_t iter, mp_limb_t a, mp_limb_t b)
 {
-    mp_limb_t bound;
-    ulong len, odd_len;
+    mp_limb_t lo;
+    ulong len;
+    slong i, num;
+    unsigned char * sieve;
+    TMP_INIT;
 
     /* a and b must be odd */
     a += (a % 2 == 0);
     b -= (b % 2 == 0);
 
     len = b - a + 2;
-    odd_len = len / 2;
 
     if (a < 3 || b < a || len > FLINT_SIEVE_SIZE)
     {
@@ -78,16 +36,37 @@ n_primes_sieve_range(n_primes_t iter, mp_limb_t a, mp_limb_t b)
         flint_abort();
     }
 
-    bound = n_sqrt(b) + 1;
-
+    /*
+       By the Brun-Titchmarsh theorem (Montgomery-Vaughan form) there are
+       fewer than 2y/log(y) < FLINT_SIEVE_SIZE/4 primes in the range
+    */
     if (iter->sieve == NULL)
-        iter->sieve = flint_malloc(FLINT_SIEVE_SIZE / 2 * sizeof(char));
+        iter->sieve = flint_malloc(FLINT_SIEVE_SIZE / 4 * sizeof(mp_limb_t));
+
+    n_primes_extend_small(iter, n_sqrt(b) + 1);
+
+    /* sieving primes from 7 to sqrt(b) */
+    for (i = 3; (mp_limb_t) iter->small_primes[i] * iter->small_primes[i] <= b; i++) ;
+
+    num = 0;
+    if (a <= 3)
+        iter->sieve[num++] = 3;
+    if (a <= 5 && b >= 5)
+        iter->sieve[num++] = 5;
+
+    lo = a - a % 30;
+    len = (b - lo) / 30 + 1;
+
+    TMP_START;
+    sieve = TMP_ALLOC(len);
+
+    _n_sieve_wheel30(sieve, lo, len, iter->small_primes + 3, i - 3);
+    num += _n_sieve_wheel30_decode(iter->sieve + num, sieve, lo, len, a, b);
 
-    n_primes_extend_small(iter, bound);
-    n_sieve_odd(iter->sieve, len, a, iter->small_primes, bound);
+    TMP_END;
 
     iter->sieve_i = 0;
-    iter->sieve_num = odd_len;
+    iter->sieve_num = num;
     iter->sieve_a = a;
     iter->sieve_b = b;
 }
@@ -0,0 +1,104 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+
+#define NUM 1024
+
+typedef struct
+{
+    ulong * vec;
+    n_factor_t * factors;
+    int vector;
+} factor_vec_t;
+
+void sample(void * arg, ulong count)
+{
+    factor_vec_t * params = (factor_vec_t *) arg;
+    ulong i, j;
+
+    for (i = 0; i < count; i++)
+    {
+        for (j = 0; j < NUM; j++)
+            n_factor_init(params->factors + j);
+
+        prof_start();
+        if (params->vector)
+            n_factor_vec(params->factors, params->vec, NUM, 0);
+        else
+        {
+            for (j = 0; j < NUM; j++)
+                n_factor(params->factors + j, params->vec[j], 0);
+        }
+        prof_stop();
+    }
+}
+
+/* random bits-bit numbers if semi is 0, else products of two primes */
+void fill_array(ulong * vec, mp_bitcnt_t bits, int semi, flint_rand_t state)
+{
+    ulong i;
+
+    for (i = 0; i < NUM; i++)
+    {
+        if (semi)
+        {
+            do
+            {
+                vec[i] = n_randprime(state, bits / 2, 0)
+                       * n_randprime(state, bits - bits / 2, 0);
+            } while (FLINT_BIT_COUNT(vec[i]) != bits);
+        } else
+            vec[i] = n_randbits(state, bits);
+    }
+}
+
+int main(void)
+{
+    double min, max, t1, t2;
+    factor_vec_t params;
+    int i, semi;
+    FLINT_TEST_INIT(state);
+
+    params.vec = flint_malloc(NUM * sizeof(ulong));
+    params.factors = flint_malloc(NUM * sizeof(n_factor_t));
+
+    for (semi = 0; semi < 2; semi++)
+    {
+        flint_printf("factor_vec, %s:\n",
+                          semi ? "products of two primes" : "random numbers");
+
+        for (i = 8; i <= FLINT_BITS; i += 4)
+        {
+            fill_array(params.vec, i, semi, state);
+
+            params.vector = 0;
+            prof_repeat(&min, &max, sample, &params);
+            t1 = min / (double) NUM;
+
+            params.vector = 1;
+            prof_repeat(&min, &max, sample, &params);
+            t2 = min / (double) NUM;
+
+            flint_printf("bits = %d, n_factor %.3f us, n_factor_vec %.3f us, "
+                         "ratio %.2f\n", i, t1, t2, t1 / t2);
+        }
+    }
+
+    flint_randclear(state);
+    flint_free(params.vec);
+    flint_free(params.factors);
+    return 0;
+}
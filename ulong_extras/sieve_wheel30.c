@@ -0,0 +1,137 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+   Bit j of byte i of a wheel-30 sieve starting at lo (a multiple of 30)
+   stands for lo + 30*i + flint_primes_wheel30[j].
+*/
+const unsigned char flint_primes_wheel30[8] = { 1, 7, 11, 13, 17, 19, 23, 29 };
+
+/* inverse modulo 30 of each residue coprime to 30 */
+static const unsigned char wheel_inverse[30] = {
+    0, 1, 0, 0, 0, 0, 0, 13, 0, 0, 0, 11, 0, 7, 0, 0, 0, 23,
+    0, 19, 0, 0, 0, 17, 0, 0, 0, 0, 0, 29 };
+
+static const unsigned char bit_count[16] = {
+    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+/*
+   Clears the bits of (sieve, len) for the multiples p*k >= p^2 of each of
+   the primes 7 <= p in (primes, num), assuming the bits are initially set.
+*/
+void _n_sieve_wheel30(unsigned char * sieve, ulong lo, slong len,
+                                      const unsigned int * primes, slong num)
+{
+    slong i, j;
+    ulong p, k0, k, o;
+    unsigned int pinv;
+
+    memset(sieve, 0xff, len);
+
+    if (lo == 0)
+        sieve[0] &= ~1; /* 1 is not prime */
+
+    for (i = 0; i < num; i++)
+    {
+        p = primes[i];
+        pinv = wheel_inverse[p % 30];
+
+        /* least cofactor that can give a new multiple in the segment */
+        k0 = FLINT_MAX(p, lo / p + (lo % p != 0));
+
+        for (j = 0; j < 8; j++)
+        {
+            /* p*k = wheel[j] mod 30 */
+            k = (flint_primes_wheel30[j] * pinv) % 30;
+            k = k0 + (k + 30 - k0 % 30) % 30;
+
+            if (k > UWORD_MAX / p)
+                continue;
+
+            for (o = (p * k - lo) / 30; o < (ulong) len; o += p)
+                sieve[o] &= ~(1 << j);
+        }
+    }
+}
+
+/*
+   Writes the primes in [a, b] marked in the sieve to res, in increasing
+   order, and returns their number. The primes 2, 3 and 5 are not marked.
+*/
+slong _n_sieve_wheel30_decode(ulong * res, const unsigned char * sieve,
+                                      ulong lo, slong len, ulong a, ulong b)
+{
+    slong i, num = 0;
+    ulong n, w;
+    unsigned int c, j;
+
+    for (i = 0; i < len; i++)
+    {
+        w = sieve[i];
+
+        while (w != 0)
+        {
+            count_trailing_zeros(c, w);
+            w &= w - 1;
+            j = c;
+
+            n = lo + 30*i + flint_primes_wheel30[j];
+
+            if (n > b)
+                return num;
+
+            if (n >= a)
+                res[num++] = n;
+        }
+    }
+
+    return num;
+}
+
+/* Counts the primes in [a, b] marked in the sieve */
+ulong _n_sieve_wheel30_count(const unsigned char * sieve,
+                                      ulong lo, slong len, ulong a, ulong b)
+{
+    slong i;
+    ulong n, w, num = 0;
+    unsigned int c;
+
+    for (i = 0; i < len; i++)
+    {
+        n = lo + 30*i;
+
+        if (n + 1 >= a && n + 29 <= b)
+        {
+            num += bit_count[sieve[i] & 15] + bit_count[sieve[i] >> 4];
+        }
+        else
+        {
+            w = sieve[i];
+
+            while (w != 0)
+            {
+                count_trailing_zeros(c, w);
+                w &= w - 1;
+
+                if (n + flint_primes_wheel30[c] >= a
+                    && n + flint_primes_wheel30[c] <= b)
+                    num++;
+            }
+        }
+    }
+
+    return num;
+}
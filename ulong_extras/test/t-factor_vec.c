@@ -0,0 +1,115 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+    slong i, j, k, l;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("factor_vec....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        slong len = n_randint(state, (i % 10 == 0) ?
+                                   2 * FLINT_FACTOR_VEC_THREADED_CUTOFF : 64);
+        mp_limb_t * vec = flint_malloc(len * sizeof(mp_limb_t));
+        n_factor_t * factors = flint_malloc(len * sizeof(n_factor_t));
+        int proved = n_randint(state, 2);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        for (j = 0; j < len; j++)
+        {
+            mp_limb_t p, q;
+
+            n_factor_init(factors + j);
+
+            switch (n_randint(state, 5))
+            {
+                case 0:
+                    vec[j] = n_randtest(state);
+                    break;
+                case 1:
+                    vec[j] = n_randint(state, 1000);
+                    break;
+                case 2:
+                    /* products of two primes of about the same size */
+                    k = n_randint(state, FLINT_BITS / 2 - 1) + 2;
+                    p = n_randprime(state, k, 0);
+                    q = n_randprime(state, k, 0);
+                    vec[j] = p * q;
+                    break;
+                case 3:
+                    /* prime powers times small cofactors */
+                    p = n_randtest_prime(state, 0);
+                    k = n_randint(state, FLINT_BITS / FLINT_BIT_COUNT(p)) + 1;
+                    vec[j] = n_pow(p, k);
+                    vec[j] *= n_randint(state, UWORD_MAX / vec[j]) + 1;
+                    break;
+                default:
+                    vec[j] = n_randtest_prime(state, 0);
+                    vec[j] *= n_randtest_not_zero(state) % (UWORD_MAX / vec[j]) + 1;
+            }
+        }
+
+        n_factor_vec(factors, vec, len, proved);
+
+        for (j = 0; j < len; j++)
+        {
+            n_factor_t fac;
+            int result = 1;
+
+            n_factor_init(&fac);
+
+            if (vec[j] != 0)
+                n_factor(&fac, vec[j], proved);
+
+            result = (fac.num == factors[j].num);
+
+            for (k = 0; k < fac.num && result; k++)
+            {
+                for (l = 0; l < factors[j].num; l++)
+                    if (factors[j].p[l] == fac.p[k])
+                        break;
+
+                result = (l < factors[j].num && factors[j].exp[l] == fac.exp[k]);
+            }
+
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("n = %wu, proved = %d\n", vec[j], proved);
+                for (k = 0; k < factors[j].num; k++)
+                    flint_printf("%wu^%wu ", factors[j].p[k], factors[j].exp[k]);
+                flint_printf("\n");
+                abort();
+            }
+        }
+
+        flint_free(vec);
+        flint_free(factors);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,84 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+    slong i, j;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("is_probabprime_vec....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        slong len = n_randint(state, 2 * FLINT_IS_PRIME_VEC_THREADED_CUTOFF);
+        mp_limb_t * vec = flint_malloc(len * sizeof(mp_limb_t));
+        int * res = flint_malloc(len * sizeof(int));
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        for (j = 0; j < len; j++)
+        {
+            switch (n_randint(state, 4))
+            {
+                case 0:
+                    vec[j] = n_randtest(state);
+                    break;
+                case 1:
+                    vec[j] = n_randint(state, 1000);
+                    break;
+                case 2:
+                    vec[j] = n_randtest_prime(state, 0);
+                    break;
+                default:
+                    vec[j] = n_randtest_prime(state, 0) * n_randtest_prime(state, 0);
+            }
+        }
+
+#if FLINT64
+        /* strong pseudoprimes to base 2 */
+        if (len > 2)
+        {
+            vec[0] = UWORD(3215031751);
+            vec[1] = UWORD(3825123056546413051);
+        }
+#endif
+
+        n_is_probabprime_vec(res, vec, len);
+
+        for (j = 0; j < len; j++)
+        {
+            if (res[j] != n_is_probabprime(vec[j]))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("n = %wu, res = %d\n", vec[j], res[j]);
+                abort();
+            }
+        }
+
+        flint_free(vec);
+        flint_free(res);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
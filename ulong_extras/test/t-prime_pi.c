@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2018 William Hart
 
     This file is part of FLINT.
 
@@ -43,6 +44,61 @@ int main(void)
         }
     }
 
+    /* large arguments, compared with a sieve */
+    for (n = 0; n < 20 * FLINT_MIN(10, flint_test_multiplier()); n++)
+    {
+        ulong x, p;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        x = FLINT_PRIME_PI_LMO_CUTOFF + n_randint(state, UWORD(1) << 27);
+
+        if (n_prime_pi(x) != n_primes_count_range(0, x + 1))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("pi(%wu) = %wu\n", x, n_prime_pi(x));
+            abort();
+        }
+
+        x = FLINT_NTH_PRIME_LMO_CUTOFF + n_randint(state, UWORD(1) << 22);
+        p = n_nth_prime(x);
+
+        if (!n_is_prime(p) || n_primes_count_range(0, p + 1) != x)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("prime(%wu) = %wu\n", x, p);
+            abort();
+        }
+    }
+
+#if FLINT64
+    /* known values */
+    {
+        const ulong pi[] = { UWORD(455052511), UWORD(4118054813),
+                             UWORD(37607912018) };
+        ulong x = UWORD(10000000000);
+
+        for (n = 0; n < 3; n++, x *= 10)
+        {
+            if (n_prime_pi(x) != pi[n])
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("pi(%wu) = %wu\n", x, n_prime_pi(x));
+                abort();
+            }
+        }
+
+        if (n_nth_prime(UWORD(1000000000)) != UWORD(22801763489))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("prime(10^9) = %wu\n", n_nth_prime(UWORD(1000000000)));
+            abort();
+        }
+    }
+#endif
+
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     flint_printf("PASS\n");
     return 0;
@@ -0,0 +1,81 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("primes_count_range....");
+    fflush(stdout);
+
+    /* compare with n_prime_pi */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        ulong a, b, c1, c2;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        a = n_randint(state, 3000000);
+        b = n_randint(state, 3000000);
+
+        c1 = n_primes_count_range(a, b);
+        c2 = (b <= a) ? 0 : n_prime_pi(b - 1) - (a == 0 ? 0 : n_prime_pi(a - 1));
+
+        if (c1 != c2)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("a = %wu, b = %wu, c1 = %wu, c2 = %wu\n", a, b, c1, c2);
+            abort();
+        }
+    }
+
+    /* compare with the iterator on larger ranges */
+    for (i = 0; i < 30 * flint_test_multiplier(); i++)
+    {
+        ulong a, b, p, c1, c2;
+        n_primes_t iter;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        a = n_randtest(state) % (UWORD(1) << (n_randint(state, 35) + 1));
+        b = a + n_randint(state, 3000000);
+
+        c1 = n_primes_count_range(a, b);
+
+        c2 = 0;
+        n_primes_init(iter);
+        if (a > 0)
+            n_primes_jump_after(iter, a - 1);
+        for (p = n_primes_next(iter); p < b; p = n_primes_next(iter))
+            c2++;
+        n_primes_clear(iter);
+
+        if (c1 != c2)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("a = %wu, b = %wu, c1 = %wu, c2 = %wu\n", a, b, c1, c2);
+            abort();
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
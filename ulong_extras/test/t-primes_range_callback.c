@@ -0,0 +1,119 @@
+/*
+    Copyright (C) 2018 William Hart
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#undef ulong
+#define ulong ulongxx/* interferes with system includes */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#undef ulong
+
+#include <gmp.h>
+
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    ulong a;
+    ulong b;
+    ulong num;
+    ulong sum;
+    int ok;
+    pthread_mutex_t mutex;
+}
+range_check_t;
+
+void check_batch(const ulong * primes, slong num, void * arg)
+{
+    range_check_t * c = (range_check_t *) arg;
+    ulong sum = 0;
+    int ok = 1;
+    slong i;
+
+    for (i = 0; i < num; i++)
+    {
+        if (primes[i] < c->a || primes[i] >= c->b || !n_is_prime(primes[i])
+            || (i > 0 && primes[i] <= primes[i - 1]))
+            ok = 0;
+
+        sum += primes[i];
+    }
+
+    pthread_mutex_lock(&c->mutex);
+    c->num += num;
+    c->sum += sum;
+    c->ok &= ok;
+    pthread_mutex_unlock(&c->mutex);
+}
+
+int main(void)
+{
+    slong i;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("primes_range_callback....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        range_check_t c;
+        n_primes_t iter;
+        ulong p, num, sum;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        c.a = n_randint(state, 2) ? n_randint(state, 1000)
+            : n_randtest(state) % (UWORD(1) << (n_randint(state, 35) + 1));
+
+        if (n_randint(state, 10) == 0)
+            c.b = c.a + n_randint(state, 3000000);
+        else
+            c.b = c.a + n_randint(state, 100000);
+
+        c.num = c.sum = 0;
+        c.ok = 1;
+        pthread_mutex_init(&c.mutex, NULL);
+
+        n_primes_range_callback(c.a, c.b, check_batch, &c);
+
+        pthread_mutex_destroy(&c.mutex);
+
+        num = sum = 0;
+        n_primes_init(iter);
+        if (c.a > 0)
+            n_primes_jump_after(iter, c.a - 1);
+        for (p = n_primes_next(iter); p < c.b; p = n_primes_next(iter))
+        {
+            num++;
+            sum += p;
+        }
+        n_primes_clear(iter);
+
+        if (!c.ok || c.num != num || c.sum != sum)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("a = %wu, b = %wu, ok = %d\n", c.a, c.b, c.ok);
+            flint_printf("num = %wu, %wu\n", c.num, num);
+            abort();
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}